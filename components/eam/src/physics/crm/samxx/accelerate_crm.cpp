@@ -1,7 +1,7 @@
 
 #include "accelerate_crm.h"
 
-void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
+void accelerate_crm(int nstep, int &nstop, bool &ceaseflag) {
   YAKL_SCOPE( t                , :: t);
   YAKL_SCOPE( qcl              , :: qcl);
   YAKL_SCOPE( qci              , :: qci);
@@ -17,10 +17,17 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   YAKL_SCOPE( micro_field      , :: micro_field);
   YAKL_SCOPE( ncrms            , :: ncrms);
   YAKL_SCOPE( crm_accel_factor , :: crm_accel_factor);
+  YAKL_SCOPE( crm_accel_adaptive , :: crm_accel_adaptive);
+  YAKL_SCOPE( crm_accel_deficit  , :: crm_accel_deficit);
+  YAKL_SCOPE( crm_output_accel_factor , :: crm_output_accel_factor);
 
   real ttend_threshold = 5.0;  // 5K, following UP-CAM implementation
   real tmin = 50.0;  // should never get below 50K in crm, following UP-CAM implementation
   int idx_qt = index_water_vapor;
+  // accelerate_crm is called once per subcycle; the factor applied in each
+  // call covers dtn, so it enters the time-mean output factor with weight dtn/dt
+  real dtn_acc = dtn;
+  real subcycle_wgt = dtn/dt;
 
   real2d ubaccel("ubaccel", nzm, ncrms);
   real2d vbaccel("vbaccel", nzm, ncrms);
@@ -32,6 +39,8 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   real2d vtend_acc("vtend_acc", nzm, ncrms);
   real2d qpoz("qpoz", nzm, ncrms);
   real2d qneg("qneg", nzm, ncrms);
+  real1d ttend_max("ttend_max", ncrms);
+  real1d accel_fac("accel_fac", ncrms);
 
   // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   // Compute the average among horizontal columns for each variable
@@ -77,7 +86,7 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
       utend_acc(k,icrm) = ubaccel(k,icrm) - u0(k,icrm);
       vtend_acc(k,icrm) = vbaccel(k,icrm) - v0(k,icrm);
     }
-    if (abs(ttend_acc(k,icrm)) > ttend_threshold) {
+    if (!crm_accel_adaptive && abs(ttend_acc(k,icrm)) > ttend_threshold) {
       ceaseflag_liveout = true;
     }
   });
@@ -109,6 +118,44 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
     return;
   }
 
+  //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+  //!! Choose the acceleration factor for each CRM
+  //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+  if (crm_accel_adaptive) {
+    // Rather than ceasing MSA everywhere once any CRM exceeds the threshold,
+    // limit the factor in each CRM so that the accelerated change of the
+    // mean temperature stays below ttend_threshold. Whatever is given up is
+    // kept in crm_accel_deficit, as model time in seconds, and paid back on
+    // later, quieter steps (at most twice the nominal factor per step). The
+    // deficit is part of the CRM state, so what cannot be paid back within
+    // this GCM step is carried over to the next one.
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      ttend_max(icrm) = 0.0;
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //  for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_DEVICE_LAMBDA (int k, int icrm) {
+      yakl::atomicMax( ttend_max(icrm) , abs(ttend_acc(k,icrm)) );
+    });
+
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      real fac = min( crm_accel_factor + crm_accel_deficit(icrm)/dtn_acc , 2.0*crm_accel_factor );
+      if (fac * ttend_max(icrm) > ttend_threshold) {
+        fac = ttend_threshold / ttend_max(icrm);
+      }
+      crm_accel_deficit(icrm) = crm_accel_deficit(icrm) + (crm_accel_factor - fac)*dtn_acc;
+      accel_fac(icrm) = fac;
+      crm_output_accel_factor(icrm) = crm_output_accel_factor(icrm) + fac*subcycle_wgt;
+    });
+  } else {
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      accel_fac(icrm) = crm_accel_factor;
+      crm_output_accel_factor(icrm) = crm_output_accel_factor(icrm) + crm_accel_factor*subcycle_wgt;
+    });
+  }
+
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
   //!! Apply the accelerated tendencies
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -119,13 +166,13 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     // don't let T go negative!
-    t(k,j+offy_s,i+offx_s,icrm) = max(tmin, t(k,j+offy_s,i+offx_s,icrm) + crm_accel_factor * ttend_acc(k,icrm));
+    t(k,j+offy_s,i+offx_s,icrm) = max(tmin, t(k,j+offy_s,i+offx_s,icrm) + accel_fac(icrm) * ttend_acc(k,icrm));
     if (crm_accel_uv) {
-      u(k,j+offy_u,i+offx_u,icrm) = u(k,j+offy_u,i+offx_u,icrm) + crm_accel_factor * utend_acc(k,icrm); 
-      v(k,j+offy_v,i+offx_v,icrm) = v(k,j+offy_v,i+offx_v,icrm) + crm_accel_factor * vtend_acc(k,icrm); 
+      u(k,j+offy_u,i+offx_u,icrm) = u(k,j+offy_u,i+offx_u,icrm) + accel_fac(icrm) * utend_acc(k,icrm); 
+      v(k,j+offy_v,i+offx_v,icrm) = v(k,j+offy_v,i+offx_v,icrm) + accel_fac(icrm) * vtend_acc(k,icrm); 
     }
     micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = 
-        micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) + crm_accel_factor * qtend_acc(k,icrm);
+        micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) + accel_fac(icrm) * qtend_acc(k,icrm);
   });
 
   //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -146,10 +193,10 @@ void accelerate_crm(int nstep, int nstop, bool &ceaseflag) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
     if (micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) < 0.0) {
-      yakl::atomicAdd( qneg(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) ); 
+      yakl::atomicAdd( qneg(k,icrm) , (real) micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) ); 
     }
     else {
-      yakl::atomicAdd( qpoz(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
+      yakl::atomicAdd( qpoz(k,icrm) , (real) micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
     }
   });
 
@@ -18,9 +18,16 @@ void advect_all_scalars() {
   advect_scalar(t,dummy,dummy);
 
   // Advection of microphysics prognostics:
-  for (int k=0; k<nmicro_fields; k++) {
-    if ( k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1) ) {
-      advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
+  if (use_crm_fused_advect) {
+    // advect all active microphysics fields in a single fused sweep
+    if (nmicro_prognostic > 0) {
+      advect_scalar(micro_field,micro_prognostic_ind,nmicro_prognostic,mkadv,mkwle);
+    }
+  } else {
+    for (int k=0; k<nmicro_fields; k++) {
+      if (micro_field_is_prognostic(k)) {
+        advect_scalar(micro_field,k,mkadv,k,mkwle,k);  
+      }
     }
   }
 
@@ -1,6 +1,6 @@
 #include "advect_scalar.h"
 
-void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
+void advect_scalar(crmReal4d &f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms , ::ncrms);
 
   real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
@@ -48,7 +48,7 @@ void advect_scalar(real4d &f, real2d &fadv, real2d &flux) {
 
 }
 
-void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
+void advect_scalar(crmReal5d &f, int ind_f, real2d &fadv, real2d &flux) {
   YAKL_SCOPE( ncrms         , :: ncrms);
 
   real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
@@ -96,7 +96,7 @@ void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux) {
 
 }
 
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux) {
+void advect_scalar(crmReal5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux) {
   YAKL_SCOPE( ncrms         , :: ncrms);
 
   real4d f0("f0", nzm, dimy_s, dimx_s, ncrms);
@@ -142,3 +142,64 @@ void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flu
   }  
 
 }
+
+// Fused multi-field version: advects the fields ind_f(0:nfld-1) of f together.
+// fadv and flux are indexed with the same field index as f.
+void advect_scalar(crmReal5d &f, int1d &ind_f, int nfld, real3d &fadv, real3d &flux) {
+  YAKL_SCOPE( ncrms         , :: ncrms);
+
+  // for (int l=0; l<nfld; l++) {
+  //   for (int k=0; k<nzm; k++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  if (docolumn) {
+    parallel_for( SimpleBounds<3>(nfld,nz,ncrms) , YAKL_LAMBDA (int l, int k, int icrm) {
+      flux(ind_f(l),k,icrm) = 0.0;
+    });
+
+  } else {
+
+    // The fields are advected fused_advect_chunk at a time, so the scratch
+    // arrays of the fused kernels do not grow with the number of tracers
+    int nchunk = min(nfld,fused_advect_chunk);
+    real5d f0("f0", nchunk, nzm, dimy_s, dimx_s, ncrms);
+
+    for (int l0=0; l0<nfld; l0+=nchunk) {
+      int nl = min(nchunk,nfld-l0);
+
+      // for (int l=0; l<nl; l++) {
+      //   for (int k=0; k<nzm; k++) {
+      //     for (int j=0; j<dimy_s; j++) {
+      //       for (int i=0; i<dimx_s; i++) {
+      //         for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<5>(nl,nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int l, int k, int j, int i, int icrm) {
+        f0(l,k,j,i,icrm) = f(ind_f(l0+l),k,j,i,icrm);
+      });
+
+      if(RUN3D) {
+        advect_scalar3D(f,ind_f,l0,nl,flux);
+      } else {
+        advect_scalar2D(f,ind_f,l0,nl,flux);
+      }
+
+      // for (int l=0; l<nl; l++) {
+      //   for (int k=0; k<nzm; k++) {
+      //     for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<3>(nl,nzm,ncrms) , YAKL_LAMBDA (int l, int k, int icrm) {
+        fadv(ind_f(l0+l),k,icrm)=0.0;
+      });
+
+      // for (int l=0; l<nl; l++) {
+      //   for (int k=0; k<nzm; k++) {
+      //     for (int j=0; j<ny; j++) {
+      //       for (int i=0; i<nx; i++) {
+      //         for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<5>(nl,nzm,ny,nx,ncrms) , YAKL_DEVICE_LAMBDA (int l, int k, int j, int i, int icrm) {
+        int n = ind_f(l0+l);
+        real tmp = f(n,k,j+offy_s,i+offx_s,icrm)-f0(l,k,j+offy_s,i+offx_s,icrm);
+        yakl::atomicAdd(fadv(n,k,icrm),tmp);
+      });
+    }
+
+  }
+
+}
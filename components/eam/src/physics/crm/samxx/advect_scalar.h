@@ -6,9 +6,14 @@
 #include "advect_scalar2D.h"
 #include "advect_scalar3D.h"
 
-void advect_scalar(real4d &f, real2d &fadv, real2d &flux);
+// Number of fields the fused multi-field advection sweeps at once; bounds the
+// size of its scratch arrays independently of the number of tracers
+int constexpr fused_advect_chunk = 4;
 
-void advect_scalar(real5d &f, int ind_f, real2d &fadv, real2d &flux);
+void advect_scalar(crmReal4d &f, real2d &fadv, real2d &flux);
 
-void advect_scalar(real5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
+void advect_scalar(crmReal5d &f, int ind_f, real2d &fadv, real2d &flux);
 
+void advect_scalar(crmReal5d &f, int ind_f, real3d &fadv, int ind_fadv, real3d &flux, int ind_flux);
+
+void advect_scalar(crmReal5d &f, int1d &ind_f, int nfld, real3d &fadv, real3d &flux);
@@ -1,6 +1,6 @@
 #include "advect_scalar2D.h"
 
-void advect_scalar2D(real4d &f, real2d &flux) {
+void advect_scalar2D(crmReal4d &f, real2d &flux) {
   YAKL_SCOPE( dowallx       , :: dowallx);
   YAKL_SCOPE( rank          , :: rank);
   YAKL_SCOPE( u             , :: u);
@@ -17,10 +17,10 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j        = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
+  crmReal4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
+  crmReal4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
+  crmReal4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
+  crmReal4d www  ("www"  ,nz,1,nx+4,ncrms);
   real2d iadz ("iadz" ,nzm,ncrms);
   real2d irho ("irho" ,nzm,ncrms);
   real2d irhow("irhow",nzm,ncrms);
@@ -96,7 +96,7 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int i, int icrm) {
     if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(k,icrm),(real) www(k,j,i,icrm));
     }
     f(k,j,i+offx_s-2,icrm) = f(k,j,i+offx_s-2,icrm) - (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
                                                       (www(k+1,j,i,icrm)-www(k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
@@ -173,7 +173,7 @@ void advect_scalar2D(real4d &f, real2d &flux) {
         www(k,j,i+offx_www,icrm) =
             pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
             pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
-        yakl::atomicAdd(flux(k,icrm), www(k,j,i+offx_www,icrm));
+        yakl::atomicAdd(flux(k,icrm), (real) www(k,j,i+offx_www,icrm));
       }
     });
   } // nonos
@@ -195,7 +195,7 @@ void advect_scalar2D(real4d &f, real2d &flux) {
 
 
 
-void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
+void advect_scalar2D(crmReal5d &f, int ind_f, real2d &flux) {
   YAKL_SCOPE( dowallx       , :: dowallx);
   YAKL_SCOPE( rank          , :: rank);
   YAKL_SCOPE( u             , :: u);
@@ -212,10 +212,10 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
+  crmReal4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
+  crmReal4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
+  crmReal4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
+  crmReal4d www  ("www"  ,nz,1,nx+4,ncrms);
   real2d iadz ("iadz" ,nzm,ncrms);
   real2d irho ("irho" ,nzm,ncrms);
   real2d irhow("irhow",nzm,ncrms);
@@ -292,7 +292,7 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int i, int icrm) {
     if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(k,icrm),(real) www(k,j,i,icrm));
     }
     f(ind_f,k,j,i+offx_s-2,icrm) = f(ind_f,k,j,i+offx_s-2,icrm) -
                                    (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
@@ -371,7 +371,7 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
         www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
                          pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
 
-        yakl::atomicAdd(flux(k,icrm), www(k,j,i+offx_www,icrm));
+        yakl::atomicAdd(flux(k,icrm), (real) www(k,j,i+offx_www,icrm));
       }
     });
   } // nonos
@@ -391,7 +391,7 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
 
 }
 
-void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
+void advect_scalar2D(crmReal5d &f, int ind_f, real3d &flux, int ind_flux) {
   YAKL_SCOPE( dowallx       , :: dowallx);
   YAKL_SCOPE( rank          , :: rank);
   YAKL_SCOPE( u             , :: u);
@@ -408,10 +408,10 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
+  crmReal4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
+  crmReal4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
+  crmReal4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
+  crmReal4d www  ("www"  ,nz,1,nx+4,ncrms);
   real2d iadz ("iadz" ,nzm,ncrms);
   real2d irho ("irho" ,nzm,ncrms);
   real2d irhow("irhow",nzm,ncrms);
@@ -452,10 +452,10 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm)))));
+      mx(k,j,i,icrm)=nbr_max2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,ic+offx_s-1,icrm),f(ind_f,kb,j,i+offx_s-1,icrm),
+                              f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm));
+      mn(k,j,i,icrm)=nbr_min2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,ic+offx_s-1,icrm),f(ind_f,kb,j,i+offx_s-1,icrm),
+                              f(ind_f,kc,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm));
     });
   }// nonos
 
@@ -464,10 +464,9 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
     int kb=max(0,k-1);
-    uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i-1+offx_s-2,icrm)+
-                    min(0.0,u(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+    uuu(k,j,i,icrm)=upwind2(u(k,j,i,icrm),f(ind_f,k,j,i-1+offx_s-2,icrm),f(ind_f,k,j,i+offx_s-2,icrm));
     if (i <= nx+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j,i+offx_s-2,icrm)+min(0.0,w(k,j,i,icrm))*f(ind_f,k,j,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=upwind2(w(k,j,i,icrm),f(ind_f,kb,j,i+offx_s-2,icrm),f(ind_f,k,j,i+offx_s-2,icrm));
     }
     if (i == 1) {
       flux(ind_flux,k,icrm) = 0.0;
@@ -488,10 +487,10 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   //    for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int i, int icrm) {
     if (i >= 2 && i <= nx+1) {
-      yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(ind_flux,k,icrm),(real) www(k,j,i,icrm));
     }
-    f(ind_f,k,j,i+offx_s-2,icrm) = f(ind_f,k,j,i+offx_s-2,icrm) - (uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                   (www(k+1,j,i,icrm)-www(k,j,i,icrm))*iadz(k,icrm))*irho(k,icrm);
+    f(ind_f,k,j,i+offx_s-2,icrm) = f(ind_f,k,j,i+offx_s-2,icrm) - flux_div2(uuu(k,j,i,icrm),uuu(k,j,i+1,icrm),
+                                   www(k,j,i,icrm),www(k+1,j,i,icrm),iadz(k,icrm),irho(k,icrm));
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -503,19 +502,19 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     real dd=2.0/(kc-kb)/adz(k,icrm);
     int ib=i-1;
     uuu(k,j,i+offx_uuu-1,icrm) = 
-         andiff2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm)) - 
-         across2(dd*(f(ind_f,kc,j,ib+offx_s-1,icrm)+f(ind_f,kc,j,i+offx_s-1,icrm)-
-                 f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
-                 u(k,j,i+offx_u-1,icrm), w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+
-                 w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm)) *irho(k,icrm);
+         antidiff2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),u(k,j,i+offx_u-1,icrm),irho(k,icrm),
+                   dd*(f(ind_f,kc,j,ib+offx_s-1,icrm)+f(ind_f,kc,j,i+offx_s-1,icrm)-
+                       f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,kb,j,i+offx_s-1,icrm)),
+                   w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm),
+                   irho(k,icrm));
     if (i <= nxp1) {
       int ic=i+1;
       www(k,j,i+offx_www-1,icrm) = 
-         andiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm)) - 
-         across2(f(ind_f,kb,j,ic+offx_s-1,icrm)+f(ind_f,k,j,ic+offx_s-1,icrm)-
-                 f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,k,j,ib+offx_s-1,icrm),
-                 w(k,j,i+offx_w-1,icrm), u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+
-                 u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm)) *irho(k,icrm);
+         antidiff2(f(ind_f,kb,j,i+offx_s-1,icrm),f(ind_f,k,j,i+offx_s-1,icrm),w(k,j,i+offx_w-1,icrm),irhow(k,icrm),
+                   f(ind_f,kb,j,ic+offx_s-1,icrm)+f(ind_f,k,j,ic+offx_s-1,icrm)-
+                   f(ind_f,kb,j,ib+offx_s-1,icrm)-f(ind_f,k,j,ib+offx_s-1,icrm),
+                   u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm),
+                   irho(k,icrm));
     }
   });
 
@@ -534,10 +533,10 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int kb=max(0,k-1);
       int ib=i-1;
       int ic=i+1;
-      mx(k,j,i,icrm)=max(f(ind_f,k,j,ib+offx_s-1,icrm),max(f(ind_f,k,j,ic+offx_s-1,icrm),max(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     max(f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm))))));
-      mn(k,j,i,icrm)=min(f(ind_f,k,j,ib+offx_s-1,icrm),min(f(ind_f,k,j,ic+offx_s-1,icrm),min(f(ind_f,kb,j,i+offx_s-1,icrm),
-                     min(f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm))))));
+      mx(k,j,i,icrm)=nbr_max2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,ic+offx_s-1,icrm),f(ind_f,kb,j,i+offx_s-1,icrm),
+                              f(ind_f,kc,j,i+offx_s-1,icrm),max(f(ind_f,k,j,i+offx_s-1,icrm),mx(k,j,i,icrm)));
+      mn(k,j,i,icrm)=nbr_min2(f(ind_f,k,j,ib+offx_s-1,icrm),f(ind_f,k,j,ic+offx_s-1,icrm),f(ind_f,kb,j,i+offx_s-1,icrm),
+                              f(ind_f,kc,j,i+offx_s-1,icrm),min(f(ind_f,k,j,i+offx_s-1,icrm),mn(k,j,i,icrm)));
     });
 
     // for (int k=0; k<nzm; k++) {
@@ -546,12 +545,12 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int kc=min(nzm-1,k+1);
       int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm))/(pn2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pp2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pn2(www(kc,j,i+offx_www-1,icrm)) +
-                     pp2(www(k,j,i+offx_www-1,icrm)))+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm))/(pp2(uuu(k,j,ic+offx_uuu-1,icrm)) +
-                     pn2(uuu(k,j,i+offx_uuu-1,icrm))+iadz(k,icrm)*(pp2(www(kc,j,i+offx_www-1,icrm)) +
-                     pn2(www(k,j,i+offx_www-1,icrm)))+eps);
+      mx(k,j,i,icrm)=nonos_in2(rho(k,icrm),mx(k,j,i,icrm)-f(ind_f,k,j,i+offx_s-1,icrm),
+                               uuu(k,j,i+offx_uuu-1,icrm),uuu(k,j,ic+offx_uuu-1,icrm),
+                               www(k,j,i+offx_www-1,icrm),www(kc,j,i+offx_www-1,icrm),iadz(k,icrm),eps);
+      mn(k,j,i,icrm)=nonos_out2(rho(k,icrm),f(ind_f,k,j,i+offx_s-1,icrm)-mn(k,j,i,icrm),
+                                uuu(k,j,i+offx_uuu-1,icrm),uuu(k,j,ic+offx_uuu-1,icrm),
+                                www(k,j,i+offx_www-1,icrm),www(kc,j,i+offx_www-1,icrm),iadz(k,icrm),eps);
     });
 
     // for (int k=0; k<nzm; k++) {
@@ -559,14 +558,14 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     //    for (int icrm=0; icrm<ncrms; icrm++) {
     parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_DEVICE_LAMBDA (int k, int i, int icrm) {
       int ib=i-1;
-      uuu(k,j,i+offx_uuu,icrm)= pp2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(k,j,ib+offx_m,icrm))) -
-                                pn2(uuu(k,j,i+offx_uuu,icrm))*min(1.0,min(mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+      uuu(k,j,i+offx_uuu,icrm)=limit2(uuu(k,j,i+offx_uuu,icrm),mx(k,j,i+offx_m,icrm),mn(k,j,ib+offx_m,icrm),
+                                      mx(k,j,ib+offx_m,icrm),mn(k,j,i+offx_m,icrm));
       if (i <= nx-1) {
         int kb=max(0,k-1);
-        www(k,j,i+offx_www,icrm)= pp2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(k,j,i+offx_m,icrm), mn(kb,j,i+offx_m,icrm))) -
-                                  pn2(www(k,j,i+offx_www,icrm))*min(1.0,min(mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm)));
+        www(k,j,i+offx_www,icrm)=limit2(www(k,j,i+offx_www,icrm),mx(k,j,i+offx_m,icrm),mn(kb,j,i+offx_m,icrm),
+                                        mx(kb,j,i+offx_m,icrm),mn(k,j,i+offx_m,icrm));
 
-        yakl::atomicAdd(flux(ind_flux,k,icrm), www(k,j,i+offx_www,icrm));
+        yakl::atomicAdd(flux(ind_flux,k,icrm), (real) www(k,j,i+offx_www,icrm));
       }
     });
   } // nonos
@@ -575,13 +574,251 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
-    int kc=k+1;
     // MK: added fix for very small negative values (relative to positive values)
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) - (uuu(k,j,i+1+offx_uuu,icrm)-uuu(k,j,i+offx_uuu,icrm) +
-                                (www(k+1,j,i+offx_www,icrm)-www(k,j,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
+    f(ind_f,k,j,i+offx_s,icrm)= max(0.0, f(ind_f,k,j,i+offx_s,icrm) -
+                                flux_div2(uuu(k,j,i+offx_uuu,icrm),uuu(k,j,i+1+offx_uuu,icrm),
+                                          www(k,j,i+offx_www,icrm),www(k+1,j,i+offx_www,icrm),iadz(k,icrm),irho(k,icrm)));
+  });
+
+}
+
+// Fused multi-field version: advects the fields ind_f(l0:l0+nfld-1) of f in one
+// sweep. Each thread loads the velocities, density and grid factors of its point
+// once and applies them to all the fields. flux is indexed with the same field
+// index as f.
+void advect_scalar2D(crmReal5d &f, int1d &ind_f, int l0, int nfld, real3d &flux) {
+  YAKL_SCOPE( dowallx       , :: dowallx);
+  YAKL_SCOPE( rank          , :: rank);
+  YAKL_SCOPE( u             , :: u);
+  YAKL_SCOPE( w             , :: w);
+  YAKL_SCOPE( rho           , :: rho);
+  YAKL_SCOPE( adz           , :: adz);
+  YAKL_SCOPE( rhow          , :: rhow);
+  YAKL_SCOPE( ncrms         , :: ncrms);
+
+  bool constexpr nonos = true;
+  real constexpr eps = 1.0e-10;
+  int  constexpr offx_m = 1;
+  int  constexpr offx_uuu = 2;
+  int  constexpr offx_www = 2;
+  int  constexpr j = 0;
+
+  crmReal5d mx   ("mx"   ,nfld,nzm,1,nx+2,ncrms);
+  crmReal5d mn   ("mn"   ,nfld,nzm,1,nx+2,ncrms);
+  crmReal5d uuu  ("uuu"  ,nfld,nzm,1,nx+5,ncrms);
+  crmReal5d www  ("www"  ,nfld,nz,1,nx+4,ncrms);
+  real2d iadz ("iadz" ,nzm,ncrms);
+  real2d irho ("irho" ,nzm,ncrms);
+  real2d irhow("irhow",nzm,ncrms);
+
+  // for (int i=0; i<nx+4; i++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      www(l,nz-1,j,i,icrm)=0.0;
+    }
+  });
+
+  if (dowallx) {
+    if (rank%nsubdomains_x == 0) {
+      // for (int k=0; k<nzm; k++) {
+      //  for (int i=0; i<1-dimx1_u+1; i++) {
+      //    for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+        u(k,j,i,icrm) = 0.0;
+      });
+    }
+    if (rank%nsubdomains_x==nsubdomains_x-1) {
+      // for (int k=0; k<nzm; k++) {
+      //  for (int i=0; i<dimx2_u-(nx+1)+1; i++) {
+      //    for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+        int iInd = i+ (nx+2);
+        u(k,j,iInd,icrm) = 0.0;
+      });
+    }
+  }
+
+  if (nonos) {
+    // for (int k=0; k<nzm; k++) {
+    //  for (int i=0; i<nx+2; i++) {
+    //    for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      int ib=i-1;
+      int ic=i+1;
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        mx(l,k,j,i,icrm)=nbr_max2(f(n,k,j,ib+offx_s-1,icrm),f(n,k,j,ic+offx_s-1,icrm),f(n,kb,j,i+offx_s-1,icrm),
+                                  f(n,kc,j,i+offx_s-1,icrm),f(n,k,j,i+offx_s-1,icrm));
+        mn(l,k,j,i,icrm)=nbr_min2(f(n,k,j,ib+offx_s-1,icrm),f(n,k,j,ic+offx_s-1,icrm),f(n,kb,j,i+offx_s-1,icrm),
+                                  f(n,kc,j,i+offx_s-1,icrm),f(n,k,j,i+offx_s-1,icrm));
+      }
+    });
+  }// nonos
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx+5; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx+5,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    int kb=max(0,k-1);
+    crm_real uu = u(k,j,i,icrm);
+    crm_real ww = 0.0;
+    if (i <= nx+3) {
+      ww = w(k,j,i,icrm);
+    }
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      uuu(l,k,j,i,icrm)=upwind2(uu,f(n,k,j,i-1+offx_s-2,icrm),f(n,k,j,i+offx_s-2,icrm));
+      if (i <= nx+3) {
+        www(l,k,j,i,icrm)=upwind2(ww,f(n,kb,j,i+offx_s-2,icrm),f(n,k,j,i+offx_s-2,icrm));
+      }
+      if (i == 1) {
+        flux(n,k,icrm) = 0.0;
+      }
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    irho(k,icrm) = 1.0/rho(k,icrm);
+    iadz(k,icrm) = 1.0/adz(k,icrm);
+    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx+4; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int i, int icrm) {
+    real iadz_k = iadz(k,icrm);
+    real irho_k = irho(k,icrm);
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      if (i >= 2 && i <= nx+1) {
+        yakl::atomicAdd(flux(n,k,icrm),(real) www(l,k,j,i,icrm));
+      }
+      f(n,k,j,i+offx_s-2,icrm) = f(n,k,j,i+offx_s-2,icrm) - flux_div2(uuu(l,k,j,i,icrm),uuu(l,k,j,i+1,icrm),
+                                 www(l,k,j,i,icrm),www(l,k+1,j,i,icrm),iadz_k,irho_k);
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int i=0; i<nx+3; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx+3,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    int kc=min(nzm-1,k+1);
+    int kb=max(0,k-1);
+    real dd=2.0/(kc-kb)/adz(k,icrm);
+    int ib=i-1;
+    int ic=i+1;
+    real irho_k  = irho(k,icrm);
+    real irhow_k = irhow(k,icrm);
+    crm_real uu   = u(k,j,i+offx_u-1,icrm);
+    crm_real wsum = w(k,j,ib+offx_w-1,icrm)+w(kc,j,ib+offx_w-1,icrm)+w(k,j,i+offx_w-1,icrm)+w(kc,j,i+offx_w-1,icrm);
+    crm_real ww   = 0.0;
+    crm_real usum = 0.0;
+    if (i <= nxp1) {
+      ww   = w(k,j,i+offx_w-1,icrm);
+      usum = u(kb,j,i+offx_u-1,icrm)+u(k,j,i+offx_u-1,icrm)+u(k,j,ic+offx_u-1,icrm)+u(kb,j,ic+offx_u-1,icrm);
+    }
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      uuu(l,k,j,i+offx_uuu-1,icrm) =
+           antidiff2(f(n,k,j,ib+offx_s-1,icrm),f(n,k,j,i+offx_s-1,icrm),uu,irho_k,
+                     dd*(f(n,kc,j,ib+offx_s-1,icrm)+f(n,kc,j,i+offx_s-1,icrm)-
+                         f(n,kb,j,ib+offx_s-1,icrm)-f(n,kb,j,i+offx_s-1,icrm)),wsum,irho_k);
+      if (i <= nxp1) {
+        www(l,k,j,i+offx_www-1,icrm) =
+           antidiff2(f(n,kb,j,i+offx_s-1,icrm),f(n,k,j,i+offx_s-1,icrm),ww,irhow_k,
+                     f(n,kb,j,ic+offx_s-1,icrm)+f(n,k,j,ic+offx_s-1,icrm)-
+                     f(n,kb,j,ib+offx_s-1,icrm)-f(n,k,j,ib+offx_s-1,icrm),usum,irho_k);
+      }
+    }
+  });
+
+  //  for (int i=0; i<nx+4; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nx+4,ncrms) , YAKL_LAMBDA (int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      www(l,0,j,i,icrm) = 0.0;
+    }
+  });
+
+  if (nonos) {
+    // for (int k=0; k<nzm; k++) {
+    //  for (int i=0; i<nx+2; i++) {
+    //    for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      int ib=i-1;
+      int ic=i+1;
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        mx(l,k,j,i,icrm)=nbr_max2(f(n,k,j,ib+offx_s-1,icrm),f(n,k,j,ic+offx_s-1,icrm),f(n,kb,j,i+offx_s-1,icrm),
+                                  f(n,kc,j,i+offx_s-1,icrm),max(f(n,k,j,i+offx_s-1,icrm),mx(l,k,j,i,icrm)));
+        mn(l,k,j,i,icrm)=nbr_min2(f(n,k,j,ib+offx_s-1,icrm),f(n,k,j,ic+offx_s-1,icrm),f(n,kb,j,i+offx_s-1,icrm),
+                                  f(n,kc,j,i+offx_s-1,icrm),min(f(n,k,j,i+offx_s-1,icrm),mn(l,k,j,i,icrm)));
+      }
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //  for (int i=0; i<nx+2; i++) {
+    //    for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(nzm,nx+2,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int ic=i+1;
+      real rho_k  = rho(k,icrm);
+      real iadz_k = iadz(k,icrm);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        mx(l,k,j,i,icrm)=nonos_in2(rho_k,mx(l,k,j,i,icrm)-f(n,k,j,i+offx_s-1,icrm),
+                                   uuu(l,k,j,i+offx_uuu-1,icrm),uuu(l,k,j,ic+offx_uuu-1,icrm),
+                                   www(l,k,j,i+offx_www-1,icrm),www(l,kc,j,i+offx_www-1,icrm),iadz_k,eps);
+        mn(l,k,j,i,icrm)=nonos_out2(rho_k,f(n,k,j,i+offx_s-1,icrm)-mn(l,k,j,i,icrm),
+                                    uuu(l,k,j,i+offx_uuu-1,icrm),uuu(l,k,j,ic+offx_uuu-1,icrm),
+                                    www(l,k,j,i+offx_www-1,icrm),www(l,kc,j,i+offx_www-1,icrm),iadz_k,eps);
+      }
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //  for (int i=0; i<nx+1; i++) {
+    //    for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<3>(nzm,nx+1,ncrms) , YAKL_DEVICE_LAMBDA (int k, int i, int icrm) {
+      int ib=i-1;
+      int kb=max(0,k-1);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        uuu(l,k,j,i+offx_uuu,icrm)=limit2(uuu(l,k,j,i+offx_uuu,icrm),mx(l,k,j,i+offx_m,icrm),mn(l,k,j,ib+offx_m,icrm),
+                                          mx(l,k,j,ib+offx_m,icrm),mn(l,k,j,i+offx_m,icrm));
+        if (i <= nx-1) {
+          www(l,k,j,i+offx_www,icrm)=limit2(www(l,k,j,i+offx_www,icrm),mx(l,k,j,i+offx_m,icrm),mn(l,kb,j,i+offx_m,icrm),
+                                            mx(l,kb,j,i+offx_m,icrm),mn(l,k,j,i+offx_m,icrm));
+
+          yakl::atomicAdd(flux(n,k,icrm), (real) www(l,k,j,i+offx_www,icrm));
+        }
+      }
+    });
+  } // nonos
+
+  // for (int k=0; k<nzm; k++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
+    real iadz_k = iadz(k,icrm);
+    real irho_k = irho(k,icrm);
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      // MK: fix for very small negative values from truncation error, as in the per-field version
+      f(n,k,j,i+offx_s,icrm)= max(0.0, f(n,k,j,i+offx_s,icrm) -
+                                  flux_div2(uuu(l,k,j,i+offx_uuu,icrm),uuu(l,k,j,i+1+offx_uuu,icrm),
+                                            www(l,k,j,i+offx_www,icrm),www(l,k+1,j,i+offx_www,icrm),iadz_k,irho_k));
+    }
   });
 
 }
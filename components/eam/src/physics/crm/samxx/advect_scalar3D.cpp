@@ -1,6 +1,6 @@
 #include "advect_scalar3D.h"
 
-void advect_scalar3D(real4d &f, real2d &flux) {
+void advect_scalar3D(crmReal4d &f, real2d &flux) {
   YAKL_SCOPE( dowallx , ::dowallx);
   YAKL_SCOPE( dowally , ::dowally);
   YAKL_SCOPE( rank    , ::rank);
@@ -23,11 +23,11 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
+  crmReal4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
+  crmReal4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
+  crmReal4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  crmReal4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  crmReal4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
   real2d iadz ("iadz" ,nzm,ncrms);
   real2d irho ("irho" ,nzm,ncrms);
   real2d irhow("irhow",nzm,ncrms);
@@ -144,7 +144,7 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
     if (i >= 2 && i <= nx+1 && j >= 2 && j <= ny+1) {
-      yakl::atomicAdd(flux(k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(k,icrm),(real) www(k,j,i,icrm));
     }
     f(k,j+offy_s-2,i+offy_s-2,icrm)=f(k,j+offy_s-2,i+offx_s-2,icrm)-( uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
                                     vvv(k,j+1,i,icrm)-vvv(k,j,i,icrm)
@@ -274,7 +274,7 @@ void advect_scalar3D(real4d &f, real2d &flux) {
         www(k,j+offy_www,i+offx_www,icrm) =
               pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(kb,j+offy_m,i+offx_m,icrm)))
              -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
-        yakl::atomicAdd(flux(k,icrm),www(k,j+offy_www,i+offx_www,icrm));
+        yakl::atomicAdd(flux(k,icrm),(real) www(k,j+offy_www,i+offx_www,icrm));
       }
     });
   }
@@ -297,7 +297,7 @@ void advect_scalar3D(real4d &f, real2d &flux) {
 
 }
 
-void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
+void advect_scalar3D(crmReal5d &f, int ind_f, real2d &flux) {
   YAKL_SCOPE( dowallx , ::dowallx);
   YAKL_SCOPE( dowally , ::dowally);
   YAKL_SCOPE( rank    , ::rank);
@@ -320,11 +320,11 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
+  crmReal4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
+  crmReal4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
+  crmReal4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  crmReal4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  crmReal4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
   real2d iadz ("iadz" ,nzm,ncrms);
   real2d irho ("irho" ,nzm,ncrms);
   real2d irhow("irhow",nzm,ncrms);
@@ -441,7 +441,7 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
     if (i >= 2 && i <= nx+1 && j >= 2 && j <= ny+1) {
-      yakl::atomicAdd(flux(k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(k,icrm),(real) www(k,j,i,icrm));
     }
     f(ind_f,k,j+offy_s-2,i+offy_s-2,icrm)=f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm)-( uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
                                     vvv(k,j+1,i,icrm)-vvv(k,j,i,icrm)
@@ -571,7 +571,7 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
         www(k,j+offy_www,i+offx_www,icrm) =
               pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), mn(kb,j+offy_m,i+offx_m,icrm)))
              -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm)));
-        yakl::atomicAdd(flux(k,icrm),www(k,j+offy_www,i+offx_www,icrm));
+        yakl::atomicAdd(flux(k,icrm),(real) www(k,j+offy_www,i+offx_www,icrm));
       }
     });
   }
@@ -594,7 +594,7 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
 
 }
 
-void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
+void advect_scalar3D(crmReal5d &f, int ind_f, real3d &flux, int ind_flux) {
   YAKL_SCOPE( dowallx , ::dowallx);
   YAKL_SCOPE( dowally , ::dowally);
   YAKL_SCOPE( rank    , ::rank);
@@ -617,11 +617,11 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
+  crmReal4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
+  crmReal4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
+  crmReal4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
+  crmReal4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
+  crmReal4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
   real2d iadz ("iadz" ,nzm,ncrms);
   real2d irho ("irho" ,nzm,ncrms);
   real2d irhow("irhow",nzm,ncrms);
@@ -691,15 +691,15 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int ib=i-1;
       int ic=i+1;
       mx(k,j,i,icrm) = 
-           max(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-           max(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
-           max(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-                                                          f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)))))));
+           nbr_max3(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
+                    f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
+                    f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
+                    f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm));
       mn(k,j,i,icrm) = 
-           min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-           min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
-           min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-                                                          f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)))))));
+           nbr_min3(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
+                    f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
+                    f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
+                    f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm));
     });
   } 
 
@@ -710,16 +710,13 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int kb=max(0,k-1);
     if (j <= ny+3){
-      uuu(k,j,i,icrm)=max(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm)+
-                      min(0.0,u(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      uuu(k,j,i,icrm)=upwind3(u(k,j,i,icrm),f(ind_f,k,j+offy_s-2,i-1+offx_s-2,icrm),f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm));
     }
     if (i <= nx+3) {
-      vvv(k,j,i,icrm)=max(0.0,v(k,j,i,icrm))*f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,v(k,j,i,icrm))*f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm);
+      vvv(k,j,i,icrm)=upwind3(v(k,j,i,icrm),f(ind_f,k,j-1+offy_s-2,i+offx_s-2,icrm),f(ind_f,k,j+offx_s-2,i+offy_s-2,icrm));
     }
     if (i <= nx+3 && j <= ny+3) {
-      www(k,j,i,icrm)=max(0.0,w(k,j,i,icrm))*f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm)+
-                      min(0.0,w(k,j,i,icrm))*f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm);
+      www(k,j,i,icrm)=upwind3(w(k,j,i,icrm),f(ind_f,kb,j+offy_s-2,i+offx_s-2,icrm),f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm));
     }
     if (i == 0 && j == 0) {
       flux(ind_flux,k,icrm) = 0.0;
@@ -740,11 +737,11 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
     if (i >= 2 && i <= nx+1 && j >= 2 && j <= ny+1) {
-      yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j,i,icrm));
+      yakl::atomicAdd(flux(ind_flux,k,icrm),(real) www(k,j,i,icrm));
     }
-    f(ind_f,k,j+offy_s-2,i+offy_s-2,icrm)=f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm)-( uuu(k,j,i+1,icrm)-uuu(k,j,i,icrm) +
-                                    vvv(k,j+1,i,icrm)-vvv(k,j,i,icrm)
-                                    +(www(k+1,j,i,icrm)-www(k,j,i,icrm) )*iadz(k,icrm))*irho(k,icrm);
+    f(ind_f,k,j+offy_s-2,i+offy_s-2,icrm)=f(ind_f,k,j+offy_s-2,i+offx_s-2,icrm)-
+                                    flux_div3(uuu(k,j,i,icrm),uuu(k,j,i+1,icrm),vvv(k,j,i,icrm),vvv(k,j+1,i,icrm),
+                                              www(k,j,i,icrm),www(k+1,j,i,icrm),iadz(k,icrm),irho(k,icrm));
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -760,20 +757,17 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int jc=j+1;
       int ib=i-1;
       uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm) = 
-           andiff(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
-                  u(k,j+offy_u-1,i+offx_u-1,icrm),irho(k,icrm))-
-          (across(f(ind_f,k,jc+offy_s-1,ib+offx_s-1,icrm)+f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,k,jb+offy_s-1,ib+offx_s-1,icrm)-
-                  f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),u(k,j+offy_u-1,i+offx_u-1,icrm),
-                  v(k,j+offy_v-1,ib+offx_v-1,icrm)+
-                  v(k,jc+offy_v-1,ib+offx_v-1,icrm)+v(k,jc+offy_v-1,i+offx_v-1,icrm)+
-                  v(k,j+offy_v-1,i+offx_v-1,icrm))+
-           across(dd*(f(ind_f,kc,j+offy_s-1,ib+offx_s-1,icrm)+f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,kb,j+offy_s-1,ib+offx_s-1,icrm)-
-                  f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),u(k,j+offy_u-1,i+offx_u-1,icrm), 
-                  w(k,j+offy_w-1,ib+offx_w-1,icrm)+
-                  w(kc,j+offy_w-1,ib+offx_w-1,icrm)+w(k,j+offy_w-1,i+offx_w-1,icrm)+
-                  w(kc,j+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
+           antidiff3(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+                     u(k,j+offy_u-1,i+offx_u-1,icrm),irho(k,icrm),
+                     f(ind_f,k,jc+offy_s-1,ib+offx_s-1,icrm)+f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm)-
+                     f(ind_f,k,jb+offy_s-1,ib+offx_s-1,icrm)-f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
+                     v(k,j+offy_v-1,ib+offx_v-1,icrm)+v(k,jc+offy_v-1,ib+offx_v-1,icrm)+
+                     v(k,jc+offy_v-1,i+offx_v-1,icrm)+v(k,j+offy_v-1,i+offx_v-1,icrm),
+                     dd*(f(ind_f,kc,j+offy_s-1,ib+offx_s-1,icrm)+f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm)-
+                         f(ind_f,kb,j+offy_s-1,ib+offx_s-1,icrm)-f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),
+                     w(k,j+offy_w-1,ib+offx_w-1,icrm)+w(kc,j+offy_w-1,ib+offx_w-1,icrm)+
+                     w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm),
+                     irho(k,icrm));
     }
     if (i <= nx+1) {
       int kc=min(nzm-1,k+1);
@@ -783,20 +777,17 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int ib=i-1;
       int ic=i+1;
       vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm) = 
-           andiff(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
-                  v(k,j+offy_v-1,i+offx_v-1,icrm),irho(k,icrm))-
-           (across(f(ind_f,k,jb+offy_s-1,ic+offx_s-1,icrm)+f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm)-
-                   f(ind_f,k,jb+offy_s-1,ib+offx_s-1,icrm)-
-                   f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),v(k,j+offy_v-1,i+offx_v-1,icrm), 
-                   u(k,jb+offy_u-1,i+offx_u-1,icrm)+
-                   u(k,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,ic+offx_u-1,icrm)+
-                   u(k,jb+offy_u-1,ic+offx_u-1,icrm))+
-            across(dd*(f(ind_f,kc,jb+offy_s-1,i+offx_s-1,icrm)+f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm)-
-                   f(ind_f,kb,jb+offy_s-1,i+offx_s-1,icrm)-
-                   f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),v(k,j+offy_v-1,i+offx_v-1,icrm), 
-                   w(k,jb+offy_w-1,i+offx_w-1,icrm)+
-                   w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm)+
-                   w(kc,jb+offy_w-1,i+offx_w-1,icrm))) *irho(k,icrm);
+           antidiff3(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+                     v(k,j+offy_v-1,i+offx_v-1,icrm),irho(k,icrm),
+                     f(ind_f,k,jb+offy_s-1,ic+offx_s-1,icrm)+f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm)-
+                     f(ind_f,k,jb+offy_s-1,ib+offx_s-1,icrm)-f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),
+                     u(k,jb+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,i+offx_u-1,icrm)+
+                     u(k,j+offy_u-1,ic+offx_u-1,icrm)+u(k,jb+offy_u-1,ic+offx_u-1,icrm),
+                     dd*(f(ind_f,kc,jb+offy_s-1,i+offx_s-1,icrm)+f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm)-
+                         f(ind_f,kb,jb+offy_s-1,i+offx_s-1,icrm)-f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm)),
+                     w(k,jb+offy_w-1,i+offx_w-1,icrm)+w(k,j+offy_w-1,i+offx_w-1,icrm)+
+                     w(kc,j+offy_w-1,i+offx_w-1,icrm)+w(kc,jb+offy_w-1,i+offx_w-1,icrm),
+                     irho(k,icrm));
     }
     if (i <= nx+1 && j <= ny+1) {
       int kb=max(0,k-1);
@@ -805,20 +796,17 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int ib=i-1;
       int ic=i+1;
       www(k,j+offy_www-1,i+offx_www-1,icrm) = 
-           andiff(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
-                  w(k,j+offy_w-1,i+offx_w-1,icrm),irhow(k,icrm))-
-          (across(f(ind_f,kb,j+offy_s-1,ic+offx_s-1,icrm)+f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm)-
-                  f(ind_f,kb,j+offy_s-1,ib+offx_s-1,icrm)-
-                  f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),w(k,j+offy_w-1,i+offx_w-1,icrm), 
-                  u(kb,j+offy_u-1,i+offx_u-1,icrm)+
-                  u(k,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,ic+offx_u-1,icrm)+
-                  u(kb,j+offy_u-1,ic+offx_u-1,icrm))+
-           across(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm)+f(ind_f,kb,jc+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm)-
-                  f(ind_f,kb,jb+offy_s-1,i+offx_s-1,icrm),w(k,j+offy_w-1,i+offx_w-1,icrm), 
-                  v(kb,j+offy_v-1,i+offx_v-1,icrm)+
-                  v(kb,jc+offy_v-1,i+offx_v-1,icrm)+v(k,jc+offy_v-1,i+offx_v-1,icrm)+
-                  v(k,j+offy_v-1,i+offx_v-1,icrm))) *irho(k,icrm);
+           antidiff3(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+                     w(k,j+offy_w-1,i+offx_w-1,icrm),irhow(k,icrm),
+                     f(ind_f,kb,j+offy_s-1,ic+offx_s-1,icrm)+f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm)-
+                     f(ind_f,kb,j+offy_s-1,ib+offx_s-1,icrm)-f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),
+                     u(kb,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,i+offx_u-1,icrm)+
+                     u(k,j+offy_u-1,ic+offx_u-1,icrm)+u(kb,j+offy_u-1,ic+offx_u-1,icrm),
+                     f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm)+f(ind_f,kb,jc+offy_s-1,i+offx_s-1,icrm)-
+                     f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm)-f(ind_f,kb,jb+offy_s-1,i+offx_s-1,icrm),
+                     v(kb,j+offy_v-1,i+offx_v-1,icrm)+v(kb,jc+offy_v-1,i+offx_v-1,icrm)+
+                     v(k,jc+offy_v-1,i+offx_v-1,icrm)+v(k,j+offy_v-1,i+offx_v-1,icrm),
+                     irho(k,icrm));
     }
   });
 
@@ -842,17 +830,15 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int ib=i-1;
       int ic=i+1;
       mx(k,j,i,icrm) = 
-          max(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),max(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-          max(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
-          max(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),max(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),
-          max(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-          max(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mx(k,j,i,icrm))))))));
+          nbr_max3(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
+                   f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
+                   f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
+                   max(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mx(k,j,i,icrm)));
       mn(k,j,i,icrm) = 
-          min(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),min(f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
-          min(f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),
-          min(f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),min(f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),
-          min(f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
-          min(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mn(k,j,i,icrm))))))));
+          nbr_min3(f(ind_f,k,j+offy_s-1,ib+offx_s-1,icrm),f(ind_f,k,j+offy_s-1,ic+offx_s-1,icrm),
+                   f(ind_f,k,jb+offy_s-1,i+offx_s-1,icrm),f(ind_f,k,jc+offy_s-1,i+offx_s-1,icrm),
+                   f(ind_f,kb,j+offy_s-1,i+offx_s-1,icrm),f(ind_f,kc,j+offy_s-1,i+offx_s-1,icrm),
+                   min(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),mn(k,j,i,icrm)));
     });
 
     // for (int k=0; k<nzm; k++) {
@@ -863,16 +849,16 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       int kc=min(nzm-1,k+1);
       int jc=j+1;
       int ic=i+1;
-      mx(k,j,i,icrm)=rho(k,icrm)*(mx(k,j,i,icrm)-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm))/
-                ( pn3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pp3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
-                  pn3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pp3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
-                 (pn3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pp3(www(k,j+offy_www-1,i+offx_www-1,icrm)))
-                 *iadz(k,icrm)+eps);
-      mn(k,j,i,icrm)=rho(k,icrm)*(f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mn(k,j,i,icrm))/
-                ( pp3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm)) + pn3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm))+
-                  pp3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm)) + pn3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm))+
-                 (pp3(www(kc,j+offy_www-1,i+offx_www-1,icrm)) + pn3(www(k,j+offy_www-1,i+offx_www-1,icrm)))
-                 *iadz(k,icrm)+eps);
+      mx(k,j,i,icrm)=nonos_in3(rho(k,icrm),mx(k,j,i,icrm)-f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm),
+                               uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm),uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm),
+                               vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm),vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm),
+                               www(k,j+offy_www-1,i+offx_www-1,icrm),www(kc,j+offy_www-1,i+offx_www-1,icrm),
+                               iadz(k,icrm),eps);
+      mn(k,j,i,icrm)=nonos_out3(rho(k,icrm),f(ind_f,k,j+offy_s-1,i+offx_s-1,icrm)-mn(k,j,i,icrm),
+                                uuu(k,j+offy_uuu-1,i+offx_uuu-1,icrm),uuu(k,j+offy_uuu-1,ic+offx_uuu-1,icrm),
+                                vvv(k,j+offy_vvv-1,i+offx_vvv-1,icrm),vvv(k,jc+offy_vvv-1,i+offx_vvv-1,icrm),
+                                www(k,j+offy_www-1,i+offx_www-1,icrm),www(kc,j+offy_www-1,i+offx_www-1,icrm),
+                                iadz(k,icrm),eps);
     });
 
     // for (int k=0; k<nzm; k++) {
@@ -883,27 +869,21 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
       if (j <= ny-1) {
         int ib=i-1;
         uuu(k,j+offy_uuu,i+offx_uuu,icrm) = 
-              pp3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
-              mn(k,j+offy_m,ib+offx_m,icrm)))
-             -pn3(uuu(k,j+offy_uuu,i+offx_uuu,icrm))*min(1.0,min(mx(k,j+offy_m,ib+offx_m,icrm),
-             mn(k,j+offy_m,i+offx_m,icrm)));
+              limit3(uuu(k,j+offy_uuu,i+offx_uuu,icrm),mx(k,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,ib+offx_m,icrm),
+                     mx(k,j+offy_m,ib+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm));
       }
       if (i <= nx-1) {
         int jb=j-1;
         vvv(k,j+offy_vvv,i+offx_vvv,icrm) =
-              pp3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
-              mn(k,jb+offy_m,i+offx_m,icrm)))
-             -pn3(vvv(k,j+offy_vvv,i+offx_vvv,icrm))*min(1.0,min(mx(k,jb+offy_m,i+offx_m,icrm),
-             mn(k,j+offy_m,i+offx_m,icrm)));
+              limit3(vvv(k,j+offy_vvv,i+offx_vvv,icrm),mx(k,j+offy_m,i+offx_m,icrm),mn(k,jb+offy_m,i+offx_m,icrm),
+                     mx(k,jb+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm));
       }
       if (i <= nx-1 && j <= ny-1) {
         int kb=max(0,k-1);
         www(k,j+offy_www,i+offx_www,icrm) =
-              pp3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(k,j+offy_m,i+offx_m,icrm), 
-              mn(kb,j+offy_m,i+offx_m,icrm)))
-             -pn3(www(k,j+offy_www,i+offx_www,icrm))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,icrm),
-             mn(k,j+offy_m,i+offx_m,icrm)));
-        yakl::atomicAdd(flux(ind_flux,k,icrm),www(k,j+offy_www,i+offx_www,icrm));
+              limit3(www(k,j+offy_www,i+offx_www,icrm),mx(k,j+offy_m,i+offx_m,icrm),mn(kb,j+offy_m,i+offx_m,icrm),
+                     mx(kb,j+offy_m,i+offx_m,icrm),mn(k,j+offy_m,i+offx_m,icrm));
+        yakl::atomicAdd(flux(ind_flux,k,icrm),(real) www(k,j+offy_www,i+offx_www,icrm));
       }
     });
   }
@@ -917,13 +897,376 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     //     especially  when such large numbers as
     //     hydrometeor concentrations are advected. The reason for negative values is
     //     most likely truncation error.
-    int kc=k+1;
     f(ind_f,k,j+offy_s,i+offx_s,icrm) = 
-         max(0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -(uuu(k,j+offy_uuu,i+offx_uuu+1,icrm)-
-                 uuu(k,j+offy_uuu,i+offx_uuu,icrm)+
-                 vvv(k,j+offy_vvv+1,i+offx_vvv,icrm)-vvv(k,j+offy_vvv,i+offx_vvv,icrm)+
-                 (www(k+1,j+offy_www,i+offx_www,icrm)-
-                 www(k,j+offy_www,i+offx_www,icrm))*iadz(k,icrm))*irho(k,icrm));
+         max(0.0,f(ind_f,k,j+offy_s,i+offx_s,icrm) -
+                 flux_div3(uuu(k,j+offy_uuu,i+offx_uuu,icrm),uuu(k,j+offy_uuu,i+offx_uuu+1,icrm),
+                           vvv(k,j+offy_vvv,i+offx_vvv,icrm),vvv(k,j+offy_vvv+1,i+offx_vvv,icrm),
+                           www(k,j+offy_www,i+offx_www,icrm),www(k+1,j+offy_www,i+offx_www,icrm),
+                           iadz(k,icrm),irho(k,icrm)));
+  });
+
+}
+
+// Fused multi-field version: advects the fields ind_f(l0:l0+nfld-1) of f in one
+// sweep. Each thread loads the velocities, density and grid factors of its point
+// once and applies them to all the fields. flux is indexed with the same field
+// index as f.
+void advect_scalar3D(crmReal5d &f, int1d &ind_f, int l0, int nfld, real3d &flux) {
+  YAKL_SCOPE( dowallx , ::dowallx);
+  YAKL_SCOPE( dowally , ::dowally);
+  YAKL_SCOPE( rank    , ::rank);
+  YAKL_SCOPE( u       , ::u);
+  YAKL_SCOPE( v       , ::v);
+  YAKL_SCOPE( w       , ::w);
+  YAKL_SCOPE( rho     , ::rho);
+  YAKL_SCOPE( adz     , ::adz);
+  YAKL_SCOPE( rhow    , ::rhow);
+  YAKL_SCOPE( ncrms   , ::ncrms);
+
+  bool constexpr nonos    = true;
+  real constexpr eps      = 1.0e-10;
+  int  constexpr offx_m   = 1;
+  int  constexpr offy_m   = 1;
+  int  constexpr offx_uuu = 2;
+  int  constexpr offy_uuu = 2;
+  int  constexpr offx_vvv = 2;
+  int  constexpr offy_vvv = 2;
+  int  constexpr offx_www = 2;
+  int  constexpr offy_www = 2;
+
+  crmReal5d mx   ("mx"   ,nfld,nzm,ny+2,nx+2,ncrms);
+  crmReal5d mn   ("mn"   ,nfld,nzm,ny+2,nx+2,ncrms);
+  crmReal5d uuu  ("uuu"  ,nfld,nzm,ny+4,nx+5,ncrms);
+  crmReal5d vvv  ("vvv"  ,nfld,nzm,ny+5,nx+4,ncrms);
+  crmReal5d www  ("www"  ,nfld,nz ,ny+4,nx+4,ncrms);
+  real2d iadz ("iadz" ,nzm,ncrms);
+  real2d irho ("irho" ,nzm,ncrms);
+  real2d irhow("irhow",nzm,ncrms);
+
+  // for (int j=0; j<ny+4; j++) {
+  //   for (int i=0; i<nx+4; i++) {
+  //     for(int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ny+4,nx+4,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      www(l,nz-1,j,i,icrm)=0.0;
+    }
+  });
+
+  if (dowallx) {
+    if (rank%nsubdomains_x == 0) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<dimy_u; j++) {
+      //     for (int i=0; i<1-dimx1_u+1; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy_u,1-dimx1_u+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        u(k,j,i,icrm) = 0.0;
+      });
+    }
+    if (rank%nsubdomains_x == nsubdomains_x-1) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<dimy_u; j++) {
+      //     for (int i=0; i<dimx2_u-(nx+1)+1; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy_u,dimx2_u-(nx+1)+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        int iInd = i+(nx+2);
+        u(k,j,iInd,icrm) = 0.0;
+      });
+    }
+  }
+
+  if (dowally) {
+    if (rank < nsubdomains_x) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<1-dimy1_v+1; j++) {
+      //     for (int i=0; i<dimx_v; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,1-dimy1_v+1,dimx_v,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        v(k,j,i,icrm) = 0.0;
+      });
+    }
+    if (rank > nsubdomains-nsubdomains_x-1) {
+      // for (int k=0; k<nzm; k++) {
+      //   for (int j=0; j<dimy2_v-(ny+1)+1; j++) {
+      //     for (int i=0; i<dimx_v; i++) {
+      //       for (int icrm=0; icrm<ncrms; icrm++) {
+      parallel_for( SimpleBounds<4>(nzm,dimy2_v-(ny+1)+1,dimx_v,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+        int jInd = j+(ny+2);
+        v(k,jInd,i,icrm) = 0.0;
+      });
+    }
+  }
+
+  if (nonos) {
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+2; j++) {
+    //     for (int i=0; i<nx+2; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      int jb=j-1;
+      int jc=j+1;
+      int ib=i-1;
+      int ic=i+1;
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        mx(l,k,j,i,icrm) =
+             nbr_max3(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),f(n,k,j+offy_s-1,ic+offx_s-1,icrm),
+                      f(n,k,jb+offy_s-1,i+offx_s-1,icrm),f(n,k,jc+offy_s-1,i+offx_s-1,icrm),
+                      f(n,kb,j+offy_s-1,i+offx_s-1,icrm),f(n,kc,j+offy_s-1,i+offx_s-1,icrm),
+                      f(n,k,j+offy_s-1,i+offx_s-1,icrm));
+        mn(l,k,j,i,icrm) =
+             nbr_min3(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),f(n,k,j+offy_s-1,ic+offx_s-1,icrm),
+                      f(n,k,jb+offy_s-1,i+offx_s-1,icrm),f(n,k,jc+offy_s-1,i+offx_s-1,icrm),
+                      f(n,kb,j+offy_s-1,i+offx_s-1,icrm),f(n,kc,j+offy_s-1,i+offx_s-1,icrm),
+                      f(n,k,j+offy_s-1,i+offx_s-1,icrm));
+      }
+    });
+  }
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+5; j++) {
+  //     for (int i=0; i<nx+5; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+5,nx+5,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int kb=max(0,k-1);
+    crm_real uu = 0.0;
+    crm_real vv = 0.0;
+    crm_real ww = 0.0;
+    if (j <= ny+3) {
+      uu = u(k,j,i,icrm);
+    }
+    if (i <= nx+3) {
+      vv = v(k,j,i,icrm);
+    }
+    if (i <= nx+3 && j <= ny+3) {
+      ww = w(k,j,i,icrm);
+    }
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      if (j <= ny+3){
+        uuu(l,k,j,i,icrm)=upwind3(uu,f(n,k,j+offy_s-2,i-1+offx_s-2,icrm),f(n,k,j+offy_s-2,i+offx_s-2,icrm));
+      }
+      if (i <= nx+3) {
+        vvv(l,k,j,i,icrm)=upwind3(vv,f(n,k,j-1+offy_s-2,i+offx_s-2,icrm),f(n,k,j+offx_s-2,i+offy_s-2,icrm));
+      }
+      if (i <= nx+3 && j <= ny+3) {
+        www(l,k,j,i,icrm)=upwind3(ww,f(n,kb,j+offy_s-2,i+offx_s-2,icrm),f(n,k,j+offy_s-2,i+offx_s-2,icrm));
+      }
+      if (i == 0 && j == 0) {
+        flux(n,k,icrm) = 0.0;
+      }
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //  for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+    irho(k,icrm) = 1.0/rho(k,icrm);
+    iadz(k,icrm) = 1.0/adz(k,icrm);
+    irhow(k,icrm) = 1.0/(rhow(k,icrm)*adz(k,icrm));
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+4; j++) {
+  //     for (int i=0; i<nx+4; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+4,nx+4,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
+    real iadz_k = iadz(k,icrm);
+    real irho_k = irho(k,icrm);
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      if (i >= 2 && i <= nx+1 && j >= 2 && j <= ny+1) {
+        yakl::atomicAdd(flux(n,k,icrm),(real) www(l,k,j,i,icrm));
+      }
+      f(n,k,j+offy_s-2,i+offy_s-2,icrm)=f(n,k,j+offy_s-2,i+offx_s-2,icrm)-
+                                   flux_div3(uuu(l,k,j,i,icrm),uuu(l,k,j,i+1,icrm),vvv(l,k,j,i,icrm),vvv(l,k,j+1,i,icrm),
+                                             www(l,k,j,i,icrm),www(l,k+1,j,i,icrm),iadz_k,irho_k);
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny+3; j++) {
+  //     for (int i=0; i<nx+3; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny+3,nx+3,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int kc=min(nzm-1,k+1);
+    int kb=max(0,k-1);
+    real dd=2.0/(kc-kb)/adz(k,icrm);
+    int jb=j-1;
+    int jc=j+1;
+    int ib=i-1;
+    int ic=i+1;
+    real irho_k  = irho(k,icrm);
+    real irhow_k = irhow(k,icrm);
+    bool do_x = j <= ny+1;
+    bool do_y = i <= nx+1;
+    bool do_z = i <= nx+1 && j <= ny+1;
+    // Face velocities and the transverse velocity sums around each face
+    crm_real uu = 0.0, u_vsum = 0.0, u_wsum = 0.0;
+    crm_real vv = 0.0, v_usum = 0.0, v_wsum = 0.0;
+    crm_real ww = 0.0, w_usum = 0.0, w_vsum = 0.0;
+    if (do_x) {
+      uu     = u(k,j+offy_u-1,i+offx_u-1,icrm);
+      u_vsum = v(k,j+offy_v-1,ib+offx_v-1,icrm)+v(k,jc+offy_v-1,ib+offx_v-1,icrm)+
+               v(k,jc+offy_v-1,i+offx_v-1,icrm)+v(k,j+offy_v-1,i+offx_v-1,icrm);
+      u_wsum = w(k,j+offy_w-1,ib+offx_w-1,icrm)+w(kc,j+offy_w-1,ib+offx_w-1,icrm)+
+               w(k,j+offy_w-1,i+offx_w-1,icrm)+w(kc,j+offy_w-1,i+offx_w-1,icrm);
+    }
+    if (do_y) {
+      vv     = v(k,j+offy_v-1,i+offx_v-1,icrm);
+      v_usum = u(k,jb+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,i+offx_u-1,icrm)+
+               u(k,j+offy_u-1,ic+offx_u-1,icrm)+u(k,jb+offy_u-1,ic+offx_u-1,icrm);
+      v_wsum = w(k,jb+offy_w-1,i+offx_w-1,icrm)+w(k,j+offy_w-1,i+offx_w-1,icrm)+
+               w(kc,j+offy_w-1,i+offx_w-1,icrm)+w(kc,jb+offy_w-1,i+offx_w-1,icrm);
+    }
+    if (do_z) {
+      ww     = w(k,j+offy_w-1,i+offx_w-1,icrm);
+      w_usum = u(kb,j+offy_u-1,i+offx_u-1,icrm)+u(k,j+offy_u-1,i+offx_u-1,icrm)+
+               u(k,j+offy_u-1,ic+offx_u-1,icrm)+u(kb,j+offy_u-1,ic+offx_u-1,icrm);
+      w_vsum = v(kb,j+offy_v-1,i+offx_v-1,icrm)+v(kb,jc+offy_v-1,i+offx_v-1,icrm)+
+               v(k,jc+offy_v-1,i+offx_v-1,icrm)+v(k,j+offy_v-1,i+offx_v-1,icrm);
+    }
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      if (do_x) {
+        uuu(l,k,j+offy_uuu-1,i+offx_uuu-1,icrm) =
+             antidiff3(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm),uu,irho_k,
+                       f(n,k,jc+offy_s-1,ib+offx_s-1,icrm)+f(n,k,jc+offy_s-1,i+offx_s-1,icrm)-
+                       f(n,k,jb+offy_s-1,ib+offx_s-1,icrm)-f(n,k,jb+offy_s-1,i+offx_s-1,icrm),u_vsum,
+                       dd*(f(n,kc,j+offy_s-1,ib+offx_s-1,icrm)+f(n,kc,j+offy_s-1,i+offx_s-1,icrm)-
+                           f(n,kb,j+offy_s-1,ib+offx_s-1,icrm)-f(n,kb,j+offy_s-1,i+offx_s-1,icrm)),u_wsum,
+                       irho_k);
+      }
+      if (do_y) {
+        vvv(l,k,j+offy_vvv-1,i+offx_vvv-1,icrm) =
+             antidiff3(f(n,k,jb+offy_s-1,i+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm),vv,irho_k,
+                       f(n,k,jb+offy_s-1,ic+offx_s-1,icrm)+f(n,k,j+offy_s-1,ic+offx_s-1,icrm)-
+                       f(n,k,jb+offy_s-1,ib+offx_s-1,icrm)-f(n,k,j+offy_s-1,ib+offx_s-1,icrm),v_usum,
+                       dd*(f(n,kc,jb+offy_s-1,i+offx_s-1,icrm)+f(n,kc,j+offy_s-1,i+offx_s-1,icrm)-
+                           f(n,kb,jb+offy_s-1,i+offx_s-1,icrm)-f(n,kb,j+offy_s-1,i+offx_s-1,icrm)),v_wsum,
+                       irho_k);
+      }
+      if (do_z) {
+        www(l,k,j+offy_www-1,i+offx_www-1,icrm) =
+             antidiff3(f(n,kb,j+offy_s-1,i+offx_s-1,icrm),f(n,k,j+offy_s-1,i+offx_s-1,icrm),ww,irhow_k,
+                       f(n,kb,j+offy_s-1,ic+offx_s-1,icrm)+f(n,k,j+offy_s-1,ic+offx_s-1,icrm)-
+                       f(n,kb,j+offy_s-1,ib+offx_s-1,icrm)-f(n,k,j+offy_s-1,ib+offx_s-1,icrm),w_usum,
+                       f(n,k,jc+offy_s-1,i+offx_s-1,icrm)+f(n,kb,jc+offy_s-1,i+offx_s-1,icrm)-
+                       f(n,k,jb+offy_s-1,i+offx_s-1,icrm)-f(n,kb,jb+offy_s-1,i+offx_s-1,icrm),w_vsum,
+                       irho_k);
+      }
+    }
+  });
+
+  // for (int j=0; j<ny+4; j++) {
+  //   for (int i=0; i<nx+4; i++) {
+  //     for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(ny+4,nx+4,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    for (int l=0; l<nfld; l++) {
+      www(l,0,j,i,icrm) = 0.0;
+    }
+  });
+
+  if (nonos) {
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+2; j++) {
+    //     for (int i=0; i<nx+2; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int kb=max(0,k-1);
+      int jb=j-1;
+      int jc=j+1;
+      int ib=i-1;
+      int ic=i+1;
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        mx(l,k,j,i,icrm) =
+            nbr_max3(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),f(n,k,j+offy_s-1,ic+offx_s-1,icrm),
+                     f(n,k,jb+offy_s-1,i+offx_s-1,icrm),f(n,k,jc+offy_s-1,i+offx_s-1,icrm),
+                     f(n,kb,j+offy_s-1,i+offx_s-1,icrm),f(n,kc,j+offy_s-1,i+offx_s-1,icrm),
+                     max(f(n,k,j+offy_s-1,i+offx_s-1,icrm),mx(l,k,j,i,icrm)));
+        mn(l,k,j,i,icrm) =
+            nbr_min3(f(n,k,j+offy_s-1,ib+offx_s-1,icrm),f(n,k,j+offy_s-1,ic+offx_s-1,icrm),
+                     f(n,k,jb+offy_s-1,i+offx_s-1,icrm),f(n,k,jc+offy_s-1,i+offx_s-1,icrm),
+                     f(n,kb,j+offy_s-1,i+offx_s-1,icrm),f(n,kc,j+offy_s-1,i+offx_s-1,icrm),
+                     min(f(n,k,j+offy_s-1,i+offx_s-1,icrm),mn(l,k,j,i,icrm)));
+      }
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+2; j++) {
+    //     for (int i=0; i<nx+2; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+2,nx+2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      int kc=min(nzm-1,k+1);
+      int jc=j+1;
+      int ic=i+1;
+      real rho_k  = rho(k,icrm);
+      real iadz_k = iadz(k,icrm);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        mx(l,k,j,i,icrm)=nonos_in3(rho_k,mx(l,k,j,i,icrm)-f(n,k,j+offy_s-1,i+offx_s-1,icrm),
+                                   uuu(l,k,j+offy_uuu-1,i+offx_uuu-1,icrm),uuu(l,k,j+offy_uuu-1,ic+offx_uuu-1,icrm),
+                                   vvv(l,k,j+offy_vvv-1,i+offx_vvv-1,icrm),vvv(l,k,jc+offy_vvv-1,i+offx_vvv-1,icrm),
+                                   www(l,k,j+offy_www-1,i+offx_www-1,icrm),www(l,kc,j+offy_www-1,i+offx_www-1,icrm),
+                                   iadz_k,eps);
+        mn(l,k,j,i,icrm)=nonos_out3(rho_k,f(n,k,j+offy_s-1,i+offx_s-1,icrm)-mn(l,k,j,i,icrm),
+                                    uuu(l,k,j+offy_uuu-1,i+offx_uuu-1,icrm),uuu(l,k,j+offy_uuu-1,ic+offx_uuu-1,icrm),
+                                    vvv(l,k,j+offy_vvv-1,i+offx_vvv-1,icrm),vvv(l,k,jc+offy_vvv-1,i+offx_vvv-1,icrm),
+                                    www(l,k,j+offy_www-1,i+offx_www-1,icrm),www(l,kc,j+offy_www-1,i+offx_www-1,icrm),
+                                    iadz_k,eps);
+      }
+    });
+
+    // for (int k=0; k<nzm; k++) {
+    //   for (int j=0; j<ny+1; j++) {
+    //     for (int i=0; i<nx+1; i++) {
+    //       for (int icrm=0; icrm<ncrms; icrm++) {
+    parallel_for( SimpleBounds<4>(nzm,ny+1,nx+1,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
+      int ib=i-1;
+      int jb=j-1;
+      int kb=max(0,k-1);
+      for (int l=0; l<nfld; l++) {
+        int n = ind_f(l0+l);
+        if (j <= ny-1) {
+          uuu(l,k,j+offy_uuu,i+offx_uuu,icrm) =
+                limit3(uuu(l,k,j+offy_uuu,i+offx_uuu,icrm),mx(l,k,j+offy_m,i+offx_m,icrm),mn(l,k,j+offy_m,ib+offx_m,icrm),
+                       mx(l,k,j+offy_m,ib+offx_m,icrm),mn(l,k,j+offy_m,i+offx_m,icrm));
+        }
+        if (i <= nx-1) {
+          vvv(l,k,j+offy_vvv,i+offx_vvv,icrm) =
+                limit3(vvv(l,k,j+offy_vvv,i+offx_vvv,icrm),mx(l,k,j+offy_m,i+offx_m,icrm),mn(l,k,jb+offy_m,i+offx_m,icrm),
+                       mx(l,k,jb+offy_m,i+offx_m,icrm),mn(l,k,j+offy_m,i+offx_m,icrm));
+        }
+        if (i <= nx-1 && j <= ny-1) {
+          www(l,k,j+offy_www,i+offx_www,icrm) =
+                limit3(www(l,k,j+offy_www,i+offx_www,icrm),mx(l,k,j+offy_m,i+offx_m,icrm),mn(l,kb,j+offy_m,i+offx_m,icrm),
+                       mx(l,kb,j+offy_m,i+offx_m,icrm),mn(l,k,j+offy_m,i+offx_m,icrm));
+          yakl::atomicAdd(flux(n,k,icrm),(real) www(l,k,j+offy_www,i+offx_www,icrm));
+        }
+      }
+    });
+  }
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    real iadz_k = iadz(k,icrm);
+    real irho_k = irho(k,icrm);
+    for (int l=0; l<nfld; l++) {
+      int n = ind_f(l0+l);
+      // MK: fix for very small negative values from truncation error, as in the per-field version
+      f(n,k,j+offy_s,i+offx_s,icrm) =
+           max(0.0,f(n,k,j+offy_s,i+offx_s,icrm) -
+                   flux_div3(uuu(l,k,j+offy_uuu,i+offx_uuu,icrm),uuu(l,k,j+offy_uuu,i+offx_uuu+1,icrm),
+                             vvv(l,k,j+offy_vvv,i+offx_vvv,icrm),vvv(l,k,j+offy_vvv+1,i+offx_vvv,icrm),
+                             www(l,k,j+offy_www,i+offx_www,icrm),www(l,k+1,j+offy_www,i+offx_www,icrm),
+                             iadz_k,irho_k));
+    }
   });
 
 }
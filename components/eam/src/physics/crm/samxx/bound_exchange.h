@@ -4,8 +4,9 @@
 #include "samxx_const.h"
 #include "vars.h"
 
-void bound_exchange(real4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
-void bound_exchange(real5d &f, int offL, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
+void bound_exchange(crmReal4d &f, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
+void bound_exchange(crmReal5d &f, int offL, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
+void bound_exchange(crmReal5d &f, int l0, int nfld, int dimz, int i_1, int i_2, int j_1, int j_2, int id);
 
 YAKL_INLINE int constexpr _IDX(int const l1, int const u1, int const i1, int const l2, int const u2, 
                                int const i2, int const l3, int const u3, int const i3, int const l4, 
@@ -16,3 +17,7 @@ YAKL_INLINE int constexpr _IDX(int const l1, int const u1, int const i1, int con
            ((i1)-(l1)) );
 }
 
+// Index of the periodic image of i in 0:n-1; valid for halos of any width
+YAKL_INLINE int periodic_index(int i, int n) {
+  return ((i%n)+n)%n;
+}
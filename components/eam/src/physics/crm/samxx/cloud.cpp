@@ -1,6 +1,6 @@
 #include "cloud.h"
 
-void cloud(real5d &q, int ind_q, real5d &qp, int ind_qp) {
+void cloud(crmReal5d &q, int ind_q, crmReal5d &qp, int ind_qp) {
   YAKL_SCOPE( tabs  , ::tabs);
   YAKL_SCOPE( gamaz , ::gamaz);
   YAKL_SCOPE( pres  , ::pres);
@@ -5,5 +5,5 @@
 #include "vars.h"
 #include "sat.h"
 
-void cloud(real5d &q, int ind_q, real5d &qp, int ind_qp);
+void cloud(crmReal5d &q, int ind_q, crmReal5d &qp, int ind_qp);
 
@@ -22,10 +22,10 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev,
                     real *crm_state_temperature_p, real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                     real *crm_state_qc_p, real *crm_state_nc_p, real*crm_state_qr_p, real *crm_state_nr_p,
                     real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p,
-                    real *crm_state_t_prev_p, real *crm_state_q_prev_p,
+                    real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
                     real *crm_rad_qrad_p, real *crm_rad_temperature_p, real *crm_rad_qv_p, real *crm_rad_qc_p, 
                     real *crm_rad_qi_p, real *crm_rad_cld_p, real *crm_rad_nc_p, real *crm_rad_ni_p,
-                    real *crm_output_subcycle_factor_p,
+                    real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p,
                     real *crm_output_cld_p, real *crm_output_cldtop_p, real *crm_output_gicewp_p, real *crm_output_gliqwp_p,
                     real *crm_output_mctot_p, real *crm_output_mcup_p, real *crm_output_mcdn_p, real *crm_output_mcuup_p, real *crm_output_mcudn_p,
                     real *crm_output_qc_mean_p, real *crm_output_qi_mean_p, real *crm_output_qs_mean_p, real *crm_output_qg_mean_p, real *crm_output_qr_mean_p,
@@ -54,7 +54,8 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev,
                     bool use_VT_in, int VT_wn_max_in,
                     char* microphysics_scheme_in,
                     char* turbulence_scheme_in,
-                    bool use_crm_accel_in, real crm_accel_factor_in, bool crm_accel_uv_in) {
+                    bool use_crm_accel_in, real crm_accel_factor_in, bool crm_accel_uv_in,
+                    bool use_crm_fused_advect_in, bool crm_accel_adaptive_in) {
 
 auto start0 = std::clock();
 
@@ -67,6 +68,8 @@ auto start0 = std::clock();
   use_crm_accel = use_crm_accel_in;
   crm_accel_factor = crm_accel_factor_in;
   crm_accel_uv = crm_accel_uv_in;
+  crm_accel_adaptive = crm_accel_adaptive_in;
+  use_crm_fused_advect = use_crm_fused_advect_in;
 
   if (is_same_str(microphysics_scheme_in, "sam1mom") == 0) { 
      microphysics_scheme = microphysics::sam1mom;
@@ -96,8 +99,8 @@ auto start0 = std::clock();
                          crm_state_temperature_p, crm_state_qt_p, crm_state_qp_p, crm_state_qn_p,
                          crm_state_qc_p, crm_state_nc_p, crm_state_qr_p, crm_state_nr_p,
                          crm_state_qi_p, crm_state_ni_p, crm_state_qm_p, crm_state_bm_p,
-                         crm_state_t_prev_p, crm_state_q_prev_p,
-                         crm_rad_qrad_p, crm_output_subcycle_factor_p,
+                         crm_state_t_prev_p, crm_state_q_prev_p, crm_state_accel_deficit_p,
+                         crm_rad_qrad_p, crm_output_subcycle_factor_p, crm_output_accel_factor_p,
                          lat0_p, long0_p, gcolp_p,
                          crm_output_cltot_p, crm_output_clhgh_p,
                          crm_output_clmed_p, crm_output_cllow_p);
@@ -106,10 +109,10 @@ auto start0 = std::clock();
                crm_state_qt_p, crm_state_qp_p, crm_state_qn_p, 
                crm_state_qc_p, crm_state_nc_p, crm_state_qr_p, crm_state_nr_p, 
                crm_state_qi_p, crm_state_ni_p, crm_state_qm_p, crm_state_bm_p,
-               crm_state_t_prev_p, crm_state_q_prev_p,
+               crm_state_t_prev_p, crm_state_q_prev_p, crm_state_accel_deficit_p,
                crm_rad_temperature_p, crm_rad_qv_p, crm_rad_qc_p, 
                crm_rad_qi_p, crm_rad_cld_p, crm_rad_nc_p, crm_rad_ni_p,
-               crm_output_subcycle_factor_p,
+               crm_output_subcycle_factor_p, crm_output_accel_factor_p,
                crm_output_cld_p, crm_output_cldtop_p,
                crm_output_gicewp_p, crm_output_gliqwp_p, 
                crm_output_mctot_p, crm_output_mcup_p, crm_output_mcdn_p, 
@@ -152,10 +155,10 @@ auto start0 = std::clock();
                            crm_state_qt_p, crm_state_qp_p, crm_state_qn_p,
                            crm_state_qc_p, crm_state_nc_p, crm_state_qr_p, crm_state_nr_p,
                            crm_state_qi_p, crm_state_ni_p, crm_state_qm_p, crm_state_bm_p,
-                           crm_state_t_prev_p, crm_state_q_prev_p,
+                           crm_state_t_prev_p, crm_state_q_prev_p, crm_state_accel_deficit_p,
                            crm_rad_temperature_p, crm_rad_qv_p, crm_rad_qc_p, 
                            crm_rad_qi_p, crm_rad_cld_p, crm_rad_nc_p, crm_rad_ni_p, 
-                           crm_output_subcycle_factor_p, 
+                           crm_output_subcycle_factor_p, crm_output_accel_factor_p, 
                            crm_output_cld_p, crm_output_cldtop_p, 
                            crm_output_gicewp_p, crm_output_gliqwp_p, 
                            crm_output_mctot_p, crm_output_mcup_p, crm_output_mcdn_p, 
@@ -189,5 +192,7 @@ auto start0 = std::clock();
 
 auto end0 = std::clock();
 printf("wtime, step=%d, ncrms=%d, time=%13.6e\n", nstep,ncrms,(end0-start0)/(float)CLOCKS_PER_SEC);
+p3_bridge_timing().report();
+shoc_bridge_timing().report();
 }
 
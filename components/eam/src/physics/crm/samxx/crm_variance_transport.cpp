@@ -130,8 +130,8 @@ void VT_diagnose() {
   //    do i = 1,nx
   //      do icrm = 1,ncrms
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
-    yakl::atomicAdd( t_mean(k,icrm) , t(k,j+offy_s,i+offx_s,icrm) );
-    yakl::atomicAdd( q_mean(k,icrm) , micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
+    yakl::atomicAdd( t_mean(k,icrm) , (real) t(k,j+offy_s,i+offx_s,icrm) );
+    yakl::atomicAdd( q_mean(k,icrm) , (real) micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) );
   });
 
   // do k = 1,nzm
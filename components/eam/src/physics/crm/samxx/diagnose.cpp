@@ -65,11 +65,11 @@ void diagnose() {
     real coef1 = rho(k,icrm)*dz(icrm)*adz(k,icrm)*dtfactor;
     tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm)-gamaz(k,icrm)+ fac_cond *
                        (qcl(k,j,i,icrm)+qpl(k,j,i,icrm)) + fac_sub *(qci(k,j,i,icrm) + qpi(k,j,i,icrm));
-    yakl::atomicAdd(u0(k,icrm),u(k,j+offy_u,i+offx_u,icrm));
-    yakl::atomicAdd(v0(k,icrm),v(k,j+offy_v,i+offx_v,icrm));
+    yakl::atomicAdd(u0(k,icrm),(real) u(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(v0(k,icrm),(real) v(k,j+offy_v,i+offx_v,icrm));
     yakl::atomicAdd(p0(k,icrm),p(k,j+offy_p,i+offx_p,icrm));
-    yakl::atomicAdd(t0(k,icrm),t(k,j+offy_s,i+offx_s,icrm));
-    yakl::atomicAdd(tabs0(k,icrm),tabs(k,j,i,icrm));
+    yakl::atomicAdd(t0(k,icrm),(real) t(k,j+offy_s,i+offx_s,icrm));
+    yakl::atomicAdd(tabs0(k,icrm),(real) tabs(k,j,i,icrm));
     real tmp = qv(k,j,i,icrm)+qcl(k,j,i,icrm)+qci(k,j,i,icrm);
     yakl::atomicAdd(q0(k,icrm),tmp);
     tmp = qcl(k,j,i,icrm) + qci(k,j,i,icrm);
@@ -1,7 +1,7 @@
 
 #include "diffuse_mom2D.h"
 
-void diffuse_mom2D(real5d &tk) {
+void diffuse_mom2D(crmReal5d &tk) {
   YAKL_SCOPE( dx            , :: dx);
   YAKL_SCOPE( dy            , :: dy);
   YAKL_SCOPE( dz            , :: dz);
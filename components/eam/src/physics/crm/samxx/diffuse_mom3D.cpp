@@ -1,6 +1,6 @@
 #include "diffuse_mom3D.h"
 
-void diffuse_mom3D(real5d &tk) {
+void diffuse_mom3D(crmReal5d &tk) {
   YAKL_SCOPE( dx            , :: dx);
   YAKL_SCOPE( dy            , :: dy);
   YAKL_SCOPE( dz            , :: dz);
@@ -4,5 +4,5 @@
 #include "samxx_const.h"
 #include "vars.h"
 
-void diffuse_mom3D(real5d &tk);
+void diffuse_mom3D(crmReal5d &tk);
 
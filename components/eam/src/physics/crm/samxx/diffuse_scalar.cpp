@@ -1,7 +1,7 @@
 #include "diffuse_scalar.h"
 
 
-void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &fluxt, real2d &fdiff, real2d &flux) {
+void diffuse_scalar(crmReal5d &tkh, int ind_tkh, crmReal4d &f, real3d &fluxb, real3d &fluxt, real2d &fdiff, real2d &flux) {
   YAKL_SCOPE( ncrms , ::ncrms);
   real4d df("df", nzm, dimy_s, dimx_s, ncrms);
   
@@ -35,7 +35,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real4d &f, real3d &fluxb, real3d &
   });
 }
 
-void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &fluxb,
+void diffuse_scalar(crmReal5d &tkh, int ind_tkh, crmReal5d &f, int ind_f, real3d &fluxb,
                     real3d &fluxt, real2d &fdiff, real2d &flux) {
   YAKL_SCOPE( ncrms , ::ncrms);
   real4d df("df", nzm, dimy_s, dimx_s, ncrms);
@@ -70,7 +70,7 @@ void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real3d &flux
   });
 }
 
-void diffuse_scalar(real5d &tkh, int ind_tkh, real5d &f, int ind_f, real4d &fluxb, int ind_fluxb,
+void diffuse_scalar(crmReal5d &tkh, int ind_tkh, crmReal5d &f, int ind_f, real4d &fluxb, int ind_fluxb,
                     real4d &fluxt, int ind_fluxt, real3d &fdiff, int ind_fdiff, real3d &flux, int ind_flux) {
   YAKL_SCOPE( ncrms , ::ncrms);
   real4d df("df", nzm, dimy_s, dimx_s, ncrms);
@@ -1,7 +1,7 @@
 
 #include "diffuse_scalar2D.h"
 
-void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
+void diffuse_scalar2D(crmReal4d &field, real3d &fluxb, real3d &fluxt, crmReal5d &tkh,
                       int ind_tkh, real2d &flux) {
   YAKL_SCOPE( dx     , ::dx);
   YAKL_SCOPE( rhow   , ::rhow);
@@ -90,8 +90,8 @@ void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
 }
 
 
-void diffuse_scalar2D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt,
-                      real5d &tkh, int ind_tkh, real2d &flux) {
+void diffuse_scalar2D(crmReal5d &field, int ind_field, real3d &fluxb, real3d &fluxt,
+                      crmReal5d &tkh, int ind_tkh, real2d &flux) {
   YAKL_SCOPE( dx     , ::dx);
   YAKL_SCOPE( rhow   , ::rhow);
   YAKL_SCOPE( adzw   , ::adzw);
@@ -179,8 +179,8 @@ void diffuse_scalar2D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
   }
 }
 
-void diffuse_scalar2D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb, real4d &fluxt,
-                      int ind_fluxt, real5d &tkh, int ind_tkh, real3d &flux, int ind_flux) {
+void diffuse_scalar2D(crmReal5d &field, int ind_field, real4d &fluxb, int ind_fluxb, real4d &fluxt,
+                      int ind_fluxt, crmReal5d &tkh, int ind_tkh, real3d &flux, int ind_flux) {
   YAKL_SCOPE( dx            , :: dx);
   YAKL_SCOPE( rhow          , :: rhow);
   YAKL_SCOPE( adzw          , :: adzw);
@@ -1,6 +1,6 @@
 #include "diffuse_scalar3D.h"
 
-void diffuse_scalar3D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
+void diffuse_scalar3D(crmReal4d &field, real3d &fluxb, real3d &fluxt, crmReal5d &tkh,
                       int ind_tkh, real2d &flux) {
   YAKL_SCOPE( dx     , ::dx);
   YAKL_SCOPE( dy     , ::dy);
@@ -117,7 +117,7 @@ void diffuse_scalar3D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
 }
 
 
-void diffuse_scalar3D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt, real5d &tkh,
+void diffuse_scalar3D(crmReal5d &field, int ind_field, real3d &fluxb, real3d &fluxt, crmReal5d &tkh,
                       int ind_tkh, real2d &flux) {
   YAKL_SCOPE( dx     , ::dx);
   YAKL_SCOPE( dy     , ::dy);
@@ -234,8 +234,8 @@ void diffuse_scalar3D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
   }
 }
 
-void diffuse_scalar3D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb, real4d &fluxt,
-                      int ind_fluxt, real5d &tkh, int ind_tkh, real3d &flux, int ind_flux) {
+void diffuse_scalar3D(crmReal5d &field, int ind_field, real4d &fluxb, int ind_fluxb, real4d &fluxt,
+                      int ind_fluxt, crmReal5d &tkh, int ind_tkh, real3d &flux, int ind_flux) {
   YAKL_SCOPE( dx     , ::dx);
   YAKL_SCOPE( dy     , ::dy);
   YAKL_SCOPE( rhow   , ::rhow);
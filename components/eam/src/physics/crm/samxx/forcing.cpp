@@ -36,9 +36,9 @@ void forcing() {
 
     if (micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) < 0.0) {
       yakl::atomicAdd(nneg(k,icrm),1);
-      yakl::atomicAdd(qneg(k,icrm),micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm));
+      yakl::atomicAdd(qneg(k,icrm),(real) micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm));
     } else {
-      yakl::atomicAdd(qpoz(k,icrm),micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm));
+      yakl::atomicAdd(qpoz(k,icrm),(real) micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm));
     }
     dudt(na-1,k,j,i,icrm) = dudt(na-1,k,j,i,icrm) + utend(k,icrm);
     dvdt(na-1,k,j,i,icrm) = dvdt(na-1,k,j,i,icrm) + vtend(k,icrm);
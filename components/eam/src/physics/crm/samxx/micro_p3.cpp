@@ -233,9 +233,11 @@ void micro_p3_init() {
 }
 
 
-void get_cloud_fraction(int its, int ite, int kts, int kte, real2d& cloud_frac,
-                       real2d& qc, real2d& qr, real2d& qi, std::string& method,
-                       real2d& cld_frac_i, real2d& cld_frac_l, real2d& cld_frac_r)
+// Cloud fractions are computed directly on the packed P3 column views
+template <typename ViewT>
+void get_cloud_fraction(int its, int ite, int kts, int kte, const ViewT& cloud_frac,
+                       const ViewT& qc, const ViewT& qr, const ViewT& qi, std::string& method,
+                       const ViewT& cld_frac_i, const ViewT& cld_frac_l, const ViewT& cld_frac_r)
 {
   // Temporary method for initial P3 implementation
 
@@ -249,12 +251,16 @@ void get_cloud_fraction(int its, int ite, int kts, int kte, real2d& cloud_frac,
   //   cld_frac_r(i,k) = 1.0; //cldm(i,k);
   // });
 
+  const auto cld_frac_i_s = ekat::scalarize(cld_frac_i);
+  const auto cld_frac_l_s = ekat::scalarize(cld_frac_l);
+  const auto cld_frac_r_s = ekat::scalarize(cld_frac_r);
+
   real cld_water_threshold = 0.001;
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     int icol = i+nx*(j+icrm*ny);
-    cld_frac_l(icol,k) = 1.0;
-    cld_frac_i(icol,k) = 1.0;
-    cld_frac_r(icol,k) = 1.0;
+    cld_frac_l_s(icol,k) = 1.0;
+    cld_frac_i_s(icol,k) = 1.0;
+    cld_frac_r_s(icol,k) = 1.0;
     // cld_frac_l(icol,k) = p3_mincld;
     // cld_frac_i(icol,k) = p3_mincld;
     // cld_frac_r(icol,k) = p3_mincld;
@@ -475,53 +481,7 @@ void micro_p3_proc() {
   const int ncol  = ncrms*nx*ny;
   const int npack = ekat::npack<Spack>(nlev);
 
-  real2d qc_in("qc",ncol, nlev);
-  real2d nc_in("nc",ncol, nlev);
-  real2d qr_in("qr",ncol, nlev);
-  real2d nr_in("nr",ncol, nlev);
-  real2d qi_in("qi",ncol, nlev);
-  real2d qm_in("qm",ncol, nlev);
-  real2d ni_in("ni",ncol, nlev);
-  real2d bm_in("bm",ncol, nlev);
-  real2d qv_in("qv",ncol, nlev);
-  real2d th_in("th",ncol, nlev);
-
-  real2d nc_nuceat_tend_in("nuceat",ncol, nlev);
-  real2d nccn_in("nccn",ncol, nlev);
-  real2d ni_activated_in("ni_act",ncol, nlev);
-  real2d inv_qc_relvar_in("inv_qc",ncol, nlev); // relative cloud water variance - not needed - set to 1
-  real2d cld_frac_i_in("cld_frac_i",ncol, nlev);
-  real2d cld_frac_l_in("cld_frac_l",ncol, nlev);
-  real2d cld_frac_r_in("cld_frac_r",ncol, nlev);
-  real2d dz_in("dz", ncol, nlev);
-  real2d pmid_in("pmid", ncol, nlev);
-  real2d pdel_in("pdel",ncol, nlev);
-  real2d inv_exner_in("inv_exner",ncol, nlev);
-  real2d q_prev_in("q_prev",ncol, nlev);
-  real2d t_prev_in("t_prev",ncol, nlev);
-
-  real2d cloud_frac_in("cloud_frac_in",ncol, nlev);
-
-  // p3 output variables 
-  // real2d qv2qi_depos_tend_in("qv2qi",ncol, nlev);
-  // real2d precip_liq_surf_in("precip_liq",ncol, nlev);
-  // real2d precip_ice_surf_in("precip_ice",ncol, nlev);
-  // real2d diag_eff_radius_qc_in("diag_eff_qc",ncol, nlev);
-  // real2d diag_eff_radius_qi_in("diag_eff_qi",ncol, nlev);
-  // real2d rho_qi_in("rho_qi",ncol, nlev);
-  // real2d precip_liq_flux_in("precip_liq_flux",ncol, nlev);
-  // real2d precip_ice_flux_in("precip_ice_flux",ncol, nlev);
-
-  // p3 output variables
-  // real2d qv2qi_depos_tend_out("qv2qi_depos_tend", ncol, nlev);
-  // real2d diag_eff_radius_qc_out("diag_eff_radius_qc", ncol, nlev);
-  // real2d diag_eff_radius_qi_out("diag_eff_radius_qi", ncol, nlev);
-  // real2d rho_qi_out("rho_qi", nzm, nx);
-  // real2d precip_liq_flux_out("precip_liq_flux", ncol, nlev);
-  // real2d precip_ice_flux_out("precip_ice_flux", ncol, nlev);
-
-  // real1d precip_liq_surf_out("precip_liq_surf_d", ncol);
-  // real1d precip_ice_surf_out("precip_ice_surf_d", ncol);
+  auto& timing = p3_bridge_timing();
 
   //----------------------------------------------------------------------------
   // Populate P3 thermodynamic state
@@ -549,36 +509,7 @@ void micro_p3_proc() {
     });
   }
 
-  // Diagnose potential temperature
-  parallel_for( SimpleBounds<4>(nzm, ny, nx, ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+ny*icrm);
-    int ilev = k;
-    inv_exner_in(icol, ilev) = 1./std::pow((pres(k,icrm)*1.0e-3), (rgas/cp));
-    tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm) - gamaz(k,icrm)
-                      + fac_cond *( qcl(k,j,i,icrm) + qpl(k,j,i,icrm) ) 
-                      + fac_sub  *( qci(k,j,i,icrm) + qpi(k,j,i,icrm) );
-    th_in(icol, ilev) = tabs(k,j,i,icrm)*inv_exner_in(icol, ilev);
-  });
-
-// auto fp=fopen("q.txt","w");
-  parallel_for( SimpleBounds<4>(nzm, ny, nx, ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+ny*icrm);
-    int ilev = k;
-    qv_in(icol,ilev) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm);
-    qc_in(icol,ilev) = micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm); 
-    nc_in(icol,ilev) = micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm);
-    qr_in(icol,ilev) = micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm);
-    nr_in(icol,ilev) = micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm);
-    qi_in(icol,ilev) = micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm);
-    qm_in(icol,ilev) = micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm);
-    ni_in(icol,ilev) = micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm);
-    bm_in(icol,ilev) = micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm);
-
-// fprintf(fp,"%d, %d, %d, %d %13.6e, %13.6e, %13.6e, %13.6e, %13.6e, %13.6e, %13.6e, %13.6e, %13.6e\n",k,j,i,icrm,
-// qv_in(icol,ilev),qc_in(icol,ilev),nc_in(icol,ilev),qr_in(icol,ilev),nr_in(icol,ilev),qi_in(icol,ilev),qm_in(icol,ilev),ni_in(icol,ilev),bm_in(icol,ilev));
-
-  });
-// fclose(fp);
+  timing.start();
 
   view_2d qv_d("qv", ncol, npack),
           qc_d("qc", ncol, npack),
@@ -591,42 +522,6 @@ void micro_p3_proc() {
           bm_d("bm", ncol, npack),
           th_d("th", ncol, npack);
 
-  array_to_view(qc_in.myData, ncol, nlev, qc_d);
-  array_to_view(nc_in.myData, ncol, nlev, nc_d);
-  array_to_view(qr_in.myData, ncol, nlev, qr_d);
-  array_to_view(nr_in.myData, ncol, nlev, nr_d);
-  array_to_view(qi_in.myData, ncol, nlev, qi_d);
-  array_to_view(qm_in.myData, ncol, nlev, qm_d);
-  array_to_view(ni_in.myData, ncol, nlev, ni_d);
-  array_to_view(bm_in.myData, ncol, nlev, bm_d);
-  array_to_view(qv_in.myData, ncol, nlev, qv_d);
-  array_to_view(th_in.myData, ncol, nlev, th_d);
-   
-  P3F::P3PrognosticState prog_state{qc_d, nc_d, qr_d, nr_d, qi_d, qm_d,
-                                    ni_d, bm_d, qv_d, th_d};
-
-  //----------------------------------------------------------------------------
-  // Populate P3 diagnostic inputs
-  //----------------------------------------------------------------------------
-  parallel_for( SimpleBounds<4>(nzm, ny, nx, ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+icrm*ny);
-    int ilev = k;
-    nccn_in(icol,ilev)            = nccn(k,icrm);
-    nc_nuceat_tend_in(icol,ilev)  = nc_nuceat_tend(k,icrm);
-    ni_activated_in(icol,ilev)    = ni_activated(k,icrm);
-    inv_qc_relvar_in(icol,ilev)   = 1.; // not needed - set to 1
-    dz_in(icol,ilev)              = adz(k,icrm)*dz(icrm);
-    pmid_in(icol,ilev)            = pres(k,icrm)*100.;
-    pdel_in(icol,ilev)            = pdel(k,icrm)*100.;
-    cloud_frac_in(icol,ilev)      = CF3D(k,j,i,icrm);
-    q_prev_in(icol,ilev)          = q_prev(k,j,i,icrm);
-    t_prev_in(icol,ilev)          = t_prev(k,j,i,icrm);
-  });
-
-  std::string method("in_cloud");
-  get_cloud_fraction(0, ncol-1, 0, nlev-1, cloud_frac_in, qc_in, qr_in, qi_in, method,
-                     cld_frac_i_in, cld_frac_l_in, cld_frac_r_in);
-
   view_2d nc_nuceat_tend_d("nc_nuceat_tend", ncol, npack),
           nccn_d("nccn", ncol, npack),
           ni_activated_d("ni_activated", ncol, npack),
@@ -637,23 +532,53 @@ void micro_p3_proc() {
           inv_exner_d("inv_exner", ncol, npack),
           t_prev_d("t_prev", ncol, npack),
           q_prev_d("q_prev", ncol, npack),
+          cloud_frac_d("cloud_frac", ncol, npack),
           cld_frac_i_d("cld_frac_i", ncol, npack),
           cld_frac_l_d("cld_frac_l", ncol, npack),
           cld_frac_r_d("cld_frac_r", ncol, npack);
 
-  array_to_view(nc_nuceat_tend_in.myData, ncol, nlev, nc_nuceat_tend_d);
-  array_to_view(nccn_in.myData, ncol, nlev, nccn_d);
-  array_to_view(ni_activated_in.myData, ncol, nlev, ni_activated_d);
-  array_to_view(inv_qc_relvar_in.myData, ncol, nlev, inv_qc_relvar_d);
-  array_to_view(dz_in.myData, ncol, nlev, dz_d);
-  array_to_view(pmid_in.myData, ncol, nlev, pmid_d);
-  array_to_view(pdel_in.myData, ncol, nlev, pdel_d);
-  array_to_view(inv_exner_in.myData, ncol, nlev, inv_exner_d);
-  array_to_view(t_prev_in.myData, ncol, nlev, t_prev_d);
-  array_to_view(q_prev_in.myData, ncol, nlev, q_prev_d);
-  array_to_view(cld_frac_i_in.myData, ncol, nlev, cld_frac_i_d);
-  array_to_view(cld_frac_l_in.myData, ncol, nlev, cld_frac_l_d);
-  array_to_view(cld_frac_r_in.myData, ncol, nlev, cld_frac_r_d);
+  // Diagnose potential temperature, and pack the P3 state and diagnostic
+  // inputs straight from the CRM arrays (no intermediate YAKL arrays)
+  crm_column_for<Spack>("p3 bridge in", ncol, nlev, false,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    const real inv_exner = 1./std::pow((pres(k,icrm)*1.0e-3), (rgas/cp));
+    tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm) - gamaz(k,icrm)
+                      + fac_cond *( qcl(k,j,i,icrm) + qpl(k,j,i,icrm) ) 
+                      + fac_sub  *( qci(k,j,i,icrm) + qpi(k,j,i,icrm) );
+    inv_exner_d(icol,ilev)[s] = inv_exner;
+    th_d(icol,ilev)[s]        = tabs(k,j,i,icrm)*inv_exner;
+
+    qv_d(icol,ilev)[s] = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) - micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm);
+    qc_d(icol,ilev)[s] = micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm); 
+    nc_d(icol,ilev)[s] = micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm);
+    qr_d(icol,ilev)[s] = micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm);
+    nr_d(icol,ilev)[s] = micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm);
+    qi_d(icol,ilev)[s] = micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm);
+    qm_d(icol,ilev)[s] = micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm);
+    ni_d(icol,ilev)[s] = micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm);
+    bm_d(icol,ilev)[s] = micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm);
+
+    nccn_d(icol,ilev)[s]            = nccn(k,icrm);
+    nc_nuceat_tend_d(icol,ilev)[s]  = nc_nuceat_tend(k,icrm);
+    ni_activated_d(icol,ilev)[s]    = ni_activated(k,icrm);
+    inv_qc_relvar_d(icol,ilev)[s]   = 1.; // not needed - set to 1
+    dz_d(icol,ilev)[s]              = adz(k,icrm)*dz(icrm);
+    pmid_d(icol,ilev)[s]            = pres(k,icrm)*100.;
+    pdel_d(icol,ilev)[s]            = pdel(k,icrm)*100.;
+    cloud_frac_d(icol,ilev)[s]      = CF3D(k,j,i,icrm);
+    q_prev_d(icol,ilev)[s]          = q_prev(k,j,i,icrm);
+    t_prev_d(icol,ilev)[s]          = t_prev(k,j,i,icrm);
+  });
+
+  P3F::P3PrognosticState prog_state{qc_d, nc_d, qr_d, nr_d, qi_d, qm_d,
+                                    ni_d, bm_d, qv_d, th_d};
+
+  //----------------------------------------------------------------------------
+  // Populate P3 diagnostic inputs
+  //----------------------------------------------------------------------------
+  std::string method("in_cloud");
+  get_cloud_fraction(0, ncol-1, 0, nlev-1, cloud_frac_d, qc_d, qr_d, qi_d, method,
+                     cld_frac_i_d, cld_frac_l_d, cld_frac_r_d);
 
   P3F::P3DiagnosticInputs diag_inputs{nc_nuceat_tend_d, nccn_d, 
                                       ni_activated_d, inv_qc_relvar_d, 
@@ -662,7 +587,7 @@ void micro_p3_proc() {
                                       q_prev_d, t_prev_d};
 
   //----------------------------------------------------------------------------
-  // Populate P3 diagnostic outputs
+  // Populate P3 diagnostic outputs (views are zero-initialized on allocation)
   //----------------------------------------------------------------------------
   view_2d qv2qi_depos_tend_d("qv2qi_depos_tend", ncol, npack),
           diag_eff_radius_qc_d("diag_eff_radius_qc", ncol, npack),
@@ -674,24 +599,12 @@ void micro_p3_proc() {
   sview_1d precip_liq_surf_d("precip_liq_surf_d", ncol), 
            precip_ice_surf_d("precip_ice_surf_d", ncol);
 
-  Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ncol, npack, Spack::n}), KOKKOS_LAMBDA(int icol, int ilev, int s) {
-     qv2qi_depos_tend_d(icol,ilev)[s] = 0.;
-     diag_eff_radius_qc_d(icol,ilev)[s] = 0.;
-     diag_eff_radius_qi_d(icol,ilev)[s] = 0.;
-     rho_qi_d(icol,ilev)[s] = 0.;
-     precip_liq_flux_d(icol,ilev)[s] = 0.;
-     precip_ice_flux_d(icol,ilev)[s] = 0.;
-  });
-
-  Kokkos::parallel_for("precip", ncol, KOKKOS_LAMBDA (const int& icol) {
-    precip_liq_surf_d(icol) = 0.;
-    precip_ice_surf_d(icol) = 0.;
-  });
-
   P3F::P3DiagnosticOutputs diag_outputs {qv2qi_depos_tend_d, precip_liq_surf_d,
                                          precip_ice_surf_d, diag_eff_radius_qc_d, diag_eff_radius_qi_d,
                                          rho_qi_d,precip_liq_flux_d, precip_ice_flux_d};
 
+  timing.lap(timing.bridge_in);
+
   //----------------------------------------------------------------------------
   // Populate P3 infrastructure
   //----------------------------------------------------------------------------
@@ -723,12 +636,6 @@ void micro_p3_proc() {
           vap_liq_exchange_d("vap_liq_exchange_d", ncol, npack),
           vap_ice_exchange_d("vap_ice_exchange_d", ncol, npack);
 
-  Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ncol, npack}), KOKKOS_LAMBDA(int icol, int ilev) {
-     liq_ice_exchange_d(icol,ilev) = 0.;
-     vap_liq_exchange_d(icol,ilev) = 0.;
-     vap_ice_exchange_d(icol,ilev) = 0.;
-  });
-
   P3F::P3HistoryOnly history_only {liq_ice_exchange_d, vap_liq_exchange_d,
                                    vap_ice_exchange_d};
 
@@ -798,11 +705,15 @@ void micro_p3_proc() {
   const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncol, nlev_pack);
   ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlev_pack, 52, policy);
 
+  timing.start();
+
   auto elapsed_time = P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
                                    history_only, tables, workspace_mgr, ncol, nlev);
 
 //printf("p3_main wall time: nj=%d, nk=%d, time=%13.6e\n", ite, kte, (float)elapsed_time*1.e-6);
 
+  timing.lap(timing.main);
+
   //----------------------------------------------------------------------------
   Kokkos::parallel_for("precip", ncol, KOKKOS_LAMBDA (const int& icol) {
     int i    = icol%nx;
@@ -815,69 +726,45 @@ void micro_p3_proc() {
     precssfc(j,i,icrm)= precssfc_tmp+(diag_outputs.precip_ice_surf(icol)) * 1000.0 * dt / dz(icrm);
   });
 
-  // update microfield
-  Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ncol, npack, Spack::n}), KOKKOS_LAMBDA(int icol, int ilev, int s) {
-    int i    = icol%nx;
-    int j    = (icol/nx)%ny;
-    int icrm = (icol/nx)/ny;
-    int k    = ilev*Spack::n + s;
-    if (k < nlev) {
-      micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = prog_state.qv(icol,ilev)[s] + prog_state.qc(icol,ilev)[s];
-      micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm) = prog_state.qc(icol,ilev)[s];
-      micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm) = prog_state.nc(icol,ilev)[s];
-      micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm) = prog_state.qr(icol,ilev)[s];
-      micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm) = prog_state.nr(icol,ilev)[s];
-      micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm) = prog_state.qi(icol,ilev)[s];
-      micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm) = prog_state.qm(icol,ilev)[s];
-      micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm) = prog_state.ni(icol,ilev)[s];
-      micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm) = prog_state.bm(icol,ilev)[s];
-    }
+  // update microfield, and unpack the diagnostic and history outputs
+  crm_column_for<Spack>("p3 bridge out", ncol, nlev, false,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = prog_state.qv(icol,ilev)[s] + prog_state.qc(icol,ilev)[s];
+    micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm) = prog_state.qc(icol,ilev)[s];
+    micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm) = prog_state.nc(icol,ilev)[s];
+    micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm) = prog_state.qr(icol,ilev)[s];
+    micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm) = prog_state.nr(icol,ilev)[s];
+    micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm) = prog_state.qi(icol,ilev)[s];
+    micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm) = prog_state.qm(icol,ilev)[s];
+    micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm) = prog_state.ni(icol,ilev)[s];
+    micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm) = prog_state.bm(icol,ilev)[s];
+
+    qv2qi_depos_tend(k,icrm)   = diag_outputs.qv2qi_depos_tend(icol,ilev)[s];
+    diag_eff_radius_qc(k,icrm) = diag_outputs.diag_eff_radius_qc(icol,ilev)[s];
+    diag_eff_radius_qi(k,icrm) = diag_outputs.diag_eff_radius_qi(icol,ilev)[s];
+    rho_qi(k,icrm)             = diag_outputs.rho_qi(icol,ilev)[s];
+    precip_liq_flux(k,icrm)    = diag_outputs.precip_liq_flux(icol,ilev)[s];
+    precip_ice_flux(k,icrm)    = diag_outputs.precip_ice_flux(icol,ilev)[s];
+
+    liq_ice_exchange(k,icrm) = history_only.liq_ice_exchange(icol,ilev)[s];
+    vap_liq_exchange(k,icrm) = history_only.vap_liq_exchange(icol,ilev)[s];
+    vap_ice_exchange(k,icrm) = history_only.vap_ice_exchange(icol,ilev)[s];
   });
 
   micro_p3_diagnose();
 
   // update LSE, temperature, and previous t/q
-  Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ncol, npack, Spack::n}), KOKKOS_LAMBDA(int icol, int ilev, int s) {
-    int i    = icol%nx;
-    int j    = (icol/nx)%ny;
-    int icrm = (icol/nx)/ny;
-    int k    = ilev*Spack::n + s;
-    if (k < nlev) {
-      tabs(k,j,i,icrm) = prog_state.th(icol,ilev)[s]/inv_exner_in(icol,ilev);
-      t(k,j+offy_s,i+offx_s,icrm) = tabs(k,j,i,icrm) + gamaz(k,icrm)
-                    - fac_cond *( qcl(k,j,i,icrm) + qpl(k,j,i,icrm) )
-                    - fac_sub  *( qci(k,j,i,icrm) + qpi(k,j,i,icrm) );
-      t_prev(k,j,i,icrm) = tabs(k,j,i,icrm);
-      q_prev(k,j,i,icrm) = qv(k,j,i,icrm);
-    }
-  });
-
-  Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ncol, npack, Spack::n}), KOKKOS_LAMBDA(int icol, int ilev, int s) {
-    int i    = icol%nx;
-    int j    = (icol/nx)%ny;
-    int icrm = (icol/nx)/ny;
-    int k    = ilev*Spack::n + s;
-    if (k < nlev) {
-      qv2qi_depos_tend(k,icrm)   = diag_outputs.qv2qi_depos_tend(icol,ilev)[s];
-      diag_eff_radius_qc(k,icrm) = diag_outputs.diag_eff_radius_qc(icol,ilev)[s];
-      diag_eff_radius_qi(k,icrm) = diag_outputs.diag_eff_radius_qi(icol,ilev)[s];
-      rho_qi(k,icrm)             = diag_outputs.rho_qi(icol,ilev)[s];
-      precip_liq_flux(k,icrm)    = diag_outputs.precip_liq_flux(icol,ilev)[s];
-      precip_ice_flux(k,icrm)    = diag_outputs.precip_ice_flux(icol,ilev)[s];
-    }
-  });
-
-  Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ncol, npack, Spack::n}), KOKKOS_LAMBDA(int icol, int ilev, int s) {
-    int i    = icol%nx;
-    int j    = (icol/nx)%ny;
-    int icrm = (icol/nx)/ny;
-    int k    = ilev*Spack::n + s;
-    if (k < nlev) {
-      liq_ice_exchange(k,icrm) = history_only.liq_ice_exchange(icol,ilev)[s];
-      vap_liq_exchange(k,icrm) = history_only.vap_liq_exchange(icol,ilev)[s];
-      vap_ice_exchange(k,icrm) = history_only.vap_ice_exchange(icol,ilev)[s];
-    }
+  crm_column_for<Spack>("p3 bridge out t", ncol, nlev, false,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    tabs(k,j,i,icrm) = prog_state.th(icol,ilev)[s]/inv_exner_d(icol,ilev)[s];
+    t(k,j+offy_s,i+offx_s,icrm) = tabs(k,j,i,icrm) + gamaz(k,icrm)
+                  - fac_cond *( qcl(k,j,i,icrm) + qpl(k,j,i,icrm) )
+                  - fac_sub  *( qci(k,j,i,icrm) + qpi(k,j,i,icrm) );
+    t_prev(k,j,i,icrm) = tabs(k,j,i,icrm);
+    q_prev(k,j,i,icrm) = qv(k,j,i,icrm);
   });
 
+  timing.lap(timing.bridge_out);
+  ++timing.ncalls;
 }
 
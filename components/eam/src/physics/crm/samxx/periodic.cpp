@@ -1,6 +1,74 @@
 
 #include "periodic.h"
 
+// Fills, in a single kernel launch, the x/y halos of u, v and w (with the
+// halo widths of periodic(2), only if with_uvw), of t, of the sgs prognostics
+// (if advected) and of the prognostic microphysics fields. The scalars get a
+// halo of hs points on every side. Each CRM is a single periodic subdomain,
+// so every halo point is copied directly from its periodic image.
+void periodic_exchange(bool with_uvw, int hs) {
+  YAKL_SCOPE( u                    , ::u);
+  YAKL_SCOPE( v                    , ::v);
+  YAKL_SCOPE( w                    , ::w);
+  YAKL_SCOPE( t                    , ::t);
+  YAKL_SCOPE( sgs_field            , ::sgs_field);
+  YAKL_SCOPE( micro_field          , ::micro_field);
+  YAKL_SCOPE( micro_prognostic_ind , ::micro_prognostic_ind);
+#ifdef MMF_ESMT
+  YAKL_SCOPE( u_esmt               , ::u_esmt);
+  YAKL_SCOPE( v_esmt               , ::v_esmt);
+  int constexpr nesmt = 2;
+#else
+  int constexpr nesmt = 0;
+#endif
+  YAKL_SCOPE( ncrms                , ::ncrms);
+
+  // Fields are numbered u, v, w (if with_uvw), then t, u_esmt, v_esmt (with
+  // MMF_ESMT), the sgs fields and the microphysics fields
+  int nvel   = with_uvw ? 3 : 0;
+  int nsgs   = (dosgs && advect_sgs) ? nsgs_fields : 0;
+  int nmicro = nmicro_prognostic;
+  int nslot  = nvel + 1 + nesmt + nsgs + nmicro;
+  int hx     = with_uvw ? max(hs,3) : hs;
+  int hy     = RUN3D ? hx : 0;
+
+  // for (int l=0; l<nslot; l++) {
+  //   for (int k=0; k<nz; k++) {
+  //     for (int j=-hy; j<ny+hy; j++) {
+  //       for (int i=-hx; i<nx+hx; i++) {
+  //         for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<5>(nslot,nz,ny+2*hy,nx+2*hx,ncrms) , YAKL_LAMBDA (int l, int k, int j, int i, int icrm) {
+    int jInd = j-hy;
+    int iInd = i-hx;
+    if (jInd >= 0 && jInd < ny && iInd >= 0 && iInd < nx) { return; }
+    // halo widths (west, east, south, north) and vertical size of this field
+    int i1 = hs, i2 = hs, j1 = hs, j2 = hs, dimz = nzm;
+    if      (l == 0 && nvel > 0) { i1 = 2; i2 = 3; j1 = 2; j2 = 2; }
+    else if (l == 1 && nvel > 0) { i1 = 2; i2 = 2; j1 = 2; j2 = 3; }
+    else if (l == 2 && nvel > 0) { i1 = 2; i2 = 2; j1 = 2; j2 = 2; dimz = nz; }
+    if (! RUN3D) { j1 = 0; j2 = 0; }
+    if (k >= dimz || iInd < -i1 || iInd >= nx+i2 || jInd < -j1 || jInd >= ny+j2) { return; }
+    int jSrc = periodic_index(jInd,ny);
+    int iSrc = periodic_index(iInd,nx);
+    int s = l-nvel;
+    if      (s == -3) { u(k,jInd+offy_u,iInd+offx_u,icrm) = u(k,jSrc+offy_u,iSrc+offx_u,icrm); }
+    else if (s == -2) { v(k,jInd+offy_v,iInd+offx_v,icrm) = v(k,jSrc+offy_v,iSrc+offx_v,icrm); }
+    else if (s == -1) { w(k,jInd+offy_w,iInd+offx_w,icrm) = w(k,jSrc+offy_w,iSrc+offx_w,icrm); }
+    else if (s ==  0) { t(k,jInd+offy_s,iInd+offx_s,icrm) = t(k,jSrc+offy_s,iSrc+offx_s,icrm); }
+#ifdef MMF_ESMT
+    else if (s ==  1) { u_esmt(k,jInd+offy_s,iInd+offx_s,icrm) = u_esmt(k,jSrc+offy_s,iSrc+offx_s,icrm); }
+    else if (s ==  2) { v_esmt(k,jInd+offy_s,iInd+offx_s,icrm) = v_esmt(k,jSrc+offy_s,iSrc+offx_s,icrm); }
+#endif
+    else if (s < 1+nesmt+nsgs) {
+      int n = s-1-nesmt;
+      sgs_field(n,k,jInd+offy_s,iInd+offx_s,icrm) = sgs_field(n,k,jSrc+offy_s,iSrc+offx_s,icrm);
+    } else {
+      int n = micro_prognostic_ind(s-1-nesmt-nsgs);
+      micro_field(n,k,jInd+offy_s,iInd+offx_s,icrm) = micro_field(n,k,jSrc+offy_s,iSrc+offx_s,icrm);
+    }
+  });
+}
+
 void periodic(int flag) {
   YAKL_SCOPE( w     , ::w);
   YAKL_SCOPE( sstxy , ::sstxy);
@@ -49,52 +117,16 @@ void periodic(int flag) {
   }
 
   if (flag == 2) {
-    bound_exchange(u,nzm,2,3,2,2, 1);
-    bound_exchange(v,nzm,2,2,2,3, 2);
-    bound_exchange(w,nz,2,2,2,2, 3);
-    bound_exchange(t,nzm,3,3,3,3, 4);
-
-    for (int i=0; i<nsgs_fields; i++) {
-      if (dosgs && advect_sgs) {
-        bound_exchange(sgs_field,i,nzm,3,3,3,3, 4);
-      }
-    }
-
-    for (int i=0; i<nmicro_fields; i++) {
-      if (i == index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
-        bound_exchange(micro_field,i,nzm,3,3,3,3, 4);
-      }
-    }
-#ifdef MMF_ESMT
-    bound_exchange(u_esmt, nzm, 3, 3, 3, 3, 4);
-    bound_exchange(v_esmt, nzm, 3, 3, 3, 3, 4);
-#endif
+    periodic_exchange(true,3);
   }
 
   if (flag == 3) {
-    bound_exchange(t,nzm,1,1,1,1, 4);
-    for (int i=0; i<nsgs_fields; i++) {
-      if (dosgs && advect_sgs) {
-        bound_exchange(sgs_field,i,nzm,1,1,1,1, 4);
-      }
-    }
-
-    for (int i=0; i<nmicro_fields; i++) {
-      if ( i==index_water_vapor || (docloud && flag_precip(i)!=1) || (doprecip && flag_precip(i)==1)) {
-          bound_exchange(micro_field,i,nzm,1,1,1,1, 4);
-      }
-    }
-#ifdef MMF_ESMT
-    bound_exchange(u_esmt, nzm, 1, 1, 1, 1, 4);
-    bound_exchange(v_esmt, nzm, 1, 1, 1, 1, 4);
-#endif
+    periodic_exchange(false,1);
   }
 
   if (flag == 4) {
-    for (int i=0; i<nsgs_fields_diag; i++) {
-      if (dosgs && do_sgsdiag_bound) {
-        bound_exchange(sgs_field_diag,i,nzm,1,1,1,1, 5);
-      }
+    if (dosgs && do_sgsdiag_bound) {
+      bound_exchange(sgs_field_diag,0,nsgs_fields_diag,nzm,1,1,1,1, 5);
     }
   }
 
@@ -5,5 +5,7 @@
 #include "vars.h"
 #include "bound_exchange.h"
 
+void periodic_exchange(bool with_uvw, int hs);
+
 void periodic(int flag);
 
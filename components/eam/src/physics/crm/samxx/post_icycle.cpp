@@ -112,8 +112,8 @@ void post_icycle() {
            yakl::atomicAdd(crm_output_mcudn(l,icrm) , tmp);
          }
       }
-      yakl::atomicAdd(crm_output_gliqwp(l,icrm) , qcl(k,j,i,icrm));
-      yakl::atomicAdd(crm_output_gicewp(l,icrm) , qci(k,j,i,icrm));
+      yakl::atomicAdd(crm_output_gliqwp(l,icrm) , (real) qcl(k,j,i,icrm));
+      yakl::atomicAdd(crm_output_gicewp(l,icrm) , (real) qci(k,j,i,icrm));
     }
   });
 
@@ -129,11 +129,11 @@ void post_icycle() {
     real qsat_tmp;
     real rh_tmp;
 
-    yakl::atomicAdd(crm_rad_temperature(k,j_rad,i_rad,icrm) , tabs(k,j,i,icrm));
+    yakl::atomicAdd(crm_rad_temperature(k,j_rad,i_rad,icrm) , (real) tabs(k,j,i,icrm));
     real tmp = max(0.0,qv(k,j,i,icrm));
     yakl::atomicAdd(crm_rad_qv(k,j_rad,i_rad,icrm) , tmp);
-    yakl::atomicAdd(crm_rad_qc(k,j_rad,i_rad,icrm) , qcl(k,j,i,icrm));
-    yakl::atomicAdd(crm_rad_qi(k,j_rad,i_rad,icrm) , qci(k,j,i,icrm));
+    yakl::atomicAdd(crm_rad_qc(k,j_rad,i_rad,icrm) , (real) qcl(k,j,i,icrm));
+    yakl::atomicAdd(crm_rad_qi(k,j_rad,i_rad,icrm) , (real) qci(k,j,i,icrm));
     if (qcl(k,j,i,icrm) + qci(k,j,i,icrm) > 0) {
       yakl::atomicAdd(crm_rad_cld(k,j_rad,i_rad,icrm) , CF3D(k,j,i,icrm));
     } else {
@@ -162,6 +162,9 @@ void post_timeloop() {
   YAKL_SCOPE( sgs_field               , :: sgs_field );
   YAKL_SCOPE( dtn                     , :: dtn );
   YAKL_SCOPE( crm_output_subcycle_factor, :: crm_output_subcycle_factor );
+  YAKL_SCOPE( crm_output_accel_factor   , :: crm_output_accel_factor );
+  YAKL_SCOPE( crm_accel_deficit         , :: crm_accel_deficit );
+  YAKL_SCOPE( crm_state_accel_deficit   , :: crm_state_accel_deficit );
   YAKL_SCOPE( ncrms                   , :: ncrms );
   YAKL_SCOPE( crm_output_t_vt_tend    , :: crm_output_t_vt_tend );
   YAKL_SCOPE( crm_output_q_vt_tend    , :: crm_output_q_vt_tend );
@@ -259,15 +262,15 @@ void post_timeloop() {
   //      for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
     int l = plev-(k+1);
-    yakl::atomicAdd(tln(l,icrm) , tabs(k,j,i,icrm));
-    yakl::atomicAdd(qln(l,icrm) , qv(k,j,i,icrm));
-    yakl::atomicAdd(qccln(l,icrm) , qcl(k,j,i,icrm));
-    yakl::atomicAdd(qiiln(l,icrm) , qci(k,j,i,icrm));
-    yakl::atomicAdd(uln(l,icrm) , u(k,j+offy_u,i+offx_u,icrm));
-    yakl::atomicAdd(vln(l,icrm) , v(k,j+offy_v,i+offx_v,icrm));
+    yakl::atomicAdd(tln(l,icrm) , (real) tabs(k,j,i,icrm));
+    yakl::atomicAdd(qln(l,icrm) , (real) qv(k,j,i,icrm));
+    yakl::atomicAdd(qccln(l,icrm) , (real) qcl(k,j,i,icrm));
+    yakl::atomicAdd(qiiln(l,icrm) , (real) qci(k,j,i,icrm));
+    yakl::atomicAdd(uln(l,icrm) , (real) u(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(vln(l,icrm) , (real) v(k,j+offy_v,i+offx_v,icrm));
 #ifdef MMF_ESMT
-    yakl::atomicAdd(uln_esmt(l,icrm), u_esmt(k,j+offy_u,i+offx_u,icrm));
-    yakl::atomicAdd(vln_esmt(l,icrm), v_esmt(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(uln_esmt(l,icrm), (real) u_esmt(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(vln_esmt(l,icrm), (real) v_esmt(k,j+offy_u,i+offx_u,icrm));
 #endif
   });
 
@@ -398,9 +401,9 @@ void post_timeloop() {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
     int l = plev-(k+1);
-    yakl::atomicAdd(crm_output_qc_mean(l,icrm) , qcl(k,j,i,icrm));
-    yakl::atomicAdd(crm_output_qi_mean(l,icrm) , qci(k,j,i,icrm));
-    yakl::atomicAdd(crm_output_qr_mean(l,icrm) , qpl(k,j,i,icrm));
+    yakl::atomicAdd(crm_output_qc_mean(l,icrm) , (real) qcl(k,j,i,icrm));
+    yakl::atomicAdd(crm_output_qi_mean(l,icrm) , (real) qci(k,j,i,icrm));
+    yakl::atomicAdd(crm_output_qr_mean(l,icrm) , (real) qpl(k,j,i,icrm));
     real omg = max(0.0,min(1.0,(tabs(k,j,i,icrm)-tgrmin)*a_gr));
 
     real tmp = qpi(k,j,i,icrm)*omg;
@@ -583,6 +586,10 @@ void post_timeloop() {
 
   parallel_for( ncrms , YAKL_LAMBDA(int icrm) {
     crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)/((real) nstop);
+    // time-mean mean-state acceleration factor actually applied
+    crm_output_accel_factor(icrm) = crm_output_accel_factor(icrm)/((real) nstop);
+    // carry the unpaid adaptive MSA deficit over to the next GCM step
+    crm_state_accel_deficit(icrm) = crm_accel_deficit(icrm);
   });
 }
 
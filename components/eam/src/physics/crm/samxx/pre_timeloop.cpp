@@ -114,6 +114,9 @@ void pre_timeloop() {
   YAKL_SCOPE( ustar                     , :: ustar );
   YAKL_SCOPE( z0                        , :: z0 );
   YAKL_SCOPE( crm_output_subcycle_factor , :: crm_output_subcycle_factor );
+  YAKL_SCOPE( crm_output_accel_factor    , :: crm_output_accel_factor );
+  YAKL_SCOPE( crm_accel_deficit          , :: crm_accel_deficit );
+  YAKL_SCOPE( crm_state_accel_deficit    , :: crm_state_accel_deficit );
   YAKL_SCOPE( rhow                       , :: rhow );
   YAKL_SCOPE( qv                         , :: qv );
   YAKL_SCOPE( CF3D                       , :: CF3D );
@@ -376,6 +379,10 @@ void pre_timeloop() {
   if (turbulence_scheme == turbulence::smag) { sgs_init(); }
   if (turbulence_scheme == turbulence::shoc) { shoc_initialize(); }
 
+  // cache the list of prognostic microphysics fields used by advection and
+  // the boundary exchange
+  set_micro_prognostic_fields();
+
   // for (int k=0; k<nzm; k++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<2>(nzm,ncrms) , YAKL_LAMBDA (int k, int icrm) {
@@ -399,24 +406,24 @@ void pre_timeloop() {
     t(k,j+offy_s,i+offx_s,icrm) = tabs(k,j,i,icrm)+gamaz(k,icrm)-fac_cond*qcl(k,j,i,icrm)-fac_sub*qci(k,j,i,icrm) -
                                                                  fac_cond*qpl(k,j,i,icrm)-fac_sub*qpi(k,j,i,icrm);
 
-    yakl::atomicAdd(u0(k,icrm) , u(k,j+offy_u,i+offx_u,icrm));
-    yakl::atomicAdd(v0(k,icrm) , v(k,j+offy_v,i+offx_v,icrm));
-    yakl::atomicAdd(t0(k,icrm) , t(k,j+offy_s,i+offx_s,icrm));
+    yakl::atomicAdd(u0(k,icrm) , (real) u(k,j+offy_u,i+offx_u,icrm));
+    yakl::atomicAdd(v0(k,icrm) , (real) v(k,j+offy_v,i+offx_v,icrm));
+    yakl::atomicAdd(t0(k,icrm) , (real) t(k,j+offy_s,i+offx_s,icrm));
 
     real tmp = t(k,j+offy_s,i+offx_s,icrm)+fac_cond*qpl(k,j,i,icrm)+fac_sub*qpi(k,j,i,icrm);
     yakl::atomicAdd(t00(k,icrm) , tmp);
-    yakl::atomicAdd(tabs0(k,icrm) , tabs(k,j,i,icrm));
+    yakl::atomicAdd(tabs0(k,icrm) , (real) tabs(k,j,i,icrm));
 
     tmp = qv(k,j,i,icrm)+qcl(k,j,i,icrm)+qci(k,j,i,icrm);
     yakl::atomicAdd(q0(k,icrm) , tmp);
-    yakl::atomicAdd(qv0(k,icrm) , qv(k,j,i,icrm));
+    yakl::atomicAdd(qv0(k,icrm) , (real) qv(k,j,i,icrm));
 
     tmp = qcl(k,j,i,icrm) + qci(k,j,i,icrm);
     yakl::atomicAdd(qn0(k,icrm) , tmp);
 
     tmp = qpl(k,j,i,icrm) + qpi(k,j,i,icrm);
     yakl::atomicAdd(qp0(k,icrm) , tmp);
-    yakl::atomicAdd(tke0(k,icrm) , sgs_field(0,k,j+offy_s,i+offx_s,icrm));
+    yakl::atomicAdd(tke0(k,icrm) , (real) sgs_field(0,k,j+offy_s,i+offx_s,icrm));
   });
 
   if (use_VT) { VT_diagnose(); }
@@ -467,6 +474,8 @@ void pre_timeloop() {
     z0_est(z(0,icrm),bflx(icrm),wnd(icrm),ustar(icrm),z0(icrm));
     z0(icrm) = max(0.00001,min(1.0,z0(icrm)));
     crm_output_subcycle_factor(icrm) = 0.0;
+    crm_output_accel_factor(icrm) = 0.0;
+    crm_accel_deficit(icrm) = crm_state_accel_deficit(icrm);
   });
 
 //---------------------------------------------------
@@ -1,7 +1,7 @@
 
 #include "precip_proc.h"
 
-void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
+void precip_proc(crmReal5d &q, int ind_q, crmReal5d &qp, int ind_qp) {
   YAKL_SCOPE( tabs          , :: tabs );
   YAKL_SCOPE( a_bg          , :: a_bg );
   YAKL_SCOPE( a_pr          , :: a_pr );
@@ -134,7 +134,7 @@ void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
       } else { 
 
         q(ind_q,k,j+offy_s,i+offx_s,icrm) = q(ind_q,k,j+offy_s,i+offx_s,icrm) + qp(ind_qp,k,j+offy_s,i+offx_s,icrm);
-        yakl::atomicAdd(qpevp(k,icrm),-qp(ind_qp,k,j+offy_s,i+offx_s,icrm));
+        yakl::atomicAdd(qpevp(k,icrm),-(real) qp(ind_qp,k,j+offy_s,i+offx_s,icrm));
         qp(ind_qp,k,j+offy_s,i+offx_s,icrm) = 0.0;
 
       }
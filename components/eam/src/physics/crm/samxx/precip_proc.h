@@ -5,5 +5,5 @@
 #include "vars.h"
 #include "sat.h"
 
-void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp);
+void precip_proc(crmReal5d &q, int ind_q, crmReal5d &qp, int ind_qp);
 
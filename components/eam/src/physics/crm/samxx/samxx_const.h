@@ -33,6 +33,26 @@ void DEBUG_SCALAR(T var) {
 typedef double real;
 // using real = typename scream::Real;
 
+// Storage type of the CRM prognostic state (u, v, w, t, micro_field,
+// sgs_field, ...) and of the advection/diffusion scratch arrays. Building
+// with -DCRM_SINGLE_PRECISION stores them in float to halve the memory
+// traffic of the bandwidth-bound kernels. Accumulators (statistics in
+// post_timeloop, horizontal means) and the pressure solve stay in real.
+#ifdef CRM_SINGLE_PRECISION
+typedef float crm_real;
+#else
+typedef double crm_real;
+#endif
+
+#ifdef CRM_SINGLE_PRECISION
+// yakl::min/max need both arguments of the same type; expressions mixing
+// crm_real state with real constants or accumulators promote to real.
+YAKL_INLINE real min(real a, crm_real b) { return a < b ? a : b; }
+YAKL_INLINE real min(crm_real a, real b) { return a < b ? a : b; }
+YAKL_INLINE real max(real a, crm_real b) { return a > b ? a : b; }
+YAKL_INLINE real max(crm_real a, real b) { return a > b ? a : b; }
+#endif
+
 int  constexpr crm_nx     = CRM_NX;
 int  constexpr crm_ny     = CRM_NY;
 int  constexpr crm_nz     = CRM_NZ;
@@ -312,6 +332,14 @@ typedef yakl::Array<real,5,yakl::memDevice,yakl::styleC> real5d;
 typedef yakl::Array<real,6,yakl::memDevice,yakl::styleC> real6d;
 typedef yakl::Array<real,7,yakl::memDevice,yakl::styleC> real7d;
 
+typedef yakl::Array<crm_real,1,yakl::memDevice,yakl::styleC> crmReal1d;
+typedef yakl::Array<crm_real,2,yakl::memDevice,yakl::styleC> crmReal2d;
+typedef yakl::Array<crm_real,3,yakl::memDevice,yakl::styleC> crmReal3d;
+typedef yakl::Array<crm_real,4,yakl::memDevice,yakl::styleC> crmReal4d;
+typedef yakl::Array<crm_real,5,yakl::memDevice,yakl::styleC> crmReal5d;
+typedef yakl::Array<crm_real,6,yakl::memDevice,yakl::styleC> crmReal6d;
+typedef yakl::Array<crm_real,7,yakl::memDevice,yakl::styleC> crmReal7d;
+
 typedef yakl::Array<int,1,yakl::memDevice,yakl::styleC> int1d;
 typedef yakl::Array<int,2,yakl::memDevice,yakl::styleC> int2d;
 typedef yakl::Array<int,3,yakl::memDevice,yakl::styleC> int3d;
@@ -1,6 +1,9 @@
 
 #pragma once
 
+#include <cstdio>
+#include <cstdlib>
+#include <string>
 #include <type_traits>
 
 #include "samxx_const.h"
@@ -190,6 +193,90 @@ void view_to_array(const ViewT& view,
   });
 }
 
+// Loop over the packed (icol, ilev, s) entries of nlev-level P3/SHOC columns,
+// calling f(icol, ilev, s, k, j, i, icrm) with the CRM indices of each entry,
+// where icol = i+nx*(j+ny*icrm) and k = ilev*PackT::n+s, or nlev-1-(ilev*PackT::n+s)
+// if flip is true (SHOC numbers levels from the model top). Packing the CRM
+// arrays into the packed views (or unpacking them back) inside f touches each
+// value once, instead of staging it in a YAKL (icol,ilev) array that is then
+// copied by array_to_view/view_to_array. Pack padding is skipped.
+template <typename PackT, typename F>
+void crm_column_for(const char* name, const int ncol, const int nlev, const bool flip, const F& f)
+{
+  const int pack_size = static_cast<int>(PackT::n);
+  const int npack     = (nlev+pack_size-1)/pack_size;
+
+#if defined(DEBUG)
+  kokkos_impl_cuda_set_serial_execution(true);
+#endif
+  Kokkos::parallel_for(name, Kokkos::MDRangePolicy<Kokkos::Rank<3>>({0, 0, 0}, {ncol, npack, pack_size}), KOKKOS_LAMBDA(int icol, int ilev, int s) {
+    const int lev = ilev*pack_size + s;
+    if (lev >= nlev) return;
+    const int i    = icol%nx;
+    const int j    = (icol/nx)%ny;
+    const int icrm = (icol/nx)/ny;
+    const int k    = flip ? nlev-(lev+1) : lev;
+    f(icol, ilev, s, k, j, i, icrm);
+  });
+}
+
+// Accumulated wall-clock time of the P3/SHOC calls, split between the bridges
+// that move the CRM state in and out of the packed column views and the
+// p3_main/shoc_main calls themselves. Only measured if CRM_BRIDGE_TIMING=1 is
+// set in the environment, since every lap fences.
+class BridgeTiming {
+public:
+  BridgeTiming (const char* name) : m_name(name) {}
+
+  static bool enabled () {
+    static const bool on = [] {
+      const char* env = std::getenv("CRM_BRIDGE_TIMING");
+      return env != nullptr && std::string(env) == "1";
+    }();
+    return on;
+  }
+
+  // Restart the clock, e.g., to leave setup work out of the next lap.
+  void start () {
+    if (!enabled()) return;
+    Kokkos::fence();
+    m_timer.reset();
+  }
+
+  // Charge the time since the last start/lap to phase, and restart the clock.
+  void lap (double& phase) {
+    if (!enabled()) return;
+    Kokkos::fence();
+    phase += m_timer.seconds();
+    m_timer.reset();
+  }
+
+  void report () const {
+    if (!enabled() || ncalls == 0) return;
+    printf("%s bridge timing: calls=%d, in=%13.6e, main=%13.6e, out=%13.6e, (in+out)/main=%8.4f\n",
+           m_name, ncalls, bridge_in, main, bridge_out, main > 0 ? (bridge_in+bridge_out)/main : 0.);
+  }
+
+  int    ncalls     = 0;
+  double bridge_in  = 0;
+  double main       = 0;
+  double bridge_out = 0;
+
+private:
+  const char*   m_name;
+  Kokkos::Timer m_timer;
+};
+
+inline BridgeTiming& p3_bridge_timing () {
+  static BridgeTiming timing("p3");
+  return timing;
+}
+
+inline BridgeTiming& shoc_bridge_timing () {
+  static BridgeTiming timing("shoc");
+  return timing;
+}
+
 // validation code 
 template <typename SizeT, typename ViewT>
 void array_to_view_2d(typename ViewT::value_type::scalar* data,
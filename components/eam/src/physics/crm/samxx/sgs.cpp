@@ -26,7 +26,7 @@ void kurant_sgs(real &cfl) {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_DEVICE_LAMBDA (int k, int j, int i, int icrm) {
-    yakl::atomicMax( tkhmax(k,icrm) , sgs_field_diag(1,k,offy_d+j,offx_d+i,icrm) );
+    yakl::atomicMax( tkhmax(k,icrm) , (real) sgs_field_diag(1,k,offy_d+j,offx_d+i,icrm) );
   });
 
   // for (int k=0; k<nzm; k++) {
@@ -37,7 +37,6 @@ void shoc_proc() {
   YAKL_SCOPE( ncrms          , :: ncrms);
   YAKL_SCOPE( dx             , :: dx);
   YAKL_SCOPE( dy             , :: dy);
-  YAKL_SCOPE( dz             , :: dz);
   YAKL_SCOPE( u              , :: u);
   YAKL_SCOPE( v              , :: v);
   YAKL_SCOPE( w              , :: w);
@@ -80,95 +79,96 @@ void shoc_proc() {
   // const Real shoc_ice_deep = 25.e-6;
   // const Real shoc_ice_sh   = 50.e-6;
 
-  real2d inv_exner("inv_exner", ncol, nlev);
-  real2d shoc_qw("shoc_qw", ncol, nlev); // total water (vapor + cloud liquid)
-  real2d shoc_ql("shoc_ql", ncol, nlev); // cloud liquid water
-  real2d thlm("thlm", ncol, nlev);
-  real2d thv("thv", ncol, nlev);
-  real2d dz_g("dz_g", ncol, nlev);
-  real2d zt_g("zt_g", ncol, nlev);
-  real2d zi_g("zi_g", ncol, nlevi);
-  real2d rrho("rrho", ncol, nlev);
-  real2d wm_zt("wm_zt", ncol, nlev);
-  real2d tke("tke", ncol, nlev);
-  real2d tk("tk", ncol, nlev);
-  real2d tkh("tkh", ncol, nlev);
-  real2d wthv("wthv", ncol, nlev);
-  real2d pmid("pmid", ncol, nlev);
-  real2d pdel("pdel", ncol, nlev);
-  real2d pint("pint", ncol, nlevi);
-  real2d shoc_dse("shoc_dse", ncol, nlev);
-  real2d shoc_cldfrac("shoc_cldfrac", ncol, nlev);
-  real3d shoc_hwind("shoc_hwind", ncol, 2, nlev);
-  real3d qtracers("qtracers", ncol, num_shoc_tracers, nlev);
+  auto& timing = shoc_bridge_timing();
+  timing.start();
 
-  // ------------------------------------------------- 
-  // Set input state for SHOC
-  // -------------------------------------------------
-  parallel_for( SimpleBounds<4>(nzm, ny, nx, ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+ny*icrm);
-    int ilev = nzm-(k+1);
-
-    pmid(icol,ilev)  = 100.*pmid_in(k,icrm);
-    pdel(icol,ilev)  = 100.*pdel_in(k,icrm);
+  view_2d zt_grid_2d("zt_grid", ncol, npack),                 // heights, for thermo grid [m]
+          zi_grid_2d("zi_grid", ncol, nipack),                // heights, for interface grid [m]
+          pmid_2d("pmid", ncol, npack),                       // pressure levels on thermo grid [Pa]
+          pint_2d("pint", ncol, nipack),                      // pressure levels on interface grid [Pa]
+          pdel_2d("pdel", ncol, npack),                       // Differences in pressure levels [Pa]
+          thv_2d("thv", ncol, npack),                         // virtual potential temperature [K]
+          w_field_2d("w_field", ncol, npack),                 // large scale vertical velocity [m/s]
+          wtracer_sfc_2d("wtracer", ncol, num_shoc_tracers),  // Surface flux for tracers [varies]
+          inv_exner_2d("inv_exner", ncol, npack);
 
-    inv_exner(icol,ilev) = 1./std::pow((pmid_in(k,icrm)*1.0e-3), (rgas/cp));
+  view_2d host_dse_2d("host_dse", ncol, npack);                 // dry static energy [J/kg] : dse = Cp*T + g*z + phis
+  view_2d tke_2d("tke", ncol, npack);                           // turbulent kinetic energy [m2/s2]
+  view_2d thetal_2d("thetal", ncol, npack);                     // liquid water potential temperature [K]
+  view_2d shoc_qw_2d("shoc_qw", ncol, npack);                   // total water mixing ratio [kg/kg]
+  view_2d shoc_ql_2d("shoc_ql", ncol, npack);                   // cloud liquid mixing ratio [kg/kg]
+  view_2d wthv_sec_2d("wthv_sec", ncol, npack);                 // buoyancy flux [K m/s]
+  view_2d tk_2d("tk", ncol, npack);                             // eddy coefficient for momentum [m2/s]
+  view_2d tkh_2d("tkh", ncol, npack);                           // eddy heat conductivity [m2/s]
+  view_2d shoc_cldfrac_2d("shoc_cldfrac", ncol, npack);         // Cloud fraction [-]
+  view_3d shoc_hwind_3d("shoc_hwind",ncol,2,npack);             // Vector-valued wind (u,v) [m/s]
+  view_3d qtracers_3d("qtracers",ncol,num_shoc_tracers,npack);  // tracers [varies]
 
-    dz_g(icol,ilev)   = dz(icrm);
-    zt_g(icol,ilev)   = z(k,icrm);
+  // ------------------------------------------------- 
+  // Set input state for SHOC, packing it straight from the CRM arrays
+  // (SHOC levels are numbered from the model top)
+  // -------------------------------------------------
+  crm_column_for<Spack>("shoc bridge in", ncol, nlev, true,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    const real inv_exner = 1./std::pow((pmid_in(k,icrm)*1.0e-3), (rgas/cp));
 
-    rrho(icol,ilev)   = (1./ggr)*(pdel(icol,ilev)/dz_g(icol,ilev));
-    wm_zt(icol,ilev)  = w(k,j+offy_w,i+offx_w,icrm);
+    pmid_2d(icol,ilev)[s]      = 100.*pmid_in(k,icrm);
+    pdel_2d(icol,ilev)[s]      = 100.*pdel_in(k,icrm);
+    inv_exner_2d(icol,ilev)[s] = inv_exner;
+    zt_grid_2d(icol,ilev)[s]   = z(k,icrm);
+    w_field_2d(icol,ilev)[s]   = w(k,j+offy_w,i+offx_w,icrm);
 
-    shoc_qw(icol,ilev) = qv(k,j,i,icrm) + qcl(k,j,i,icrm);
-    shoc_ql(icol,ilev) = qcl(k,j,i,icrm);
+    shoc_qw_2d(icol,ilev)[s] = qv(k,j,i,icrm) + qcl(k,j,i,icrm);
+    shoc_ql_2d(icol,ilev)[s] = qcl(k,j,i,icrm);
 
-    shoc_hwind(icol,0,ilev) = u(k,j+offy_u,i+offx_u,icrm);
-    shoc_hwind(icol,1,ilev) = v(k,j+offy_v,i+offx_v,icrm);
+    shoc_hwind_3d(icol,0,ilev)[s] = u(k,j+offy_u,i+offx_u,icrm);
+    shoc_hwind_3d(icol,1,ilev)[s] = v(k,j+offy_v,i+offx_v,icrm);
 
     tabs(k,j,i,icrm) = t(k,j+offy_s,i+offx_s,icrm) - gamaz(k,icrm)
                       + fac_cond *( qcl(k,j,i,icrm) + qpl(k,j,i,icrm) ) 
                       + fac_sub  *( qci(k,j,i,icrm) + qpi(k,j,i,icrm) );
 
-    real theta_zt = tabs(k,j,i,icrm) * inv_exner(icol, ilev);
-    thlm(icol,ilev) = theta_zt - (theta_zt/tabs(k,j,i,icrm)) * (latvap/cp)*qcl(k,j,i,icrm);
-    thv(icol,ilev)  = theta_zt*(1 + zvir*qv(k,j,i,icrm) - qcl(k,j,i,icrm));
-    shoc_dse(icol,ilev) = cp*tabs(k,j,i,icrm) + ggr*z(k,icrm) + phis(icrm);
+    real theta_zt = tabs(k,j,i,icrm) * inv_exner;
+    thetal_2d(icol,ilev)[s]   = theta_zt - (theta_zt/tabs(k,j,i,icrm)) * (latvap/cp)*qcl(k,j,i,icrm);
+    thv_2d(icol,ilev)[s]      = theta_zt*(1 + zvir*qv(k,j,i,icrm) - qcl(k,j,i,icrm));
+    host_dse_2d(icol,ilev)[s] = cp*tabs(k,j,i,icrm) + ggr*z(k,icrm) + phis(icrm);
 
-    tke (icol,ilev) = max(shoc_min_tke, sgs_field(0,k,j+offy_s,i+offx_s,icrm) ); // enforce min TKE value - same as SCREAM
-    tk  (icol,ilev) = sgs_field_diag(0,k,j+offy_d,i+offx_d,icrm);
-    tkh (icol,ilev) = sgs_field_diag(1,k,j+offy_d,i+offx_d,icrm);
-    wthv(icol,ilev) = sgs_field_diag(2,k,j+offy_d,i+offx_d,icrm);
+    const real tke = max(shoc_min_tke, sgs_field(0,k,j+offy_s,i+offx_s,icrm) ); // enforce min TKE value - same as SCREAM
+    tke_2d(icol,ilev)[s]      = tke;
+    tk_2d(icol,ilev)[s]       = sgs_field_diag(0,k,j+offy_d,i+offx_d,icrm);
+    tkh_2d(icol,ilev)[s]      = sgs_field_diag(1,k,j+offy_d,i+offx_d,icrm);
+    wthv_sec_2d(icol,ilev)[s] = sgs_field_diag(2,k,j+offy_d,i+offx_d,icrm);
 
     // Cloud fraction needs to be initialized for first PBL height calculation
-    shoc_cldfrac(icol,ilev) = CF3D(k,j,i,icrm);
-
-    qtracers(icol,shoc_idx_qv,ilev) = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm)
-                                    - micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_nc,ilev) = micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_qr,ilev) = micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_nr,ilev) = micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_qi,ilev) = micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_qm,ilev) = micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_ni,ilev) = micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_bm,ilev) = micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm);
-    qtracers(icol,shoc_idx_qc,ilev) = micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm);
-    // qtracers(icol,shoc_idx_tke,ilev)= sgs_field(0,k,offy_s+j,offx_s+i,icrm);
-    qtracers(icol,shoc_idx_tke,ilev)= tke (icol,ilev);
+    shoc_cldfrac_2d(icol,ilev)[s] = CF3D(k,j,i,icrm);
+
+    qtracers_3d(icol,shoc_idx_qv,ilev)[s] = micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm)
+                                          - micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_nc,ilev)[s] = micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_qr,ilev)[s] = micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_nr,ilev)[s] = micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_qi,ilev)[s] = micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_qm,ilev)[s] = micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_ni,ilev)[s] = micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_bm,ilev)[s] = micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm);
+    qtracers_3d(icol,shoc_idx_qc,ilev)[s] = micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm);
+    // qtracers_3d(icol,shoc_idx_tke,ilev)[s] = sgs_field(0,k,offy_s+j,offx_s+i,icrm);
+    qtracers_3d(icol,shoc_idx_tke,ilev)[s]= tke;
 
     // if (use_ESMT) {
-    //   qtracers(icol,shoc_idx_esmt_u,ilev) = u_esmt(k,j,i,icrm)
-    //   qtracers(icol,shoc_idx_esmt_v,ilev) = v_esmt(k,j,i,icrm)
+    //   qtracers_3d(icol,shoc_idx_esmt_u,ilev)[s] = u_esmt(k,j,i,icrm)
+    //   qtracers_3d(icol,shoc_idx_esmt_v,ilev)[s] = v_esmt(k,j,i,icrm)
     // }
   });
 
-  parallel_for( SimpleBounds<4>(nz, ny, nx, ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+ny*icrm);
-    int ilev = nz-(k+1);
-    zi_g(icol,ilev) = zi(k,icrm);
-    pint(icol,ilev) = 100.*pint_in(k,icrm);
+  crm_column_for<Spack>("shoc bridge in, interfaces", ncol, nlevi, true,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    zi_grid_2d(icol,ilev)[s] = zi(k,icrm);
+    pint_2d(icol,ilev)[s]    = 100.*pint_in(k,icrm);
   });
 
+  timing.lap(timing.bridge_in);
+
   // -------------------------------------------------
   // Set surface geopotential and fluxes
   // -------------------------------------------------
@@ -207,25 +207,6 @@ void shoc_proc() {
     phis_1d(icol)     = phis.myData[icrm];//*100.0;
   });
 
-  view_2d zt_grid_2d("zt_grid", ncol, npack),                 // heights, for thermo grid [m]
-          zi_grid_2d("zi_grid", ncol, nipack),                // heights, for interface grid [m]
-          pmid_2d("pmid", ncol, npack),                       // pressure levels on thermo grid [Pa]
-          pint_2d("pint", ncol, nipack),                      // pressure levels on interface grid [Pa]
-          pdel_2d("pdel", ncol, npack),                       // Differences in pressure levels [Pa]
-          thv_2d("thv", ncol, npack),                         // virtual potential temperature [K]
-          w_field_2d("w_field", ncol, npack),                 // large scale vertical velocity [m/s]
-          wtracer_sfc_2d("wtracer", ncol, num_shoc_tracers),  // Surface flux for tracers [varies]
-          inv_exner_2d("inv_exner", ncol, npack);
-
-  array_to_view(zt_g.myData,      ncol, nlev,  zt_grid_2d);
-  array_to_view(zi_g.myData,      ncol, nlevi, zi_grid_2d);
-  array_to_view(pmid.myData,      ncol, nlev,  pmid_2d);
-  array_to_view(pint.myData,      ncol, nlevi, pint_2d);
-  array_to_view(pdel.myData,      ncol, nlev,  pdel_2d);
-  array_to_view(inv_exner.myData, ncol, nlev,  inv_exner_2d);
-  array_to_view(thv.myData,       ncol, nlev,  thv_2d);
-  array_to_view(wm_zt.myData,     ncol, nlev,  w_field_2d);
-
   Kokkos::parallel_for(Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {ncol, num_shoc_tracers}), KOKKOS_LAMBDA(int icol, int itrc) {
     wtracer_sfc_2d(icol,itrc) = 0.;
   });
@@ -235,30 +216,6 @@ void shoc_proc() {
                             w_field_2d, wthl_sfc_1d, wqw_sfc_1d, uw_sfc_1d,
                             vw_sfc_1d, wtracer_sfc_2d, inv_exner_2d, phis_1d};
 
-  view_2d host_dse_2d("host_dse", ncol, npack);                 // dry static energy [J/kg] : dse = Cp*T + g*z + phis
-  view_2d tke_2d("tke", ncol, npack);                           // turbulent kinetic energy [m2/s2]
-  view_2d thetal_2d("thetal", ncol, npack);                     // liquid water potential temperature [K]
-  view_2d shoc_qw_2d("shoc_qw", ncol, npack);                   // total water mixing ratio [kg/kg]
-  view_2d shoc_ql_2d("shoc_ql", ncol, npack);                   // Vector-valued wind (u,v) [m/s]
-  view_2d wthv_sec_2d("wthv_sec", ncol, npack);                 // buoyancy flux [K m/s]
-  view_2d tk_2d("tk", ncol, npack);                             // tracers [varies]
-  view_2d tkh_2d("tkh", ncol, npack);                           // eddy coefficient for momentum [m2/s]
-  view_2d shoc_cldfrac_2d("shoc_cldfrac", ncol, npack);         // eddy heat conductivity
-  view_3d shoc_hwind_3d("shoc_hwind",ncol,2,npack);             // Cloud fraction [-]
-  view_3d qtracers_3d("qtracers",ncol,num_shoc_tracers,npack);  // cloud liquid mixing ratio [kg/kg]
-
-  array_to_view(shoc_dse.myData,     ncol, nlev, host_dse_2d);
-  array_to_view(tke.myData,          ncol, nlev, tke_2d);
-  array_to_view(thlm.myData,         ncol, nlev, thetal_2d);
-  array_to_view(shoc_qw.myData,      ncol, nlev, shoc_qw_2d);
-  array_to_view(shoc_ql.myData,      ncol, nlev, shoc_ql_2d);
-  array_to_view(tk.myData,           ncol, nlev, tk_2d);
-  array_to_view(tkh.myData,          ncol, nlev, tkh_2d);
-  array_to_view(wthv.myData,         ncol, nlev, wthv_sec_2d);
-  array_to_view(shoc_cldfrac.myData, ncol, nlev, shoc_cldfrac_2d);
-  array_to_view(shoc_hwind.myData, ncol, 2, nlev, shoc_hwind_3d);
-  array_to_view(qtracers.myData, ncol, num_shoc_tracers, nlev, qtracers_3d);
-
   SHOC::SHOCInputOutput shoc_input_output{host_dse_2d, tke_2d, thetal_2d, shoc_qw_2d,
                                          shoc_hwind_3d, wthv_sec_2d, qtracers_3d,
                                          tk_2d, tkh_2d, shoc_cldfrac_2d, shoc_ql_2d};
@@ -291,62 +248,56 @@ void shoc_proc() {
   const auto policy = ekat::ExeSpaceUtils<SHOC::KT::ExeSpace>::get_default_team_policy(ncol, npack);
   ekat::WorkspaceManager<Spack, SHOC::KT::Device> workspace_mgr(nipack, 128+(nwind+ntrac), policy);
 
+  timing.start();
+
   const auto elapsed_microsec = SHOC::shoc_main(ncol, nlev, nlevi, nlev, 1, num_shoc_tracers, dtime, workspace_mgr,
                                                 shoc_input, shoc_input_output, shoc_output, shoc_history_output);
 
-  // get SHOC output back to CRM 
-  view_to_array(shoc_input_output.tk,   ncol, nlev, tk);
-  view_to_array(shoc_input_output.tkh,  ncol, nlev, tkh);
-  view_to_array(shoc_input_output.wthv_sec, ncol, nlev, wthv);
-  // view_to_array(shoc_input_output.tke, ncol, nlev, tke);
-  view_to_array(shoc_input_output.shoc_cldfrac, ncol, nlev, shoc_cldfrac);
-  view_to_array(shoc_input_output.horiz_wind, ncol, 2, nlev, shoc_hwind);
-  view_to_array(shoc_input_output.host_dse, ncol, nlev, shoc_dse);
-  view_to_array(shoc_input_output.qtracers, ncol, num_shoc_tracers, nlev, qtracers);
+  timing.lap(timing.main);
+
+  // get SHOC output back to CRM: update tracers, TKE, winds and SGS diagnostics
+  crm_column_for<Spack>("shoc bridge out", ncol, nlev, true,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    const auto& qtracers = shoc_input_output.qtracers;
+    micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qv,ilev)[s]
+                                                 + qtracers(icol,shoc_idx_qc,ilev)[s];
+    micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_nc,ilev)[s];
+    micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qr,ilev)[s];
+    micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_nr,ilev)[s];
+    micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qi,ilev)[s];
+    micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qm,ilev)[s];
+    micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_ni,ilev)[s];
+    micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_bm,ilev)[s];
+    micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qc,ilev)[s];
+    sgs_field(0,k,offy_s+j,offx_s+i,icrm)        = qtracers(icol,shoc_idx_tke,ilev)[s];
+
+    u(k,j+offy_u,i+offx_u,icrm) = shoc_input_output.horiz_wind(icol,0,ilev)[s];
+    v(k,j+offy_v,i+offx_v,icrm) = shoc_input_output.horiz_wind(icol,1,ilev)[s];
+    // sgs_field(0,k,offy_s+j,offx_s+i,icrm)      = shoc_input_output.tke(icol,ilev)[s];
+    sgs_field_diag(0,k,offy_d+j,offx_d+i,icrm) = shoc_input_output.tk(icol,ilev)[s];
+    sgs_field_diag(1,k,offy_d+j,offx_d+i,icrm) = shoc_input_output.tkh(icol,ilev)[s];
+    sgs_field_diag(2,k,offy_d+j,offx_d+i,icrm) = shoc_input_output.wthv_sec(icol,ilev)[s];
+    CF3D(k,j,i,icrm) = shoc_input_output.shoc_cldfrac(icol,ilev)[s];
 
-
-  // update tracers and TKE
-  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+ny*icrm);
-    int ilev = nzm-(k+1);
-    micro_field(idx_qt,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qv,ilev)
-                                                 + qtracers(icol,shoc_idx_qc,ilev);
-    micro_field(idx_nc,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_nc,ilev);
-    micro_field(idx_qr,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qr,ilev);
-    micro_field(idx_nr,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_nr,ilev);
-    micro_field(idx_qi,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qi,ilev);
-    micro_field(idx_qm,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qm,ilev);
-    micro_field(idx_ni,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_ni,ilev);
-    micro_field(idx_bm,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_bm,ilev);
-    micro_field(idx_qc,k,j+offy_s,i+offx_s,icrm) = qtracers(icol,shoc_idx_qc,ilev);
-    sgs_field(0,k,offy_s+j,offx_s+i,icrm)        = qtracers(icol,shoc_idx_tke,ilev);
+    // if (use_ESMT) {
+    //   u_esmt(k,j,i,icrm) = qtracers(icol,shoc_idx_esmt_u,ilev)[s]
+    //   v_esmt(k,j,i,icrm) = qtracers(icol,shoc_idx_esmt_v,ilev)[s]
+    // }
   });
 
   // update diagnostic micro fields based on micro scheme
   if (microphysics_scheme == microphysics::sam1mom) { micro_diagnose(); }
   if (microphysics_scheme == microphysics::p3) { micro_p3_diagnose(); }
 
-  // update other variables
-  parallel_for( SimpleBounds<4>(nzm, ny, nx, ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int icol = i+nx*(j+ny*icrm);
-    int ilev = nzm-(k+1);
-    tabs(k,j,i,icrm) = ( shoc_dse(icol,ilev) - ggr*z(k,icrm) - phis(icrm) )/cp;
+  // update temperature, which needs the updated diagnostic micro fields
+  crm_column_for<Spack>("shoc bridge out t", ncol, nlev, true,
+                        KOKKOS_LAMBDA(int icol, int ilev, int s, int k, int j, int i, int icrm) {
+    tabs(k,j,i,icrm) = ( shoc_input_output.host_dse(icol,ilev)[s] - ggr*z(k,icrm) - phis(icrm) )/cp;
     t(k,j+offy_s,i+offx_s,icrm) = tabs(k,j,i,icrm) + gamaz(k,icrm)
                   - fac_cond *( qcl(k,j,i,icrm) - qpl(k,j,i,icrm) )
                   - fac_sub  *( qci(k,j,i,icrm) - qpi(k,j,i,icrm) );
-    u(k,j+offy_u,i+offx_u,icrm) = shoc_hwind(icol,0,ilev);
-    v(k,j+offy_v,i+offx_v,icrm) = shoc_hwind(icol,1,ilev);
-    // sgs_field(0,k,offy_s+j,offx_s+i,icrm)      = tke(icol,nlev-(ilev+1));
-    sgs_field_diag(0,k,offy_d+j,offx_d+i,icrm) = tk(icol,ilev);
-    sgs_field_diag(1,k,offy_d+j,offx_d+i,icrm) = tkh(icol,ilev);
-    sgs_field_diag(2,k,offy_d+j,offx_d+i,icrm) = wthv(icol,ilev);
-    CF3D(k,j,i,icrm) = shoc_cldfrac(icol,ilev);
-
-    // if (use_ESMT) {
-    //   u_esmt(k,j,i,icrm) = qtracers(icol,shoc_idx_esmt_u,ilev)
-    //   v_esmt(k,j,i,icrm) = qtracers(icol,shoc_idx_esmt_v,ilev)
-    // }
-
   });
 
+  timing.lap(timing.bridge_out);
+  ++timing.ncalls;
 }
@@ -11,6 +11,8 @@ function usage {
   printf "NetCDF binaries must include ncdump, nf-config, and nc-config\n\n"
   printf "You can also define FFLAGS to control optimizations and NCRMS \n"
   printf "to reduce the number of CRM samples and the runtime of the tests.\n\n"
+  printf "Set CRM_SINGLE_PRECISION=1 to build the C++ CRM with single precision\n"
+  printf "prognostic arrays (crm_real = float).\n\n"
   printf "./cmakescript.sh [-h|--help] for this message\n\n"
 }
 if [[ "$1" == "" || "$2" == "" ]]; then
@@ -65,6 +67,9 @@ else
 fi
 
 DEFS2D=" -I$NFHOME/include -DNCRMS=$NCRMS2D -DCRM -DCRM_NX=$NX -DCRM_NY=$NY -DCRM_NZ=$NZ -DCRM_NX_RAD=$NX_RAD -DCRM_NY_RAD=$NY_RAD -DCRM_DT=$DT -DCRM_DX=$DX -DYES3DVAL=$YES3D -DPLEV=$PLEV -DMMF_STANDALONE -DHAVE_MPI"
+if [[ "$CRM_SINGLE_PRECISION" == "1" ]]; then
+  DEFS2D="$DEFS2D -DCRM_SINGLE_PRECISION"
+fi
 printf "2D Defs: $DEFS2D\n\n"
 
 
@@ -97,6 +102,9 @@ else
 fi
 
 DEFS3D=" -I$NFHOME/include -DNCRMS=$NCRMS3D -DCRM -DCRM_NX=$NX -DCRM_NY=$NY -DCRM_NZ=$NZ -DCRM_NX_RAD=$NX_RAD -DCRM_NY_RAD=$NY_RAD -DCRM_DT=$DT -DCRM_DX=$DX -DYES3DVAL=$YES3D -DPLEV=$PLEV -DMMF_STANDALONE -DHAVE_MPI"
+if [[ "$CRM_SINGLE_PRECISION" == "1" ]]; then
+  DEFS3D="$DEFS3D -DCRM_SINGLE_PRECISION"
+fi
 printf "3D Defs: $DEFS3D\n\n"
 
 
@@ -0,0 +1,50 @@
+#!/bin/bash
+
+################################################################################
+## Regression comparison of the double and single precision (crm_real = float)
+## builds of the C++ CRM for the 2-D and 3-D standalone tests. Each build is
+## run for CRM_NSTEPS consecutive CRM calls and the outputs are compared field
+## by field with nccmp.py (relative 2-norm, relative inf-norm, avg/max abs).
+##
+## Usage: ./compare_precision.sh 2dfile.nc 3dfile.nc [nsteps] [ntasks]
+################################################################################
+
+if [[ "$1" == "" || "$2" == "" ]]; then
+  printf "Usage: ./compare_precision.sh 2dfile.nc 3dfile.nc [nsteps] [ntasks]\n"
+  exit -1
+fi
+
+nsteps=1
+if [[ ! "$3" == "" ]]; then
+  nsteps=$3
+fi
+ntasks=1
+if [[ ! "$4" == "" ]]; then
+  ntasks=$4
+fi
+
+for prec in double single ; do
+  if [[ "$prec" == "single" ]]; then
+    export CRM_SINGLE_PRECISION=1
+  else
+    unset CRM_SINGLE_PRECISION
+  fi
+  printf "\nConfiguring and building the $prec precision CRM\n\n"
+  ./cmakescript.sh $1 $2 > /dev/null || exit -1
+  make -j8 cpp2d cpp3d || exit -1
+  for dim in 2d 3d ; do
+    cd cpp$dim
+    printf "\nRunning cpp$dim ($prec) for $nsteps CRM steps\n\n"
+    rm -f cpp_output_000001.nc
+    CRM_NSTEPS=$nsteps mpirun -n $ntasks ./cpp$dim | grep -E "Elapsed Time" || exit -1
+    cd ..
+    # cmakescript.sh recreates the run directories, so keep outputs here
+    mv cpp$dim/cpp_output_000001.nc cpp${dim}_output_$prec.nc
+  done
+done
+unset CRM_SINGLE_PRECISION
+
+for dim in 2d 3d ; do
+  printf "\nDouble vs single precision $dim differences after $nsteps CRM steps\n\n"
+  python nccmp.py cpp${dim}_output_double.nc cpp${dim}_output_single.nc
+done
@@ -0,0 +1,23 @@
+#!/bin/bash
+
+################################################################################
+## Time the CRM <-> packed view bridges of P3 and SHOC against p3_main and
+## shoc_main for the 2-D and 3-D standalone tests. Assumes ./cmakescript.sh has
+## already been run. Usage: ./timing_bridge.sh [ntasks]
+################################################################################
+
+ntasks=1
+if [[ ! "$1" == "" ]]; then
+  ntasks=$1
+fi
+
+make -j8 cpp2d cpp3d || exit -1
+
+for dim in 2d 3d ; do
+  cd cpp$dim
+  for turb in smag shoc ; do
+    printf "\nRunning cpp$dim with CRM_TURBULENCE=$turb\n\n"
+    CRM_BRIDGE_TIMING=1 CRM_TURBULENCE=$turb mpirun -n $ntasks ./cpp$dim | grep -E "wtime|bridge timing" || exit -1
+  done
+  cd ..
+done
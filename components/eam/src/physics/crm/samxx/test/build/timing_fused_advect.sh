@@ -0,0 +1,29 @@
+#!/bin/bash
+
+################################################################################
+## Compare the per-field and fused scalar advection paths of the C++ CRM for
+## the 2-D and 3-D standalone tests. Assumes ./cmakescript.sh has already been
+## run. Usage: ./timing_fused_advect.sh [ntasks]
+################################################################################
+
+ntasks=1
+if [[ ! "$1" == "" ]]; then
+  ntasks=$1
+fi
+
+make -j8 cpp2d cpp3d || exit -1
+
+for dim in 2d 3d ; do
+  cd cpp$dim
+  for fused in 0 1 ; do
+    printf "\nRunning cpp$dim with CRM_FUSED_ADVECT=$fused\n\n"
+    rm -f cpp_output_000001.nc
+    CRM_FUSED_ADVECT=$fused mpirun -n $ntasks ./cpp$dim | grep -E "wtime|Elapsed Time" || exit -1
+    mv cpp_output_000001.nc cpp_output_fused$fused.nc 2>/dev/null
+  done
+  if [[ -f cpp_output_fused0.nc && -f cpp_output_fused1.nc ]]; then
+    printf "\nComparing per-field and fused $dim results\n\n"
+    python ../nccmp.py cpp_output_fused0.nc cpp_output_fused1.nc
+  fi
+  cd ..
+done
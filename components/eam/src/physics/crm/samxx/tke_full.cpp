@@ -1,7 +1,7 @@
 
 #include "tke_full.h"
 
-void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int ind_tkh) {
+void tke_full(crmReal5d &tke, int ind_tke, crmReal5d &tk, int ind_tk, crmReal5d &tkh, int ind_tkh) {
   YAKL_SCOPE( bet            , :: bet );
   YAKL_SCOPE( dz             , :: dz );
   YAKL_SCOPE( adzw           , :: adzw );
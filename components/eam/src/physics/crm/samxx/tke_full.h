@@ -7,5 +7,5 @@
 #include "shear_prod3D.h"
 #include "sat.h"
 
-void tke_full(real5d &tke, int ind_tke, real5d &tk, int ind_tk, real5d &tkh, int ind_tkh);
+void tke_full(crmReal5d &tke, int ind_tke, crmReal5d &tk, int ind_tk, crmReal5d &tkh, int ind_tkh);
 
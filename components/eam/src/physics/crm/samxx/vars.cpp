@@ -42,7 +42,7 @@ void allocate() {
   evapr2           = real2d( "evapr2          " , nzm, ncrms);
   evapg1           = real2d( "evapg1          " , nzm, ncrms);
   evapg2           = real2d( "evapg2          " , nzm, ncrms);
-  micro_field      = real5d( "micro_field     " , nmicro_fields, nzm, dimy_s, dimx_s, ncrms );
+  micro_field      = crmReal5d( "micro_field     " , nmicro_fields, nzm, dimy_s, dimx_s, ncrms );
   fluxbmk          = real4d( "fluxbmk         " , nmicro_fields, ny, nx, ncrms);
   fluxtmk          = real4d( "fluxtmk         " , nmicro_fields, ny, nx, ncrms);
   mkwle            = real3d( "mkwle           " , nmicro_fields, nz, ncrms);
@@ -86,8 +86,8 @@ void allocate() {
   vap_ice_exchange  = real2d( "vap_ice_exchange", nzm, ncrms);
 
 #ifdef MMF_ESMT
-  u_esmt           = real4d( "u_esmt          ", nzm, dimy_s, dimx_s, ncrms);
-  v_esmt           = real4d( "v_esmt          ", nzm, dimy_s, dimx_s, ncrms);
+  u_esmt           = crmReal4d( "u_esmt          ", nzm, dimy_s, dimx_s, ncrms);
+  v_esmt           = crmReal4d( "v_esmt          ", nzm, dimy_s, dimx_s, ncrms);
   u_esmt_sgs       = real2d( "u_esmt_sgs      ", nz, ncrms);
   v_esmt_sgs       = real2d( "v_esmt_sgs      ", nz, ncrms);
   u_esmt_diff      = real2d( "u_esmt_diff     ", nz, ncrms);
@@ -102,12 +102,13 @@ void allocate() {
   longitude0       = real1d( "longitude0      " , ncrms ); 
   latitude0        = real1d( "latitude0       " , ncrms ); 
   z0               = real1d( "z0              " , ncrms ); 
+  crm_accel_deficit = real1d( "crm_accel_deficit" , ncrms );
   uhl              = real1d( "uhl             " , ncrms ); 
   vhl              = real1d( "vhl             " , ncrms ); 
   phis             = real1d( "phis            " , ncrms ); 
   psfc             = real1d( "psfc            " , ncrms ); 
-  sgs_field        = real5d( "sgs_field       " , nsgs_fields      , nzm , dimy_s , dimx_s , ncrms );
-  sgs_field_diag   = real5d( "sgs_field_diag  " , nsgs_fields_diag , nzm , dimy_d , dimx_d , ncrms );
+  sgs_field        = crmReal5d( "sgs_field       " , nsgs_fields      , nzm , dimy_s , dimx_s , ncrms );
+  sgs_field_diag   = crmReal5d( "sgs_field_diag  " , nsgs_fields_diag , nzm , dimy_d , dimx_d , ncrms );
   grdf_x           = real2d( "grdf_x          "                    , nzm                   , ncrms );
   grdf_y           = real2d( "grdf_y          "                    , nzm                   , ncrms );
   grdf_z           = real2d( "grdf_z          "                    , nzm                   , ncrms );
@@ -123,22 +124,22 @@ void allocate() {
   adzw             = real2d( "adzw            "                        , nz     , ncrms ); 
   dz               = real1d( "dz              "                                 , ncrms ); 
   dt3              = real1d( "dt3             " , 3                                     ); 
-  u                = real4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
-  v                = real4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
-  w                = real4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
-  t                = real4d( "t               "     , nzm , dimy_s     , dimx_s , ncrms ); 
+  u                = crmReal4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
+  v                = crmReal4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
+  w                = crmReal4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
+  t                = crmReal4d( "t               "     , nzm , dimy_s     , dimx_s , ncrms ); 
   p                = real4d( "p               "     , nzm , dimy_p     , nxp1   , ncrms ); 
-  tabs             = real4d( "tabs            "     , nzm , ny         , nx     , ncrms ); 
-  qv               = real4d( "qv              "     , nzm , ny         , nx     , ncrms ); 
-  qcl              = real4d( "qcl             "     , nzm , ny         , nx     , ncrms ); 
-  qpl              = real4d( "qpl             "     , nzm , ny         , nx     , ncrms ); 
-  qci              = real4d( "qci             "     , nzm , ny         , nx     , ncrms ); 
-  qpi              = real4d( "qpi             "     , nzm , ny         , nx     , ncrms ); 
-  tke2             = real4d( "tke2            "     , nzm , dimy_s     , dimx_s , ncrms ); 
-  tk2              = real4d( "tk2             "     , nzm , dimy_tk2   , nxp2   , ncrms ); 
-  dudt             = real5d( "dudt            " , 3 , nzm , ny         , nxp1   , ncrms ); 
-  dvdt             = real5d( "dvdt            " , 3 , nzm , nyp1       , nx     , ncrms ); 
-  dwdt             = real5d( "dwdt            " , 3 , nz  , ny         , nx     , ncrms ); 
+  tabs             = crmReal4d( "tabs            "     , nzm , ny         , nx     , ncrms ); 
+  qv               = crmReal4d( "qv              "     , nzm , ny         , nx     , ncrms ); 
+  qcl              = crmReal4d( "qcl             "     , nzm , ny         , nx     , ncrms ); 
+  qpl              = crmReal4d( "qpl             "     , nzm , ny         , nx     , ncrms ); 
+  qci              = crmReal4d( "qci             "     , nzm , ny         , nx     , ncrms ); 
+  qpi              = crmReal4d( "qpi             "     , nzm , ny         , nx     , ncrms ); 
+  tke2             = crmReal4d( "tke2            "     , nzm , dimy_s     , dimx_s , ncrms ); 
+  tk2              = crmReal4d( "tk2             "     , nzm , dimy_tk2   , nxp2   , ncrms ); 
+  dudt             = crmReal5d( "dudt            " , 3 , nzm , ny         , nxp1   , ncrms ); 
+  dvdt             = crmReal5d( "dvdt            " , 3 , nzm , nyp1       , nx     , ncrms ); 
+  dwdt             = crmReal5d( "dwdt            " , 3 , nz  , ny         , nx     , ncrms ); 
   misc             = real4d( "misc            "     , nz  , ny         , nx     , ncrms ); 
   fluxbu           = real3d( "fluxbu          "           , ny         , nx     , ncrms ); 
   fluxbv           = real3d( "fluxbv          "           , ny         , nx     , ncrms ); 
@@ -537,7 +538,7 @@ void finalize() {
   evapr2           = real2d();
   evapg1           = real2d();
   evapg2           = real2d();
-  micro_field      = real5d();
+  micro_field      = crmReal5d();
   fluxbmk          = real4d();
   fluxtmk          = real4d();
   mkwle            = real3d();
@@ -549,6 +550,8 @@ void finalize() {
   qpsrc            = real2d();
   qpevp            = real2d();
   flag_precip      = intHost1d();
+  micro_prognostic_ind = int1d();
+  nmicro_prognostic    = 0;
 
   mu_r_table       = real1d();
   vn_table         = real2d(); 
@@ -584,12 +587,13 @@ void finalize() {
   longitude0       = real1d(); 
   latitude0        = real1d(); 
   z0               = real1d(); 
+  crm_accel_deficit = real1d();
   uhl              = real1d(); 
   vhl              = real1d(); 
   phis             = real1d();
   psfc             = real1d();
-  sgs_field        = real5d();
-  sgs_field_diag   = real5d();
+  sgs_field        = crmReal5d();
+  sgs_field_diag   = crmReal5d();
   grdf_x           = real2d();
   grdf_y           = real2d();
   grdf_z           = real2d();
@@ -605,22 +609,22 @@ void finalize() {
   adzw             = real2d(); 
   dz               = real1d(); 
   dt3              = real1d(); 
-  u                = real4d();
-  v                = real4d();
-  w                = real4d();
-  t                = real4d();
+  u                = crmReal4d();
+  v                = crmReal4d();
+  w                = crmReal4d();
+  t                = crmReal4d();
   p                = real4d();
-  tabs             = real4d();
-  qv               = real4d();
-  qcl              = real4d();
-  qpl              = real4d();
-  qci              = real4d();
-  qpi              = real4d();
-  tke2             = real4d();
-  tk2              = real4d();
-  dudt             = real5d();
-  dvdt             = real5d();
-  dwdt             = real5d();
+  tabs             = crmReal4d();
+  qv               = crmReal4d();
+  qcl              = crmReal4d();
+  qpl              = crmReal4d();
+  qci              = crmReal4d();
+  qpi              = crmReal4d();
+  tke2             = crmReal4d();
+  tk2              = crmReal4d();
+  dudt             = crmReal5d();
+  dvdt             = crmReal5d();
+  dwdt             = crmReal5d();
   misc             = real4d();
   fluxbu           = real3d();
   fluxbv           = real3d();
@@ -701,8 +705,8 @@ void finalize() {
   cloudtoptemp     = real3d();
   crm_clear_rh_cnt = int2d();
 #ifdef MMF_ESMT
-  u_esmt           = real4d();
-  v_esmt           = real4d();
+  u_esmt           = crmReal4d();
+  v_esmt           = crmReal4d();
   u_esmt_sgs       = real2d();
   v_esmt_sgs       = real2d();
   u_esmt_diff      = real2d();
@@ -723,6 +727,25 @@ void finalize() {
 
 
 
+bool micro_field_is_prognostic(int k) {
+  return k==index_water_vapor || (docloud && flag_precip(k)!=1) || (doprecip && flag_precip(k)==1);
+}
+
+
+void set_micro_prognostic_fields() {
+  intHost1d ind_host("micro_prognostic_ind_host",nmicro_fields);
+  nmicro_prognostic = 0;
+  for (int k=0; k<nmicro_fields; k++) {
+    if (micro_field_is_prognostic(k)) {
+      ind_host(nmicro_prognostic) = k;
+      nmicro_prognostic++;
+    }
+  }
+  micro_prognostic_ind = int1d("micro_prognostic_ind",nmicro_fields);
+  ind_host.deep_copy_to(micro_prognostic_ind);
+}
+
+
 void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
                             real *crm_input_zmid_p, real *crm_input_zint_p,
                             real *crm_input_pmid_p, real *crm_input_pint_p, real *crm_input_pdel_p,
@@ -738,8 +761,8 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
                             real *crm_state_temperature_p, real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                             real *crm_state_qc_p, real *crm_state_nc_p, real *crm_state_qr_p, real *crm_state_nr_p,
                             real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p,
-                            real *crm_state_t_prev_p, real *crm_state_q_prev_p,
-                            real *crm_rad_qrad_p, real *crm_output_subcycle_factor_p,
+                            real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
+                            real *crm_rad_qrad_p, real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p,
                             real *lat0_p, real *long0_p, int *gcolp_p,
                             real *crm_output_cltot_p, real *crm_output_clhgh_p,
                             real *crm_output_clmed_p, real *crm_output_cllow_p) {
@@ -788,9 +811,11 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
   realHost4d crm_state_bm              = realHost4d( "crm_state_bm            ",crm_state_bm_p             , crm_nz, crm_ny    , crm_nx    , pcols);
   realHost4d crm_state_t_prev          = realHost4d( "crm_state_t_prev        ",crm_state_t_prev_p         , crm_nz, crm_ny    , crm_nx    , pcols);
   realHost4d crm_state_q_prev          = realHost4d( "crm_state_q_prev        ",crm_state_q_prev_p         , crm_nz, crm_ny    , crm_nx    , pcols);
+  realHost1d crm_state_accel_deficit   = realHost1d( "crm_state_accel_deficit ",crm_state_accel_deficit_p                                  , pcols);
   realHost4d crm_rad_qrad              = realHost4d( "crm_rad_qrad            ",crm_rad_qrad_p             , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
 
   realHost1d crm_output_subcycle_factor  = realHost1d( "crm_output_subcycle_factor",crm_output_subcycle_factor_p                           , pcols); 
+  realHost1d crm_output_accel_factor  = realHost1d( "crm_output_accel_factor",crm_output_accel_factor_p                                 , pcols); 
   realHost1d lat0                      = realHost1d( "lat0                    ",lat0_p                                                     , ncrms); 
   realHost1d long0                     = realHost1d( "long0                   ",long0_p                                                    , ncrms); 
   intHost1d  gcolp                     = intHost1d ( "gcolp                   ",gcolp_p                                                    , ncrms); 
@@ -843,6 +868,7 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
   ::crm_state_bm              = real4d( "crm_state_bm            ", crm_nz, crm_ny    , crm_nx    , pcols);
   ::crm_state_t_prev          = real4d( "crm_state_t_prev        ", crm_nz, crm_ny    , crm_nx    , pcols);
   ::crm_state_q_prev          = real4d( "crm_state_q_prev        ", crm_nz, crm_ny    , crm_nx    , pcols);
+  ::crm_state_accel_deficit   = real1d( "crm_state_accel_deficit "                                 , pcols);
 
   ::crm_rad_qrad              = real4d( "crm_rad_qrad            ", crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   ::crm_rad_temperature       = real4d( "crm_rad_temperature     ", crm_nz, crm_ny_rad, crm_nx_rad, pcols);
@@ -853,6 +879,7 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
   ::crm_rad_nc                = real4d( "crm_rad_nc              ", crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   ::crm_rad_ni                = real4d( "crm_rad_ni              ", crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   ::crm_output_subcycle_factor= real1d( "crm_output_subcycle_factor"                              , pcols); 
+  ::crm_output_accel_factor= real1d( "crm_output_accel_factor"                                 , pcols); 
   ::crm_output_cld            = real2d( "crm_output_cld          "                   , plev       , pcols); 
   ::crm_output_cldtop         = real2d( "crm_output_cldtop       "                   , plev       , pcols); 
   ::crm_output_gicewp         = real2d( "crm_output_gicewp       "                   , plev       , pcols); 
@@ -971,9 +998,11 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
   crm_state_bm            .deep_copy_to(::crm_state_bm            );
   crm_state_t_prev        .deep_copy_to(::crm_state_t_prev);
   crm_state_q_prev        .deep_copy_to(::crm_state_q_prev);
+  crm_state_accel_deficit .deep_copy_to(::crm_state_accel_deficit);
 
   crm_rad_qrad            .deep_copy_to(::crm_rad_qrad            );
   crm_output_subcycle_factor.deep_copy_to(::crm_output_subcycle_factor);
+  crm_output_accel_factor.deep_copy_to(::crm_output_accel_factor);
   lat0                    .deep_copy_to(::lat0                    );
   long0                   .deep_copy_to(::long0                   );
   gcolp                   .deep_copy_to(::gcolp                   );
@@ -989,10 +1018,10 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
                   real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                   real *crm_state_qc_p, real *crm_state_nc_p, real *crm_state_qr_p, real *crm_state_nr_p,
                   real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p, 
-                  real *crm_state_t_prev_p, real *crm_state_q_prev_p,
+                  real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
                   real *crm_rad_temperature_p, real *crm_rad_qv_p, real *crm_rad_qc_p,
                   real *crm_rad_qi_p, real *crm_rad_cld_p, real *crm_rad_nc_p, real *crm_rad_ni_p, 
-                  real *crm_output_subcycle_factor_p, 
+                  real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p, 
                   real *crm_output_cld_p, real *crm_output_cldtop_p,
                   real *crm_output_gicewp_p, real *crm_output_gliqwp_p, real *crm_output_mctot_p, real *crm_output_mcup_p, real *crm_output_mcdn_p, 
                   real *crm_output_mcuup_p, real *crm_output_mcudn_p, real *crm_output_qc_mean_p, real *crm_output_qi_mean_p, real *crm_output_qs_mean_p, 
@@ -1030,6 +1059,7 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
   realHost4d crm_state_ni              = realHost4d( "crm_state_ni            ",crm_state_ni_p             , crm_nz, crm_ny    , crm_nx    , pcols);
   realHost4d crm_state_qm              = realHost4d( "crm_state_qm            ",crm_state_qm_p             , crm_nz, crm_ny    , crm_nx    , pcols);
   realHost4d crm_state_bm              = realHost4d( "crm_state_bm            ",crm_state_bm_p             , crm_nz, crm_ny    , crm_nx    , pcols);
+  realHost1d crm_state_accel_deficit   = realHost1d( "crm_state_accel_deficit ",crm_state_accel_deficit_p                                  , pcols);
 
   realHost4d crm_rad_temperature       = realHost4d( "crm_rad_temperature     ",crm_rad_temperature_p      , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   realHost4d crm_rad_qv                = realHost4d( "crm_rad_qv              ",crm_rad_qv_p               , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
@@ -1039,6 +1069,7 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
   realHost4d crm_rad_nc                = realHost4d( "crm_rad_nc              ",crm_rad_nc_p               , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   realHost4d crm_rad_ni                = realHost4d( "crm_rad_ni              ",crm_rad_ni_p               , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   realHost1d crm_output_subcycle_factor= realHost1d( "crm_output_subcycle_factor",crm_output_subcycle_factor_p                             , pcols); 
+  realHost1d crm_output_accel_factor= realHost1d( "crm_output_accel_factor",crm_output_accel_factor_p                                   , pcols); 
   realHost2d crm_output_cld            = realHost2d( "crm_output_cld          ",crm_output_cld_p                              , plev       , pcols); 
   realHost2d crm_output_cldtop         = realHost2d( "crm_output_cldtop       ",crm_output_cldtop_p                           , plev       , pcols); 
   realHost2d crm_output_gicewp         = realHost2d( "crm_output_gicewp       ",crm_output_gicewp_p                           , plev       , pcols); 
@@ -1125,6 +1156,7 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
   crm_state_ni              .deep_copy_to( ::crm_state_ni            );
   crm_state_qm              .deep_copy_to( ::crm_state_qm            );
   crm_state_bm              .deep_copy_to( ::crm_state_bm            );
+  crm_state_accel_deficit   .deep_copy_to( ::crm_state_accel_deficit );
 
   crm_rad_temperature       .deep_copy_to( ::crm_rad_temperature        );
   crm_rad_qv                .deep_copy_to( ::crm_rad_qv                 );
@@ -1134,6 +1166,7 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
   crm_rad_nc                .deep_copy_to( ::crm_rad_nc                 );
   crm_rad_ni                .deep_copy_to( ::crm_rad_ni                 );
   crm_output_subcycle_factor.deep_copy_to( ::crm_output_subcycle_factor ); 
+  crm_output_accel_factor.deep_copy_to( ::crm_output_accel_factor ); 
   crm_output_cld            .deep_copy_to( ::crm_output_cld             ); 
   crm_output_cldtop         .deep_copy_to( ::crm_output_cldtop          ); 
   crm_output_gicewp         .deep_copy_to( ::crm_output_gicewp          ); 
@@ -1211,10 +1244,10 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
                               real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                               real *crm_state_qc_p, real *crm_state_nc_p, real *crm_state_qr_p, real *crm_state_nr_p,
                               real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p,
-                              real *crm_state_t_prev_p, real *crm_state_q_prev_p,
+                              real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
                               real *crm_rad_temperature_p, real *crm_rad_qv_p, real *crm_rad_qc_p,
                               real *crm_rad_qi_p, real *crm_rad_cld_p, real *crm_rad_nc_p, real *crm_rad_ni_p, 
-                              real *crm_output_subcycle_factor_p, 
+                              real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p, 
                               real *crm_output_cld_p, real *crm_output_cldtop_p,
                               real *crm_output_gicewp_p, real *crm_output_gliqwp_p, real *crm_output_mctot_p, real *crm_output_mcup_p, real *crm_output_mcdn_p, 
                               real *crm_output_mcuup_p, real *crm_output_mcudn_p, real *crm_output_qc_mean_p, real *crm_output_qi_mean_p, real *crm_output_qs_mean_p, 
@@ -1254,6 +1287,7 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   realHost4d crm_state_ni              = realHost4d( "crm_state_ni            ",crm_state_ni_p             , crm_nz, crm_ny    , crm_nx    , pcols);
   realHost4d crm_state_qm              = realHost4d( "crm_state_qm            ",crm_state_qm_p             , crm_nz, crm_ny    , crm_nx    , pcols);
   realHost4d crm_state_bm              = realHost4d( "crm_state_bm            ",crm_state_bm_p             , crm_nz, crm_ny    , crm_nx    , pcols);
+  realHost1d crm_state_accel_deficit   = realHost1d( "crm_state_accel_deficit ",crm_state_accel_deficit_p                                  , pcols);
 
   realHost4d crm_rad_temperature       = realHost4d( "crm_rad_temperature     ",crm_rad_temperature_p      , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   realHost4d crm_rad_qv                = realHost4d( "crm_rad_qv              ",crm_rad_qv_p               , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
@@ -1263,6 +1297,7 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   realHost4d crm_rad_nc                = realHost4d( "crm_rad_nc              ",crm_rad_nc_p               , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   realHost4d crm_rad_ni                = realHost4d( "crm_rad_ni              ",crm_rad_ni_p               , crm_nz, crm_ny_rad, crm_nx_rad, pcols);
   realHost1d crm_output_subcycle_factor= realHost1d( "crm_output_subcycle_factor",crm_output_subcycle_factor_p                             , pcols); 
+  realHost1d crm_output_accel_factor= realHost1d( "crm_output_accel_factor",crm_output_accel_factor_p                                   , pcols); 
   realHost2d crm_output_cld            = realHost2d( "crm_output_cld          ",crm_output_cld_p                              , plev       , pcols); 
   realHost2d crm_output_cldtop         = realHost2d( "crm_output_cldtop       ",crm_output_cldtop_p                           , plev       , pcols); 
   realHost2d crm_output_gicewp         = realHost2d( "crm_output_gicewp       ",crm_output_gicewp_p                           , plev       , pcols); 
@@ -1350,6 +1385,7 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   ::crm_state_ni            .deep_copy_to(crm_state_ni            );
   ::crm_state_qm            .deep_copy_to(crm_state_qm            );
   ::crm_state_bm            .deep_copy_to(crm_state_bm            );
+  ::crm_state_accel_deficit .deep_copy_to(crm_state_accel_deficit );
 
   ::crm_rad_temperature     .deep_copy_to(crm_rad_temperature     );
   ::crm_rad_qv              .deep_copy_to(crm_rad_qv              );
@@ -1359,6 +1395,7 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   ::crm_rad_nc              .deep_copy_to(crm_rad_nc              );
   ::crm_rad_ni              .deep_copy_to(crm_rad_ni              );
   ::crm_output_subcycle_factor.deep_copy_to(crm_output_subcycle_factor);
+  ::crm_output_accel_factor.deep_copy_to(crm_output_accel_factor);
   ::crm_output_cld          .deep_copy_to(crm_output_cld          );
   ::crm_output_cldtop       .deep_copy_to(crm_output_cldtop       );
   ::crm_output_gicewp       .deep_copy_to(crm_output_gicewp       );
@@ -1473,6 +1510,7 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   ::crm_state_qm              = real4d();
   ::crm_state_bm              = real4d();
   ::crm_state_t_prev          = real4d();
+  ::crm_state_accel_deficit   = real1d();
   ::crm_state_q_prev          = real4d();
 
   ::crm_rad_qrad              = real4d();
@@ -1484,6 +1522,7 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
   ::crm_rad_nc                = real4d();
   ::crm_rad_ni                = real4d();
   ::crm_output_subcycle_factor= real1d();
+  ::crm_output_accel_factor= real1d();
   ::crm_output_cld            = real2d();
   ::crm_output_cldtop         = real2d();
   ::crm_output_gicewp         = real2d();
@@ -1706,22 +1745,22 @@ void perturb_arrays() {
 
 
 
-real4d u               ;
-real4d v               ;
-real4d w               ;
-real4d t               ;
+crmReal4d u            ;
+crmReal4d v            ;
+crmReal4d w            ;
+crmReal4d t            ;
 real4d p               ;
-real4d tabs            ;
-real4d qv              ;
-real4d qcl             ;
-real4d qpl             ;
-real4d qci             ;
-real4d qpi             ;
-real4d tke2            ;
-real4d tk2             ;
-real5d dudt            ;
-real5d dvdt            ;
-real5d dwdt            ;
+crmReal4d tabs         ;
+crmReal4d qv           ;
+crmReal4d qcl          ;
+crmReal4d qpl          ;
+crmReal4d qci          ;
+crmReal4d qpi          ;
+crmReal4d tke2         ;
+crmReal4d tk2          ;
+crmReal5d dudt         ;
+crmReal5d dvdt         ;
+crmReal5d dwdt         ;
 real4d misc            ;
 real3d fluxbu          ;
 real3d fluxbv          ;
@@ -1828,8 +1867,8 @@ real2d adzw            ;
 real1d dt3             ;
 real1d dz              ;
 
-real5d sgs_field       ;
-real5d sgs_field_diag  ;
+crmReal5d sgs_field    ;
+crmReal5d sgs_field_diag  ;
 real2d grdf_x          ;
 real2d grdf_y          ;
 real2d grdf_z          ;
@@ -1837,7 +1876,7 @@ real2d tkesbbuoy       ;
 real2d tkesbshear      ;
 real2d tkesbdiss       ;
 
-real5d micro_field     ;
+crmReal5d micro_field  ;
 real4d fluxbmk         ;
 real4d fluxtmk         ;
 real3d mkwle           ;
@@ -1849,6 +1888,8 @@ real4d qc              ;
 real2d qpsrc           ;
 real2d qpevp           ;
 intHost1d flag_precip  ;
+int1d micro_prognostic_ind;
+int   nmicro_prognostic    ;
 int3d flag_top         ;
 
 real1d mu_r_table      ;
@@ -1881,8 +1922,8 @@ real2d  vap_liq_exchange ;
 real2d  vap_ice_exchange ;
 
 #ifdef MMF_ESMT
-real4d u_esmt          ;
-real4d v_esmt          ;
+crmReal4d u_esmt       ;
+crmReal4d v_esmt       ;
 real2d u_esmt_sgs      ;
 real2d v_esmt_sgs      ;
 real2d u_esmt_diff     ;
@@ -1975,6 +2016,7 @@ real4d crm_state_ni;
 real4d crm_state_qm;
 real4d crm_state_bm;
 real4d crm_state_t_prev;
+real1d crm_state_accel_deficit;
 real4d crm_state_q_prev;
 
 real4d crm_rad_qrad;
@@ -1986,6 +2028,7 @@ real4d crm_rad_cld;
 real4d crm_rad_nc; 
 real4d crm_rad_ni;  
 real1d crm_output_subcycle_factor;
+real1d crm_output_accel_factor;
 real2d crm_output_cld; 
 real2d crm_output_cldtop; 
 real2d crm_output_gicewp;
@@ -2140,6 +2183,10 @@ bool crm_accel_uv;
 bool use_crm_accel;
 real crm_accel_factor;
 
+bool crm_accel_adaptive;
+
+bool use_crm_fused_advect;
+
 microphysics microphysics_scheme;
 turbulence   turbulence_scheme;
 
@@ -2155,6 +2202,7 @@ real dt_glob;
 
 
 bool crm_accel_ceaseflag;
+real1d crm_accel_deficit;
 
 int igstep;
 
@@ -12,6 +12,15 @@ void init_values();
 void finalize();
 
 
+// True if microphysics field k is a prognostic field that is advected and
+// exchanged across the subdomain boundaries
+bool micro_field_is_prognostic(int k);
+
+
+// Build micro_prognostic_ind once the microphysics scheme has set flag_precip
+void set_micro_prognostic_fields();
+
+
 inline void perturb(real1d &arr, double mag) {
   for (int i=0; i<arr.get_totElems(); i++) {
     double r = static_cast <double> (rand()) / static_cast <double> (RAND_MAX);
@@ -33,22 +42,22 @@ inline real arraySum(real1d &arr) {
 // These arrays use non-1 lower bounds in the Fortran code
 // They must be indexed differently in the C++ code
 //////////////////////////////////////////////////////////////////////////////////
-extern real4d u             ; // Index as u             (    k , offy_u    +j , offx_u    +i , icrm )
-extern real4d v             ; // Index as v             (    k , offy_v    +j , offx_v    +i , icrm )
-extern real4d w             ; // Index as w             (    k , offy_w    +j , offx_w    +i , icrm )
-extern real4d t             ; // Index as t             (    k , offy_s    +j , offx_s    +i , icrm )
+extern crmReal4d u          ; // Index as u             (    k , offy_u    +j , offx_u    +i , icrm )
+extern crmReal4d v          ; // Index as v             (    k , offy_v    +j , offx_v    +i , icrm )
+extern crmReal4d w          ; // Index as w             (    k , offy_w    +j , offx_w    +i , icrm )
+extern crmReal4d t          ; // Index as t             (    k , offy_s    +j , offx_s    +i , icrm )
 extern real4d p             ; // Index as p             (    k , offy_p    +j , offx_p    +i , icrm )
 #ifdef MMF_ESMT
-extern real4d u_esmt        ; // Index as u_esmt        (    k , offy_s    +j , offx_s    +i , icrm )
-extern real4d v_esmt        ; // Index as v_esmt        (    k , offy_s    +j , offx_s    +i , icrm )
+extern crmReal4d u_esmt     ; // Index as u_esmt        (    k , offy_s    +j , offx_s    +i , icrm )
+extern crmReal4d v_esmt     ; // Index as v_esmt        (    k , offy_s    +j , offx_s    +i , icrm )
 #endif
-extern real4d tke2          ; // Index as tke2          (    k , offy_s +j , offx_s +i , icrm )
-extern real4d tk2           ; // Index as tk2           (    k , offy_tk2(or offy_d)  +j , offx_d  +i , icrm )
+extern crmReal4d tke2       ; // Index as tke2          (    k , offy_s +j , offx_s +i , icrm )
+extern crmReal4d tk2        ; // Index as tk2           (    k , offy_tk2(or offy_d)  +j , offx_d  +i , icrm )
 extern real3d sstxy         ; // Index as sstxy         (        offy_sstxy+j , offx_sstxy+i , icrm )
 extern real2d fcory         ; // Index as fcory         (        offy_fcory+j                , icrm )
-extern real5d sgs_field     ; // Index as sgs_field     (l , k , offy_s    +j , offx_s    +i , icrm )
-extern real5d sgs_field_diag; // Index as sgs_field_diag(l , k , offy_d    +j , offx_d    +i , icrm )
-extern real5d micro_field   ; // Index as sgs_field_diag(l , k , offy_s    +j , offx_s    +i , icrm )
+extern crmReal5d sgs_field  ; // Index as sgs_field     (l , k , offy_s    +j , offx_s    +i , icrm )
+extern crmReal5d sgs_field_diag; // Index as sgs_field_diag(l , k , offy_d    +j , offx_d    +i , icrm )
+extern crmReal5d micro_field   ; // Index as sgs_field_diag(l , k , offy_s    +j , offx_s    +i , icrm )
 
 
 void perturb_arrays();
@@ -68,8 +77,8 @@ void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p,
                             real *crm_state_temperature_p, real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                             real *crm_state_qc_p, real *crm_state_nc_p, real *crm_state_qr_p, real *crm_state_nr_p,
                             real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p,
-                            real *crm_state_t_prev_p, real *crm_state_q_prev_p,
-                            real *crm_rad_qrad_p, real *crm_output_subcycle_factor_p,
+                            real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
+                            real *crm_rad_qrad_p, real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p,
                             real *lat0_p, real *long0_p, int *gcolp_p,
                             real *crm_output_cltot_p, real *crm_output_clhgh_p,
                             real *crm_output_clmed_p, real *crm_output_cllow_p);
@@ -78,10 +87,10 @@ void copy_outputs(real *crm_state_u_wind_p, real *crm_state_v_wind_p, real *crm_
                   real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                   real *crm_state_qc_p, real *crm_state_nc_p, real *crm_state_qr_p, real *crm_state_nr_p,
                   real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p,
-                  real *crm_state_t_prev_p, real *crm_state_q_prev_p,
+                  real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
                   real *crm_rad_temperature_p, real *crm_rad_qv_p, real *crm_rad_qc_p, 
                   real *crm_rad_qi_p, real *crm_rad_cld_p, real *crm_rad_nc_p, real *crm_rad_ni_p, 
-                  real *crm_output_subcycle_factor_p, 
+                  real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p, 
                   real *crm_output_cld_p, real *crm_output_cldtop_p,
                   real *crm_output_gicewp_p, real *crm_output_gliqwp_p, real *crm_output_mctot_p, real *crm_output_mcup_p, real *crm_output_mcdn_p, 
                   real *crm_output_mcuup_p, real *crm_output_mcudn_p, real *crm_output_qc_mean_p, real *crm_output_qi_mean_p, real *crm_output_qs_mean_p, 
@@ -112,10 +121,10 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
                               real *crm_state_qt_p, real *crm_state_qp_p, real *crm_state_qn_p,
                               real *crm_state_qc_p, real *crm_state_nc_p, real *crm_state_qr_p, real *crm_state_nr_p,
                               real *crm_state_qi_p, real *crm_state_ni_p, real *crm_state_qm_p, real *crm_state_bm_p,
-                              real *crm_state_t_prev_p, real *crm_state_q_prev_p,
+                              real *crm_state_t_prev_p, real *crm_state_q_prev_p, real *crm_state_accel_deficit_p,
                               real *crm_rad_temperature_p, real *crm_rad_qv_p, real *crm_rad_qc_p,
                               real *crm_rad_qi_p, real *crm_rad_cld_p, real *crm_rad_nc_p, real *crm_rad_ni_p, 
-                              real *crm_output_subcycle_factor_p, 
+                              real *crm_output_subcycle_factor_p, real *crm_output_accel_factor_p, 
                               real *crm_output_cld_p, real *crm_output_cldtop_p,
                               real *crm_output_gicewp_p, real *crm_output_gliqwp_p, 
                               real *crm_output_mctot_p, real *crm_output_mcup_p, real *crm_output_mcdn_p, 
@@ -226,18 +235,21 @@ extern bool crm_accel_uv;
 extern bool use_crm_accel;
 extern real crm_accel_factor;
 
+extern bool crm_accel_adaptive;
+extern bool use_crm_fused_advect;
+
 extern microphysics microphysics_scheme;
 extern turbulence   turbulence_scheme;
 
-extern real4d tabs            ;
-extern real4d qv              ;
-extern real4d qcl             ;
-extern real4d qpl             ;
-extern real4d qci             ;
-extern real4d qpi             ;
-extern real5d dudt            ;
-extern real5d dvdt            ;
-extern real5d dwdt            ;
+extern crmReal4d tabs         ;
+extern crmReal4d qv           ;
+extern crmReal4d qcl          ;
+extern crmReal4d qpl          ;
+extern crmReal4d qci          ;
+extern crmReal4d qpi          ;
+extern crmReal5d dudt         ;
+extern crmReal5d dvdt         ;
+extern crmReal5d dwdt         ;
 extern real4d misc            ;
 extern real3d fluxbu          ;
 extern real3d fluxbv          ;
@@ -360,6 +372,8 @@ extern real4d qc              ;
 extern real2d qpsrc           ;
 extern real2d qpevp           ;
 extern intHost1d flag_precip  ;
+extern int1d micro_prognostic_ind; // indices of the fields for which micro_field_is_prognostic() holds
+extern int   nmicro_prognostic    ; // number of entries of micro_prognostic_ind in use
 extern int3d flag_top         ;
 
 #ifdef MMF_ESMT
@@ -457,6 +471,7 @@ extern real4d crm_state_qm;
 extern real4d crm_state_bm;
 extern real4d crm_state_t_prev;
 extern real4d crm_state_q_prev;
+extern real1d crm_state_accel_deficit;
 
 extern real4d crm_rad_qrad;
 extern real4d crm_rad_temperature;
@@ -467,6 +482,7 @@ extern real4d crm_rad_cld;
 extern real4d crm_rad_nc; 
 extern real4d crm_rad_ni;  
 extern real1d crm_output_subcycle_factor;
+extern real1d crm_output_accel_factor;
 extern real2d crm_output_cld; 
 extern real2d crm_output_cldtop; 
 extern real2d crm_output_gicewp;
@@ -584,5 +600,6 @@ extern real icrm_run_time;
 extern real dt_glob;
 
 extern bool crm_accel_ceaseflag;
+extern real1d crm_accel_deficit;
 
 extern int igstep;
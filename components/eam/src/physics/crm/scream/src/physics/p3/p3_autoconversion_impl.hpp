@@ -7,9 +7,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::cloud_water_autoconversion(
   const Spack& rho, const Spack& qc_incld, const Spack& nc_incld,
   const Spack& inv_qc_relvar, Spack& qc2qr_autoconv_tend, Spack& nc2nr_autoconv_tend, Spack& ncautr,
@@ -11,9 +11,9 @@ namespace p3 {
  * Clients should NOT #include this file, but include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::back_to_cell_average(
   const Spack& cld_frac_l, const Spack& cld_frac_r,
   const Spack& cld_frac_i, Spack& qc2qr_accret_tend, Spack& qr2qv_evap_tend,
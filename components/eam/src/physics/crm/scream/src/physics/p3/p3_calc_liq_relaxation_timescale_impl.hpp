@@ -11,9 +11,9 @@ namespace p3 {
  * Clients should NOT #include this file, but include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calc_liq_relaxation_timescale(
   const view_2d_table& revap_table_vals,
   const Spack& rho, const Scalar& f1r, const Scalar& f2r,
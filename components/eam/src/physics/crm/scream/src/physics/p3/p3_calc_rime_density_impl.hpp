@@ -11,9 +11,9 @@ namespace p3 {
  * Clients should NOT #include this file, but include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calc_rime_density(
   const Spack& T_atm, const Spack& rhofaci,
   const Spack& table_val_qi_fallspd, const Spack& acn,
@@ -22,9 +22,9 @@ namespace p3 {
   from where 'check_values' was called before it resulted in a trap.
   -----------------------------------------------------------------------------------
 */
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::check_values(const uview_1d<const Spack>& qv, const uview_1d<const Spack>& temp, const Int& ktop, const Int& kbot,
                const Int& timestepcount, const bool& force_abort, const Int& source_ind, const MemberType& team,
                const uview_1d<const Scalar>& col_loc)
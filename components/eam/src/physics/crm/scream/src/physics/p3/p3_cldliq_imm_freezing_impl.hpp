@@ -12,9 +12,9 @@ namespace p3 {
  * Clients should NOT #include this file, but include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::cldliq_immersion_freezing(
   const Spack& T_atm, const Spack& lamc,
   const Spack& mu_c, const Spack& cdist1,
@@ -12,9 +12,9 @@ namespace p3 {
  * #include this file, but include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::cloud_rain_accretion(
   const Spack& rho, const Spack& inv_rho,
   const Spack& qc_incld, const Spack& nc_incld,
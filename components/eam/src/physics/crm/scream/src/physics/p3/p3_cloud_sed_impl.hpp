@@ -11,9 +11,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::cloud_sedimentation(
     const uview_1d<Spack>& qc_incld,
     const uview_1d<const Spack>& rho,
@@ -11,9 +11,9 @@ namespace p3 {
  * #include this file, but include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::droplet_self_collection(
   const Spack&, const Spack&,
   const Spack& qc_incld, const Spack&,
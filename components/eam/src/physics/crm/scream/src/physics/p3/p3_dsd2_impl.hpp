@@ -11,9 +11,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::
+void Functions<S,D,N>::
 get_cloud_dsd2(
   const Spack& qc, Spack& nc, Spack& mu_c, const Spack& rho, Spack& nu,
   const view_dnu_table& dnu, Spack& lamc, Spack& cdist, Spack& cdist1, 
@@ -71,9 +71,9 @@ get_cloud_dsd2(
   }
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::
+void Functions<S,D,N>::
 get_rain_dsd2 (
   const Spack& qr, Spack& nr, Spack& mu_r,
   Spack& lamr, Spack& cdistr, Spack& logn0r, 
@@ -7,9 +7,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::rain_evap_tscale_weight(const Spack& dt_over_tau, Spack& weight, const Smask& context)
 {
   /*
@@ -23,9 +23,9 @@ void Functions<S,D>
   
 } //end tscale_weight
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::rain_evap_equilib_tend(const Spack& A_c,const Spack& ab,const Spack& tau_eff,
 			 const Spack& tau_r, Spack& tend, const Smask& context)
 {
@@ -43,9 +43,9 @@ void Functions<S,D>
   
 } //end equilib_tend
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::rain_evap_instant_tend(const Spack& ssat_r, const Spack& ab, const Spack& tau_r,
 			 Spack& tend, const Smask& context)
 {
@@ -61,9 +61,9 @@ void Functions<S,D>
   
 }
   
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::evaporate_rain(
   const Spack& qr_incld, const Spack& qc_incld, const Spack& nr_incld, const Spack& qi_incld,
   const Spack& cld_frac_l, const Spack& cld_frac_r, const Spack& qv, const Spack& qv_prev,
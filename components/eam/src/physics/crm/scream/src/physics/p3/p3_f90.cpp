@@ -124,8 +124,9 @@ void p3_init () {
   }
 }
 
-Int p3_main (const FortranData& d, bool use_fortran) {
+Int p3_main (const FortranData& d, bool use_fortran, bool use_mixed) {
   EKAT_REQUIRE_MSG(d.dt > 0, "invalid dt");
+  EKAT_REQUIRE_MSG(!(use_fortran && use_mixed), "Mixed precision is only available for the c++ p3_main");
   if (use_fortran) {
     Real elapsed_s;
     p3_main_c(d.qc.data(), d.nc.data(), d.qr.data(), d.nr.data(),
@@ -139,7 +140,23 @@ Int p3_main (const FortranData& d, bool use_fortran) {
               d.liq_ice_exchange.data(), d.vap_liq_exchange.data(),d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data(), &elapsed_s);
     return static_cast<Int>(elapsed_s * 1000000);
   }
+#ifdef SCREAM_MIXED_PRECISION
+  else if (use_mixed) {
+    return p3_main_f_mixed(d.qc.data(), d.nc.data(), d.qr.data(), d.nr.data(), d.th_atm.data(),
+                           d.qv.data(), d.dt, d.qi.data(), d.qm.data(), d.ni.data(),
+                           d.bm.data(), d.pres.data(), d.dz.data(), d.nc_nuceat_tend.data(), d.nccn_prescribed.data(),
+                           d.ni_activated.data(), d.inv_qc_relvar.data(), d.it, d.precip_liq_surf.data(),
+                           d.precip_ice_surf.data(), 1, d.ncol, 1, d.nlev, d.diag_eff_radius_qc.data(),
+                           d.diag_eff_radius_qi.data(), d.rho_qi.data(), d.do_predict_nc, d.do_prescribed_CCN,
+                           d.dpres.data(), d.inv_exner.data(), d.qv2qi_depos_tend.data(),
+                           d.precip_liq_flux.data(), d.precip_ice_flux.data(),
+                           d.cld_frac_r.data(), d.cld_frac_l.data(), d.cld_frac_i.data(),
+                           d.liq_ice_exchange.data(), d.vap_liq_exchange.data(),
+                           d.vap_ice_exchange.data(),d.qv_prev.data(),d.t_prev.data() );
+  }
+#endif
   else {
+    EKAT_REQUIRE_MSG(!use_mixed, "Mixed precision requires a build with SCREAM_MIXED_PRECISION=ON");
     return p3_main_f(d.qc.data(), d.nc.data(), d.qr.data(), d.nr.data(), d.th_atm.data(),
                      d.qv.data(), d.dt, d.qi.data(), d.qm.data(), d.ni.data(),
                      d.bm.data(), d.pres.data(), d.dz.data(), d.nc_nuceat_tend.data(), d.nccn_prescribed.data(),
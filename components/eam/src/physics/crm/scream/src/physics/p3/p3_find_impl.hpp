@@ -11,9 +11,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-Int Functions<S,D>
+Int Functions<S,D,N>
 ::find_bottom (
     const MemberType& team,
     const uview_1d<const Scalar>& v, const Scalar& small,
@@ -51,9 +51,9 @@ Int Functions<S,D>
   return k_xbot;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-Int Functions<S,D>
+Int Functions<S,D,N>
 ::find_top (
     const MemberType& team,
     const uview_1d<const Scalar>& v, const Scalar& small,
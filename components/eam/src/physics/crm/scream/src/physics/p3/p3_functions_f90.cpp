@@ -1,6 +1,8 @@
 #include "p3_functions_f90.hpp"
 #include "ekat/kokkos/ekat_kokkos_types.hpp"
 #include "p3_f90.hpp"
+#include "physics/share/physics_mixed_precision.hpp"
+#include "physics/share/physics_pack_dispatch.hpp"
 
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
 #include "ekat/ekat_pack_kokkos.hpp"
@@ -3110,22 +3112,27 @@ void p3_main_part3_f(
     nk, inout_views);
 }
 
-Int p3_main_f(
-  Real* qc, Real* nc, Real* qr, Real* nr, Real* th_atm, Real* qv, Real dt,
-  Real* qi, Real* qm, Real* ni, Real* bm, Real* pres, Real* dz,
-  Real* nc_nuceat_tend, Real* nccn_prescribed, Real* ni_activated, Real* inv_qc_relvar, Int it, Real* precip_liq_surf,
-  Real* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Real* diag_eff_radius_qc,
-  Real* diag_eff_radius_qi, Real* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Real* dpres, Real* inv_exner,
-  Real* qv2qi_depos_tend, Real* precip_liq_flux, Real* precip_ice_flux, Real* cld_frac_r, Real* cld_frac_l, Real* cld_frac_i, 
-  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev)
+namespace {
+
+// p3_main_f for the kernel scalar type Scalar and small pack size N; see
+// p3_main_f_mixed and physics::dispatch_pack_size.
+template <typename Scalar, int N = small_pack_size<Scalar>()>
+Int p3_main_f_impl(
+  Scalar* qc, Scalar* nc, Scalar* qr, Scalar* nr, Scalar* th_atm, Scalar* qv, Real dt,
+  Scalar* qi, Scalar* qm, Scalar* ni, Scalar* bm, Scalar* pres, Scalar* dz,
+  Scalar* nc_nuceat_tend, Scalar* nccn_prescribed, Scalar* ni_activated, Scalar* inv_qc_relvar, Int it, Scalar* precip_liq_surf,
+  Scalar* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Scalar* diag_eff_radius_qc,
+  Scalar* diag_eff_radius_qi, Scalar* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Scalar* dpres, Scalar* inv_exner,
+  Scalar* qv2qi_depos_tend, Scalar* precip_liq_flux, Scalar* precip_ice_flux, Scalar* cld_frac_r, Scalar* cld_frac_l, Scalar* cld_frac_i, 
+  Scalar* liq_ice_exchange, Scalar* vap_liq_exchange, Scalar* vap_ice_exchange, Scalar* qv_prev, Scalar* t_prev)
 {
-  using P3F  = Functions<Real, DefaultDevice>;
+  using P3F  = Functions<Scalar, DefaultDevice, N>;
 
   using Spack      = typename P3F::Spack;
   using KT         = typename P3F::KT;
-  using view_2d    = typename P3F::view_2d<Spack>;
-  using sview_1d   = typename P3F::view_1d<Real>;
-  using sview_2d   = typename P3F::view_2d<Real>;
+  using view_2d    = typename P3F::template view_2d<Spack>;
+  using sview_1d   = typename P3F::template view_1d<Scalar>;
+  using sview_2d   = typename P3F::template view_2d<Scalar>;
 
   using view_1d_table      = typename P3F::view_1d_table;
   using view_2d_table      = typename P3F::view_2d_table;
@@ -3149,7 +3156,7 @@ Int p3_main_f(
   std::vector<view_2d> temp_d(P3MainData::NUM_ARRAYS);
   std::vector<size_t> dim1_sizes(P3MainData::NUM_ARRAYS, nj);
   std::vector<size_t> dim2_sizes(P3MainData::NUM_ARRAYS, nk);
-  std::vector<const Real*> ptr_array = {
+  std::vector<const Scalar*> ptr_array = {
     pres, dz, nc_nuceat_tend, nccn_prescribed, ni_activated, dpres, inv_exner, cld_frac_i, cld_frac_l, cld_frac_r, inv_qc_relvar,
     qc, nc, qr, nr, qi, qm, ni, bm, qv, th_atm, qv_prev, t_prev, diag_eff_radius_qc, diag_eff_radius_qi,
     rho_qi, qv2qi_depos_tend,
@@ -3165,7 +3172,7 @@ Int p3_main_f(
   // Initialize outputs to avoid uninitialized read warnings in memory checkers
   for (size_t i = P3MainData::NUM_INPUT_ARRAYS; i < P3MainData::NUM_ARRAYS; ++i) {
     for (size_t j = 0; j < dim1_sizes[i]*dim2_sizes[i]; ++j) {
-      const_cast<Real*>(ptr_array[i])[j] = 0;
+      const_cast<Scalar*>(ptr_array[i])[j] = 0;
     }
   }
 
@@ -3228,17 +3235,17 @@ Int p3_main_f(
   });
 
   // Pack our data into structs and ship it off to p3_main.
-  P3F::P3PrognosticState prog_state{qc_d, nc_d, qr_d, nr_d, qi_d, qm_d,
+  typename P3F::P3PrognosticState prog_state{qc_d, nc_d, qr_d, nr_d, qi_d, qm_d,
                                     ni_d, bm_d, qv_d, th_atm_d};
-  P3F::P3DiagnosticInputs diag_inputs{nc_nuceat_tend_d, nccn_prescribed_d, ni_activated_d, inv_qc_relvar_d, cld_frac_i_d,
+  typename P3F::P3DiagnosticInputs diag_inputs{nc_nuceat_tend_d, nccn_prescribed_d, ni_activated_d, inv_qc_relvar_d, cld_frac_i_d,
                                       cld_frac_l_d, cld_frac_r_d, pres_d, dz_d, dpres_d,
                                       inv_exner_d, qv_prev_d, t_prev_d};
-  P3F::P3DiagnosticOutputs diag_outputs{qv2qi_depos_tend_d, precip_liq_surf_d,
+  typename P3F::P3DiagnosticOutputs diag_outputs{qv2qi_depos_tend_d, precip_liq_surf_d,
                                         precip_ice_surf_d, diag_eff_radius_qc_d, diag_eff_radius_qi_d,
                                         rho_qi_d,precip_liq_flux_d, precip_ice_flux_d};
-  P3F::P3Infrastructure infrastructure{dt, it, its, ite, kts, kte,
+  typename P3F::P3Infrastructure infrastructure{dt, it, its, ite, kts, kte,
                                        do_predict_nc, do_prescribed_CCN, col_location_d};
-  P3F::P3HistoryOnly history_only{liq_ice_exchange_d, vap_liq_exchange_d,
+  typename P3F::P3HistoryOnly history_only{liq_ice_exchange_d, vap_liq_exchange_d,
                                   vap_ice_exchange_d};
 
 
@@ -3251,15 +3258,15 @@ Int p3_main_f(
   P3F::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
   P3F::init_kokkos_tables(vn_table_vals, vm_table_vals, revap_table_vals, mu_r_table_vals, dnu_table_vals);
 
-  P3F::P3LookupTables lookup_tables{mu_r_table_vals, vn_table_vals, vm_table_vals, revap_table_vals,
+  typename P3F::P3LookupTables lookup_tables{mu_r_table_vals, vn_table_vals, vm_table_vals, revap_table_vals,
                                     ice_table_vals, collect_table_vals, dnu_table_vals};
 
 
 
   // Create local workspace
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(nj, nk_pack);
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nk_pack, 52, policy);
+  const auto policy = ekat::ExeSpaceUtils<typename KT::ExeSpace>::get_default_team_policy(nj, nk_pack);
+  ekat::WorkspaceManager<Spack, typename KT::Device> workspace_mgr(nk_pack, 52, policy);
 
   auto elapsed_microsec = P3F::p3_main(prog_state, diag_inputs, diag_outputs, infrastructure,
                                        history_only, lookup_tables, workspace_mgr, nj, nk);
@@ -3295,6 +3302,67 @@ Int p3_main_f(
   return elapsed_microsec;
 }
 
+} // namespace anon
+
+Int p3_main_f(
+  Real* qc, Real* nc, Real* qr, Real* nr, Real* th_atm, Real* qv, Real dt,
+  Real* qi, Real* qm, Real* ni, Real* bm, Real* pres, Real* dz,
+  Real* nc_nuceat_tend, Real* nccn_prescribed, Real* ni_activated, Real* inv_qc_relvar, Int it, Real* precip_liq_surf,
+  Real* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Real* diag_eff_radius_qc,
+  Real* diag_eff_radius_qi, Real* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Real* dpres, Real* inv_exner,
+  Real* qv2qi_depos_tend, Real* precip_liq_flux, Real* precip_ice_flux, Real* cld_frac_r, Real* cld_frac_l, Real* cld_frac_i, 
+  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev)
+{
+  Int elapsed_microsec = 0;
+  physics::dispatch_pack_size(physics::get_pack_size(), [&] (auto n) {
+    elapsed_microsec = p3_main_f_impl<Real, decltype(n)::value>(
+      qc, nc, qr, nr, th_atm, qv, dt, qi, qm, ni, bm, pres, dz, nc_nuceat_tend, nccn_prescribed,
+      ni_activated, inv_qc_relvar, it, precip_liq_surf, precip_ice_surf, its, ite, kts, kte,
+      diag_eff_radius_qc, diag_eff_radius_qi, rho_qi, do_predict_nc, do_prescribed_CCN, dpres,
+      inv_exner, qv2qi_depos_tend, precip_liq_flux, precip_ice_flux, cld_frac_r, cld_frac_l,
+      cld_frac_i, liq_ice_exchange, vap_liq_exchange, vap_ice_exchange, qv_prev, t_prev);
+  });
+  return elapsed_microsec;
+}
+
+#ifdef SCREAM_MIXED_PRECISION
+Int p3_main_f_mixed(
+  Real* qc, Real* nc, Real* qr, Real* nr, Real* th_atm, Real* qv, Real dt,
+  Real* qi, Real* qm, Real* ni, Real* bm, Real* pres, Real* dz,
+  Real* nc_nuceat_tend, Real* nccn_prescribed, Real* ni_activated, Real* inv_qc_relvar, Int it, Real* precip_liq_surf,
+  Real* precip_ice_surf, Int its, Int ite, Int kts, Int kte, Real* diag_eff_radius_qc,
+  Real* diag_eff_radius_qi, Real* rho_qi, bool do_predict_nc, bool do_prescribed_CCN, Real* dpres, Real* inv_exner,
+  Real* qv2qi_depos_tend, Real* precip_liq_flux, Real* precip_ice_flux, Real* cld_frac_r, Real* cld_frac_l, Real* cld_frac_i, 
+  Real* liq_ice_exchange, Real* vap_liq_exchange, Real* vap_ice_exchange, Real* qv_prev, Real* t_prev)
+{
+  // Sizes of the surface, midpoint and interface arrays
+  const Int nj = ite - its + 1;
+  const Int nk = kte - kts + 1;
+  const Int nmid = nj*nk, nint = nj*(nk+1);
+
+  // The prognostic state is updated in Real; the diagnostics and the
+  // tendencies for the host model are outputs.
+  using KA = physics::KernelArrays<float>;
+  constexpr auto state = KA::Intent::State, out = KA::Intent::Out;
+  KA f;
+  const auto elapsed_microsec = p3_main_f_impl<float>(
+    f.add(qc, nmid, state), f.add(nc, nmid, state), f.add(qr, nmid, state), f.add(nr, nmid, state),
+    f.add(th_atm, nmid, state), f.add(qv, nmid, state), dt, f.add(qi, nmid, state), f.add(qm, nmid, state),
+    f.add(ni, nmid, state), f.add(bm, nmid, state), f.add(pres, nmid), f.add(dz, nmid),
+    f.add(nc_nuceat_tend, nmid), f.add(nccn_prescribed, nmid), f.add(ni_activated, nmid),
+    f.add(inv_qc_relvar, nmid), it, f.add(precip_liq_surf, nj, out), f.add(precip_ice_surf, nj, out),
+    its, ite, kts, kte, f.add(diag_eff_radius_qc, nmid, out), f.add(diag_eff_radius_qi, nmid, out),
+    f.add(rho_qi, nmid, out), do_predict_nc, do_prescribed_CCN, f.add(dpres, nmid), f.add(inv_exner, nmid),
+    f.add(qv2qi_depos_tend, nmid, out), f.add(precip_liq_flux, nint, out), f.add(precip_ice_flux, nint, out),
+    f.add(cld_frac_r, nmid), f.add(cld_frac_l, nmid), f.add(cld_frac_i, nmid),
+    f.add(liq_ice_exchange, nmid, out), f.add(vap_liq_exchange, nmid, out), f.add(vap_ice_exchange, nmid, out),
+    f.add(qv_prev, nmid), f.add(t_prev, nmid));
+  f.copy_back();
+
+  return elapsed_microsec;
+}
+#endif
+
 void ice_supersat_conservation_f(Real* qidep, Real* qinuc, Real cld_frac_i, Real qv, Real qv_sat_i, Real latent_heat_sublim, Real t_atm, Real dt, Real qi2qv_sublim_tend, Real qr2qv_evap_tend)
 {
   using PF = Functions<Real, DefaultDevice>;
@@ -6,8 +6,8 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
-void Functions<S,D>
+template<typename S, typename D, int N>
+void Functions<S,D,N>
 ::get_latent_heat(const Int& nj, const Int& nk, view_2d<Spack>& v, view_2d<Spack>& s, view_2d<Spack>& f)
 {
   using ExeSpace = typename KT::ExeSpace;
@@ -8,9 +8,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_cldliq_wet_growth(
   const Spack& rho, const Spack& temp, const Spack& pres, const Spack& rhofaci, const Spack& table_val_qi2qr_melting,
   const Spack& table_val_qi2qr_vent_melt, const Spack& latent_heat_vapor, const Spack& latent_heat_fusion, const Spack& dv,
@@ -18,7 +18,7 @@ void Functions<S,D>
   const Spack& qi_incld, const Spack& ni_incld, const Spack& qr_incld,
   Smask& log_wetgrowth, Spack& qr2qi_collect_tend, Spack& qc2qi_collect_tend, Spack& qc_growth_rate, Spack& nr_ice_shed_tend, Spack& qc2qr_ice_shed_tend, const Smask& context)
 {
-  using physics = scream::physics::Functions<Scalar, Device>;
+  using physics = scream::physics::Functions<Scalar, Device, N>;
 
   constexpr Scalar qsmall = C::QSMALL;
   constexpr Scalar tmelt  = C::Tmelt;
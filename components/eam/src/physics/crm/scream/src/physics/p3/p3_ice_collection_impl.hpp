@@ -6,9 +6,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_cldliq_collection(
   const Spack& rho, const Spack& temp,
   const Spack& rhofaci, const Spack& table_val_qc2qi_collect,
@@ -42,9 +42,9 @@ void Functions<S,D>
   ncshdc.set(both_gt_small_pos_t, qc2qr_ice_shed_tend*inv_dropmass);
 }
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_rain_collection(
   const Spack& rho, const Spack& temp,
   const Spack& rhofaci, const Spack& logn0r,
@@ -84,9 +84,9 @@ void Functions<S,D>
   // expected to lead to shedding)
 }
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_self_collection(
   const Spack& rho, const Spack& rhofaci,
   const Spack& table_val_ni_self_collect, const Spack& eii,
@@ -10,6 +10,10 @@ namespace p3 {
    */
 
   template struct Functions<Real,DefaultDevice>;
+#ifdef SCREAM_MIXED_PRECISION
+  template struct Functions<float,DefaultDevice>;
+#endif
+  SCREAM_ETI_EXTRA_PACK_SIZES(Functions)
 
 } // namespace p3
 } // namespace scream
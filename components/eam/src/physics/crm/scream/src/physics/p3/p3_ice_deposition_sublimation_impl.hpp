@@ -7,9 +7,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_deposition_sublimation(
   const Spack& qi_incld, const Spack& ni_incld, const Spack& T_atm,   const Spack& qv_sat_l,
   const Spack& qv_sat_i,         const Spack& epsi,        const Spack& abi, const Spack& qv, const Scalar& inv_dt,
@@ -8,9 +8,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_melting(
   const Spack& rho, const Spack& T_atm, const Spack& pres, const Spack& rhofaci,
   const Spack& table_val_qi2qr_melting, const Spack& table_val_qi2qr_vent_melt, const Spack& latent_heat_vapor, const Spack& latent_heat_fusion,
@@ -24,7 +24,7 @@ void Functions<S,D>
   // currently enhanced melting from collision is neglected
   // include RH dependence
 
-  using physics = scream::physics::Functions<Scalar, Device>;
+  using physics = scream::physics::Functions<Scalar, Device, N>;
 
   const auto Pi     = C::Pi;
   const auto QSMALL = C::QSMALL;
@@ -11,10 +11,10 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack
-Functions<S,D>
+typename Functions<S,D,N>::Spack
+Functions<S,D,N>
 ::calc_bulk_rho_rime(
   const Spack& qi_tot, Spack& qi_rim, Spack& bi_rim,
   const Smask& context)
@@ -62,9 +62,9 @@ Functions<S,D>
   return rho_rime;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::ice_sedimentation(
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
@@ -198,9 +198,9 @@ void Functions<S,D>
     {&V_qit, &V_nit, &flux_nit, &flux_bir, &flux_qir, &flux_qit});
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::homogeneous_freezing(
   const uview_1d<const Spack>& T_atm,
   const uview_1d<const Spack>& inv_exner,
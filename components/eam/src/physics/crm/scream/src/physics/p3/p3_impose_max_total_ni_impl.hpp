@@ -6,9 +6,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::impose_max_total_ni(
   Spack& ni_local, const Scalar& max_total_ni, const Spack& inv_rho_local,
   const Smask& context)
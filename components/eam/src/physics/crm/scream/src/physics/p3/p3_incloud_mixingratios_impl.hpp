@@ -6,9 +6,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calculate_incloud_mixingratios(
   const Spack& qc, const Spack& qr, const Spack& qi, const Spack& qm, const Spack& nc,
   const Spack& nr, const Spack& ni, const Spack& bm, const Spack& inv_cld_frac_l,
@@ -15,9 +15,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::p3_main_init(
   const MemberType& team,
   const Int& nk_pack,
@@ -69,8 +69,8 @@ void Functions<S,D>
   team.team_barrier();
 }
 
-template <typename S, typename D>
-Int Functions<S,D>
+template <typename S, typename D, int N>
+Int Functions<S,D,N>
 ::p3_main(
   const P3PrognosticState& prognostic_state,
   const P3DiagnosticInputs& diagnostic_inputs,
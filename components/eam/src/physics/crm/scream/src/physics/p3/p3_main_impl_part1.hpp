@@ -15,9 +15,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::p3_main_part1(
   const MemberType& team,
   const Int& nk,
@@ -68,7 +68,7 @@ void Functions<S,D>
   bool& hydrometeorsPresent)
 {
   // Get access to saturation functions
-  using physics = scream::physics::Functions<Scalar, Device>;
+  using physics = scream::physics::Functions<Scalar, Device, N>;
 
   // load constants into local vars
   constexpr Scalar g            = C::gravit;
@@ -7,6 +7,8 @@
 
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
+#include <limits>
+
 namespace scream {
 namespace p3 {
 
@@ -15,9 +17,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::p3_main_part2(
   const MemberType& team,
   const Int& nk_pack,
@@ -420,6 +422,9 @@ void Functions<S,D>
     // update prognostic microphysics and thermodynamics variables
     //---------------------------------------------------------------------------------
 
+    // values before the update, to detect the depleted species below
+    const Spack qc_old = qc(k), qr_old = qr(k), qi_old = qi(k);
+
     //-- ice-phase dependent processes:
     update_prognostic_ice(
       qc2qi_hetero_freeze_tend, qc2qi_collect_tend, qc2qr_ice_shed_tend, nc_collect_tend, nc2ni_immers_freeze_tend, ncshdc, qr2qi_collect_tend, nr_collect_tend,  qr2qi_immers_freeze_tend,
@@ -444,13 +449,27 @@ void Functions<S,D>
     liq_ice_exchange(k).set(not_skip_all, qc2qi_hetero_freeze_tend + qr2qi_immers_freeze_tend - qi2qr_melt_tend + qc2qi_berg_tend + qc2qi_collect_tend + qr2qi_collect_tend);
 
     // clipping for small hydrometeor values
-    const auto qc_small    = qc(k) < qsmall    && not_skip_all;
-    const auto qr_small    = qr(k) < qsmall    && not_skip_all;
-    const auto qi_small = qi(k) < qsmall && not_skip_all;
-
-    const auto qc_not_small    = qc(k) >= qsmall    && not_skip_all;
-    const auto qr_not_small    = qr(k) >= qsmall    && not_skip_all;
-    const auto qi_not_small = qi(k) >= qsmall && not_skip_all;
+    auto qc_small    = qc(k) < qsmall    && not_skip_all;
+    auto qr_small    = qr(k) < qsmall    && not_skip_all;
+    auto qi_small = qi(k) < qsmall && not_skip_all;
+
+    auto qc_not_small    = qc(k) >= qsmall    && not_skip_all;
+    auto qr_not_small    = qr(k) >= qsmall    && not_skip_all;
+    auto qi_not_small = qi(k) >= qsmall && not_skip_all;
+
+    // When the sinks deplete a species, a kernel narrower than Real (mixed
+    // precision mode) leaves the rounding error of its old value, which can
+    // be well above qsmall (and then sediments without number). Clip it with
+    // the small values, as happens to the residual of a Real kernel.
+    if (sizeof(Scalar) < sizeof(Real)) {
+      constexpr Scalar depleted_tol = 8*std::numeric_limits<Scalar>::epsilon();
+      qc_small     = qc_small || (qc(k) < depleted_tol*qc_old && not_skip_all);
+      qr_small     = qr_small || (qr(k) < depleted_tol*qr_old && not_skip_all);
+      qi_small     = qi_small || (qi(k) < depleted_tol*qi_old && not_skip_all);
+      qc_not_small = qc_not_small && !qc_small;
+      qr_not_small = qr_not_small && !qr_small;
+      qi_not_small = qi_not_small && !qi_small;
+    }
 
     qv(k).set(qc_small, qv(k) + qc(k));
     th_atm(k).set(qc_small, th_atm(k) - inv_exner(k) * qc(k) * latent_heat_vapor(k) * inv_cp);
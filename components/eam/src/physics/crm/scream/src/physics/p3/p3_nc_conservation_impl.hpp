@@ -11,9 +11,9 @@ namespace p3 {
  * #include this file, but include p3_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::nc_conservation(const Spack& nc, const Spack& nc_selfcollect_tend, const Real& dt, Spack& nc_collect_tend, Spack& nc2ni_immers_freeze_tend, Spack& nc_accret_tend, Spack& nc2nr_autoconv_tend, const Smask& context)
+void Functions<S,D,N>::nc_conservation(const Spack& nc, const Spack& nc_selfcollect_tend, const Scalar& dt, Spack& nc_collect_tend, Spack& nc2ni_immers_freeze_tend, Spack& nc_accret_tend, Spack& nc2nr_autoconv_tend, const Smask& context)
 {
   const auto sink_nc = (nc_collect_tend + nc2ni_immers_freeze_tend + nc_accret_tend + nc2nr_autoconv_tend)*dt;
   const auto source_nc = nc + nc_selfcollect_tend*dt;
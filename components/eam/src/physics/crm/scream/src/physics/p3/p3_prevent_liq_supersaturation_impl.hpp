@@ -12,13 +12,13 @@ namespace p3 {
 //This becomes a bit subtle because of the difference between condensational
 //versus sublimational heating in the psychrometric correction.
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::prevent_liq_supersaturation(const Spack& pres, const Spack& t_atm, const Spack& qv, const Spack& latent_heat_vapor, const Spack& latent_heat_sublim, const Scalar& dt, const Spack& qv2qi_vapdep_tend, const Spack& qinuc, Spack& qi2qv_sublim_tend, Spack& qr2qv_evap_tend, const Smask& context)
+void Functions<S,D,N>::prevent_liq_supersaturation(const Spack& pres, const Spack& t_atm, const Spack& qv, const Spack& latent_heat_vapor, const Spack& latent_heat_sublim, const Scalar& dt, const Spack& qv2qi_vapdep_tend, const Spack& qinuc, Spack& qi2qv_sublim_tend, Spack& qr2qv_evap_tend, const Smask& context)
 // Note: context masks cells which are just padding for packs or which don't have any condensate worth
 // performing calculations on.
 {
-  using physics = scream::physics::Functions<Scalar, Device>;
+  using physics = scream::physics::Functions<Scalar, Device, N>;
 
   constexpr Scalar inv_cp       = C::INV_CP;
   constexpr Scalar rv           = C::RV;
@@ -11,9 +11,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::compute_rain_fall_velocity(
   const view_2d_table& vn_table_vals, const view_2d_table& vm_table_vals,
   const Spack& qr_incld, const Spack& rhofacr,
@@ -33,9 +33,9 @@ void Functions<S,D>
   }
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::rain_sedimentation(
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
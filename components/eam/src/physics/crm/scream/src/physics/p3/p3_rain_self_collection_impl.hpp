@@ -6,9 +6,9 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::rain_self_collection(
   const Spack& rho, const Spack& qr_incld, const Spack& nr_incld, Spack& nr_selfcollect_tend,
   const Smask& context)
@@ -24,7 +24,7 @@ void Functions<S,D>
   const auto qr_incld_not_small = qr_incld >= qsmall && context;
 
   if (qr_incld_not_small.any()) {
-    const Real dum1 = 280.e-6;
+    const Scalar dum1 = 280.e-6;
     const auto dum2 = cbrt((qr_incld)/(pi*rho_h2o*nr_incld));
 
     Spack dum;
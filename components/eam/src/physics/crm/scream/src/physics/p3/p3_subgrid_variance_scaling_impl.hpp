@@ -6,10 +6,10 @@
 namespace scream {
 namespace p3 {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack
-Functions<S,D>::subgrid_variance_scaling(const Spack& relvar, const Scalar& expon)
+typename Functions<S,D,N>::Spack
+Functions<S,D,N>::subgrid_variance_scaling(const Spack& relvar, const Scalar& expon)
 {
   /* We assume subgrid variations in qc follow a gamma distribution with inverse 
      relative variance relvar = 1/(var(qc)/qc**2). In this case, if the tendency
@@ -11,9 +11,9 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::lookup (const Spack& mu_r,
           const Spack& lamr, Table3& tab,
           const Smask& context)
@@ -64,9 +64,9 @@ void Functions<S,D>
   }
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack Functions<S,D>
+typename Functions<S,D,N>::Spack Functions<S,D,N>
 ::apply_table (const view_2d_table& table,
                const Table3& tab3) {
   const auto rdumii_m_dumii = tab3.rdumii - Spack(tab3.dumii);
@@ -82,8 +82,8 @@ typename Functions<S,D>::Spack Functions<S,D>
   return dum1 + (tab3.rdumjj - Spack(tab3.dumjj)) * (dum2 - dum1);
 }
 
-template <typename S, typename D>
-void Functions<S,D>
+template <typename S, typename D, int N>
+void Functions<S,D,N>
 ::init_kokkos_tables (view_2d_table& vn_table_vals, view_2d_table& vm_table_vals,
                       view_2d_table& revap_table_vals, view_1d_table& mu_r_table_vals,
                       view_dnu_table& dnu) {
@@ -104,11 +104,17 @@ void Functions<S,D>
   const auto mu_table_h    = Kokkos::create_mirror_view(mu_r_table_vals_d);
   const auto dnu_table_h   = Kokkos::create_mirror_view(dnu_table_d);
 
-  // Need 2d-tables with fortran-style layout
+  // Need 2d-tables with fortran-style layout. The f90 tables are Real, so
+  // they are read into Real host tables and converted to Scalar below.
   using P3F         = Functions<Real, HostDevice>;
+  using LHostTable1 = typename P3F::KT::template lview<Real[C::MU_R_TABLE_DIM]>;
   using LHostTable2 = typename P3F::KT::template lview<Real[C::VTABLE_DIM0][C::VTABLE_DIM1]>;
+  LHostTable1 mu_table_lh("mu_table_lh");
   LHostTable2 vn_table_vals_lh("vn_table_vals_lh"), vm_table_vals_lh("vm_table_vals_lh"), revap_table_vals_lh("revap_table_vals_lh");
-  init_tables_from_f90_c(vn_table_vals_lh.data(), vm_table_vals_lh.data(), revap_table_vals_lh.data(), mu_table_h.data());
+  init_tables_from_f90_c(vn_table_vals_lh.data(), vm_table_vals_lh.data(), revap_table_vals_lh.data(), mu_table_lh.data());
+  for (int i = 0; i < C::MU_R_TABLE_DIM; ++i) {
+    mu_table_h(i) = mu_table_lh(i);
+  }
   for (int i = 0; i < C::VTABLE_DIM0; ++i) {
     for (int j = 0; j < C::VTABLE_DIM1; ++j) {
       vn_table_vals_h(i, j) = vn_table_vals_lh(i, j);
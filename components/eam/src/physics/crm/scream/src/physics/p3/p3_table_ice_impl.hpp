@@ -13,8 +13,8 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
-void Functions<S,D>
+template <typename S, typename D, int N>
+void Functions<S,D,N>
 ::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
 
   using DeviceIcetable = typename view_ice_table::non_const_type;
@@ -77,9 +77,9 @@ void Functions<S,D>
   collect_table_vals = collect_table_vals_d;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::lookup_ice (const Spack& qi, const Spack& ni,
               const Spack& qm, const Spack& rhop, TableIce& tab,
               const Smask& context)
@@ -137,9 +137,9 @@ void Functions<S,D>
   tab.dumzz -= 1;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::lookup_rain(const Spack& qr, const Spack& nr, TableRain& tab,
               const Smask& context)
 {
@@ -172,9 +172,9 @@ void Functions<S,D>
   tab.dumj -= 1;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack Functions<S,D>
+typename Functions<S,D,N>::Spack Functions<S,D,N>
 ::apply_table_ice(const int& idx, const view_ice_table& ice_table_vals, const TableIce& tab,
                   const Smask& context)
 {
@@ -216,9 +216,9 @@ typename Functions<S,D>::Spack Functions<S,D>
   return proc;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack Functions<S,D>
+typename Functions<S,D,N>::Spack Functions<S,D,N>
 ::apply_table_coll(const int& idx, const view_collect_table& collect_table_vals,
                    const TableIce& ti, const TableRain& tr,
                    const Smask& context)
@@ -6,11 +6,11 @@ namespace p3 {
 
 /*
  * Explicit instantiation for doing upwind functions on Reals using the
- * default device.
+ * default device, for each scalar type and pack size P3 is built for.
  */
 
-#define ETI_UPWIND(nfield)                                              \
-  template void Functions<Real,DefaultDevice>                           \
+#define ETI_UPWIND(S, N, nfield)                                        \
+  template void Functions<S,DefaultDevice,N>                            \
   ::calc_first_order_upwind_step<nfield>(                               \
     const uview_1d<const Spack>& rho,                                   \
     const uview_1d<const Spack>& inv_rho,                               \
@@ -21,13 +21,9 @@ namespace p3 {
     const view_1d_ptr_array<Spack, nfield>& flux,                       \
     const view_1d_ptr_array<Spack, nfield>& V,                          \
     const view_1d_ptr_array<Spack, nfield>& r);
-ETI_UPWIND(1)
-ETI_UPWIND(2)
-ETI_UPWIND(4)
-#undef ETI_UPWIND
 
-#define ETI_GENSED(nfield)                                              \
-  template void Functions<Real,DefaultDevice>                           \
+#define ETI_GENSED(S, N, nfield)                                        \
+  template void Functions<S,DefaultDevice,N>                            \
   ::generalized_sedimentation<nfield>(                                  \
     const uview_1d<const Spack>& rho,                                   \
     const uview_1d<const Spack>& inv_rho,                               \
@@ -38,12 +34,27 @@ ETI_UPWIND(4)
     const view_1d_ptr_array<Spack, nfield>& flux,                       \
     const view_1d_ptr_array<Spack, nfield>& V,                          \
     const view_1d_ptr_array<Spack, nfield>& r);
-ETI_GENSED(1)
-ETI_GENSED(2)
-ETI_GENSED(4)
+
+#define ETI_UPWIND_GENSED(S, N)                                         \
+  ETI_UPWIND(S, N, 1) ETI_UPWIND(S, N, 2) ETI_UPWIND(S, N, 4)           \
+  ETI_GENSED(S, N, 1) ETI_GENSED(S, N, 2) ETI_GENSED(S, N, 4)
+#define ETI_UPWIND_GENSED_REAL(unused, N) ETI_UPWIND_GENSED(Real, N)
+
+ETI_UPWIND_GENSED(Real, small_pack_size<Real>())
+#ifdef SCREAM_MIXED_PRECISION
+ETI_UPWIND_GENSED(float, small_pack_size<float>())
+#endif
+SCREAM_FOR_EACH_EXTRA_PACK_SIZE(ETI_UPWIND_GENSED_REAL, )
+#undef ETI_UPWIND_GENSED_REAL
+#undef ETI_UPWIND_GENSED
 #undef ETI_GENSED
+#undef ETI_UPWIND
 
 template struct Functions<Real,DefaultDevice>;
+#ifdef SCREAM_MIXED_PRECISION
+template struct Functions<float,DefaultDevice>;
+#endif
+SCREAM_ETI_EXTRA_PACK_SIZES(Functions)
 
 } // namespace p3
 } // namespace scream
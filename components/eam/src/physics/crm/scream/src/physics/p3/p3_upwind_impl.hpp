@@ -11,10 +11,10 @@ namespace p3 {
  * this file, #include p3_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 template <Int kdir, int nfield>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calc_first_order_upwind_step (
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
@@ -90,10 +90,10 @@ void Functions<S,D>
     });
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 template <int nfield>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::generalized_sedimentation (
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
@@ -128,10 +128,10 @@ void Functions<S,D>
   dt_left -= dt_sub;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 template <int nfield>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calc_first_order_upwind_step (
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
@@ -150,9 +150,9 @@ void Functions<S,D>
       rho, inv_rho, inv_dz, team, nk, k_bot, k_top, dt_sub, flux, V, r);
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calc_first_order_upwind_step (
   const uview_1d<const Spack>& rho,
   const uview_1d<const Spack>& inv_rho,
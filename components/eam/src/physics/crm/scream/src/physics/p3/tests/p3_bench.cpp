@@ -0,0 +1,212 @@
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_functions_f90.hpp"
+#include "physics/p3/p3_ic_cases.hpp"
+#include "physics/share/physics_bench.hpp"
+#include "physics/share/physics_pack_dispatch.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace {
+using namespace scream;
+using namespace scream::p3;
+
+/*
+ * p3_bench times p3_main over every ic::Factory case and every combination
+ * of the requested ncol and nlev values. For each configuration, w warmup
+ * calls are discarded, then r calls are timed. Each call starts from a
+ * freshly created initial condition, so that all samples do the same work.
+ * Three stages are reported:
+ *   - total:  wall time of p3_main, including the host<->device bridge;
+ *   - main:   the time reported by p3_main for the main kernel;
+ *   - bridge: total - main (data transfer, transposes, table setup).
+ * The Fortran timer is too coarse for this split, so with -f only total is
+ * reported. The C++ impl is run with each pack size given with -p; sizes
+ * other than SCREAM_SMALL_PACK_SIZE need to be in SCREAM_EXTRA_PACK_SIZES.
+ * With -p auto, each configuration is only timed with the fastest size, as
+ * picked by physics::calibrate_pack_size. The thread count is the one Kokkos
+ * was initialized with (e.g. via OMP_NUM_THREADS), so it is swept by running
+ * several processes, whose CSV outputs can be concatenated: each record
+ * carries its pack and thread count.
+ */
+
+struct IcCase {
+  ic::Factory::IC ic;
+  std::string name;
+};
+
+const std::vector<IcCase> ic_cases = {
+  {ic::Factory::mixed, "mixed"}
+};
+
+struct Input {
+  std::vector<Int> ncols = {8, 64, 512};
+  std::vector<Int> nlevs = {72, 128};
+  Int warmup = 2;
+  Int repeat = 10;
+  std::vector<Int> packs = {SCREAM_SMALL_PACK_SIZE};
+  bool calibrate = false;
+  bool use_fortran = false;
+  std::string output = "-";
+  std::string format = "csv";
+  std::string baseline;
+  double tol = 0.1;
+};
+
+// Time one p3_main call from a fresh initial condition. Return the total
+// and main times [s].
+std::pair<double,double> time_p3_main (const IcCase& icc, const Int ncol, const Int nlev,
+                                       const bool use_fortran) {
+  const auto d = ic::Factory::create(icc.ic, ncol, nlev);
+  d->dt                = 300;
+  d->it                = 1;
+  d->do_predict_nc     = true;
+  d->do_prescribed_CCN = false;
+
+  const auto start = std::chrono::steady_clock::now();
+  const Int main_microsec = p3_main(*d, use_fortran);
+  const auto finish = std::chrono::steady_clock::now();
+  return {std::chrono::duration<double>(finish - start).count(), 1e-6*main_microsec};
+}
+
+void run (const Input& in, bench::Report& report) {
+  p3_init();
+  for (const auto& icc : ic_cases) {
+    for (const auto ncol : in.ncols) {
+      for (const auto nlev : in.nlevs) {
+        auto packs = in.packs;
+        if (in.use_fortran) {
+          packs = {1};
+        } else if (in.calibrate) {
+          packs = {physics::calibrate_pack_size([&] (int) {
+                time_p3_main(icc, ncol, nlev, false);
+              })};
+        }
+
+        for (const auto pack : packs) {
+          if (!in.use_fortran) physics::set_pack_size(pack);
+          const bench::Config c{"p3", icc.name, in.use_fortran ? "f90" : "cxx", ncol, nlev,
+                                pack, bench::default_concurrency()};
+          std::cerr << "Running P3 " << icc.name << " with ncol=" << ncol
+                    << ", nlev=" << nlev << ", pack=" << c.pack
+                    << ", threads=" << c.threads << std::endl;
+
+          std::vector<double> total, kernel, bridge;
+          for (Int r = -in.warmup; r < in.repeat; ++r) {
+            const auto t = time_p3_main(icc, ncol, nlev, in.use_fortran);
+            if (r < 0) continue;
+
+            total.push_back(t.first);
+            kernel.push_back(t.second);
+            bridge.push_back(std::max(0.0, t.first - t.second));
+          }
+          report.add(c, "total", total);
+          if (!in.use_fortran) {
+            report.add(c, "main",   kernel);
+            report.add(c, "bridge", bridge);
+          }
+        }
+      }
+    }
+  }
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  Input in;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-h", "--help")) {
+      std::cout <<
+        argv[0] << " [options]\n"
+        "Options:\n"
+        "  -f                Use fortran impls instead of c++. Default False.\n"
+        "  -i <ncols>        Comma-separated numbers of columns. Default=8,64,512.\n"
+        "  -k <nlevs>        Comma-separated numbers of vertical levels. Default=72,128.\n"
+        "  -p <packs>        Comma-separated pack sizes, all, or auto (fastest). Default=" << SCREAM_SMALL_PACK_SIZE << ".\n"
+        "  -w <warmup>       Number of untimed warmup calls per configuration. Default=2.\n"
+        "  -r <repeat>       Number of timed calls per configuration. Default=10.\n"
+        "  -o <file>         Output file, - for stdout (after the session banner). Default=-.\n"
+        "  -F <format>       csv|json. Default=csv.\n"
+        "  -c <baseline>     CSV of a previous run; fail if a median is slower by more than tol.\n"
+        "  -t <tol>          Relative tolerance for -c. Default=0.1.\n";
+      return 0;
+    }
+    if (ekat::argv_matches(argv[i], "-f", "--fortran")) in.use_fortran = true;
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.ncols = bench::parse_int_list(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.nlevs = bench::parse_int_list(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-p", "--pack")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.calibrate = std::string(argv[i]) == "auto";
+      if (!in.calibrate) in.packs = bench::parse_pack_list(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-w", "--warmup")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.warmup = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.repeat = std::atoi(argv[i]);
+      EKAT_REQUIRE_MSG(in.repeat > 0, "Number of repetitions must be positive");
+    }
+    if (ekat::argv_matches(argv[i], "-o", "--output")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.output = argv[i];
+    }
+    if (ekat::argv_matches(argv[i], "-F", "--format")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.format = argv[i];
+      EKAT_REQUIRE_MSG(in.format == "csv" || in.format == "json",
+                       "Format must be one of csv|json");
+    }
+    if (ekat::argv_matches(argv[i], "-c", "--compare")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.baseline = argv[i];
+    }
+    if (ekat::argv_matches(argv[i], "-t", "--tol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      in.tol = std::atof(argv[i]);
+    }
+  }
+
+  int nerr = 0;
+  scream::initialize_scream_session(argc, argv); {
+    bench::Report report;
+    run(in, report);
+    report.write(in.output, in.format);
+    if (!in.baseline.empty()) {
+      nerr += report.compare(in.baseline, in.tol);
+    }
+    P3GlobalForFortran::deinit();
+  } scream::finalize_scream_session();
+
+  return nerr != 0 ? 1 : 0;
+}
@@ -4,12 +4,15 @@
 #include "physics/p3/p3_f90.hpp"
 #include "physics/p3/p3_functions_f90.hpp"
 #include "physics/p3/p3_ic_cases.hpp"
+#include "physics/share/physics_bench.hpp"
+#include "physics/share/physics_pack_dispatch.hpp"
 
 #include "ekat/util/ekat_file_utils.hpp"
 #include "ekat/util/ekat_test_utils.hpp"
 #include "ekat/ekat_assert.hpp"
 
 #include <chrono>
+#include <map>
 #include <vector>
 
 namespace {
@@ -26,25 +29,50 @@ using namespace scream::p3;
  * tests are run with log_PredictNc=true and false and also for 1 step or
  * 6 steps. This creates a total of 4 different cases. When 6 steps are run,
  * output for each step is considered separately.
+ *
+ * With -m, the c++ p3_main runs in mixed precision (float kernels on wider
+ * packs; needs SCREAM_MIXED_PRECISION). No baseline file is used: the double
+ * c++ p3_main is run alongside it from the same initial condition, so that
+ * only the effect of the float kernels is measured, and not the differences
+ * between the c++ and fortran impls. Unless -t is given, each field is
+ * checked against its mixed precision tolerance below, and the largest
+ * relative difference of each field over all cases and steps is reported,
+ * to assess the accuracy of the mixed mode.
+ *
+ * With -P, the c++ p3_main is likewise run alongside itself at the default
+ * pack size, once for each of the given pack sizes (SCREAM_EXTRA_PACK_SIZES),
+ * and checked to be BFB with it unless -t is given.
  */
 
+/* Relative tolerances of a mixed precision run: mixed_tol, except for the
+ * fields in mixed_field_tols. The state is updated in double by the bridge,
+ * so th_atm and qv are held to tighter ones. The values are a few times the
+ * largest differences over the default cases.
+ */
+constexpr Real mixed_tol = 5e-3;
+const std::map<std::string, Real> mixed_field_tols = {
+  {"th_atm", 1e-5}, {"qv", 1e-4}
+};
+
 
 /* Given a column of data for variable "label" from the reference run
  * (probably master) and from your new exploratory run, loop over all
  * heights and confirm whether or not the relative difference between
  * runs is within tolerance "tol". If not, print debug info. Here, "a"
  * is the value from the reference run and "b" is from the new run.
+ * The largest relative difference is returned in max_rel_diff.
  */
 template <typename Scalar>
 static Int compare (const std::string& label, const Scalar* a,
-                    const Scalar* b, const Int& n, const Real& tol) {
+                    const Scalar* b, const Int& n, const Real& tol,
+                    Real& max_rel_diff) {
 
   Int nerr1 = 0;
   Int nerr2 = 0;
   Real den = 0;
   for (Int i = 0; i < n; ++i)
     den = std::max(den, std::abs(a[i]));
-  Real worst = 0;
+  Real worst = 0, max_diff = 0;
   for (Int i = 0; i < n; ++i) {
     if (std::isnan(a[i]) || std::isinf(a[i]) ||
         std::isnan(b[i]) || std::isinf(b[i])) {
@@ -53,11 +81,13 @@ static Int compare (const std::string& label, const Scalar* a,
     }
 
     const auto num = std::abs(a[i] - b[i]);
+    max_diff = std::max(max_diff, num);
     if (num > tol*den) {
       ++nerr2;
       worst = std::max(worst, num);
     }
   }
+  max_rel_diff = den > 0 ? max_diff/den : 0;
 
   if (nerr1) {
     std::cout << label << " has " << nerr1 << " infs + nans.\n";
@@ -73,12 +103,15 @@ static Int compare (const std::string& label, const Scalar* a,
   return nerr1 + nerr2;
 }
 
- /* When called with the below 3 args, compare loops over all variables
+ /* When called with the below args, compare loops over all variables
   * and calls the above version of "compare" to check for and report
-  * large discrepancies.
+  * large discrepancies. A variable in field_tols is checked against its own
+  * tolerance instead of tol. If max_rel_diffs is given, it accumulates the
+  * largest relative difference of each variable.
   */
- Int compare (const double& tol,
-             const FortranData::Ptr& ref, const FortranData::Ptr& d) {
+ Int compare (const double& tol, const std::map<std::string, Real>& field_tols,
+             const FortranData::Ptr& ref, const FortranData::Ptr& d,
+             std::map<std::string, Real>* max_rel_diffs = nullptr) {
 
   Int nerr = 0;
   FortranDataIterator refi(ref), di(d);
@@ -87,7 +120,14 @@ static Int compare (const std::string& label, const Scalar* a,
     const auto& fr = refi.getfield(i);
     const auto& fd = di.getfield(i);
     EKAT_ASSERT(fr.size == fd.size);
-    nerr += compare(fr.name, fr.data, fd.data, fr.size, tol);
+    const auto ft = field_tols.find(fr.name);
+    const Real field_tol = ft == field_tols.end() ? tol : ft->second;
+    Real max_rel_diff;
+    nerr += compare(fr.name, fr.data, fd.data, fr.size, field_tol, max_rel_diff);
+    if (max_rel_diffs) {
+      auto& m = (*max_rel_diffs)[fr.name];
+      m = std::max(m, max_rel_diff);
+    }
   }
   return nerr;
 }
@@ -118,7 +158,7 @@ struct Baseline {
     }
   }
 
-  Int generate_baseline (const std::string& filename, bool use_fortran) {
+  Int generate_baseline (const std::string& filename, bool use_fortran, bool use_mixed) {
     auto fid = ekat::FILEPtr(fopen(filename.c_str(), "w"));
     EKAT_REQUIRE_MSG( fid, "generate_baseline can't write " << filename);
     Int nerr = 0;
@@ -139,13 +179,14 @@ struct Baseline {
                     << ", prescribed_CCN=" << d->do_prescribed_CCN;
 
           if (!use_fortran) {
-            std::cout << ", small_packn=" << SCREAM_SMALL_PACK_SIZE;
+            std::cout << ", small_packn="
+                      << (use_mixed ? small_pack_size<float>() : SCREAM_SMALL_PACK_SIZE);
           }
           std::cout << std::endl;
         }
 
         for (int it=0; it<ps.nsteps; it++) {
-          Int current_microsec = p3_main(*d, use_fortran);
+          Int current_microsec = p3_main(*d, use_fortran, use_mixed);
 
           if (r != -1 && ps.repeat > 0) { // do not count the "cold" run
             total_duration_microsec += current_microsec;
@@ -186,7 +227,7 @@ struct Baseline {
           std::cout << "--- checking case # " << case_num << ", timestep # " << it+1 << " of " << ps.nsteps << " ---\n" << std::flush;
           read(fid, d_ref);
           p3_main(*d, use_fortran);
-          ne = compare(tol, d_ref, d);
+          ne = compare(tol, {}, d_ref, d);
           if (ne) std::cout << "Ref impl failed.\n";
           nerr += ne;
         }
@@ -195,6 +236,41 @@ struct Baseline {
     return nerr;
   }
 
+  // Run the c++ impl and the double c++ impl at the default pack size side
+  // by side, and compare them after each step. The former runs in mixed
+  // precision if use_mixed, else at pack size packn.
+  Int run_and_cmp_cxx (const double& tol, const std::map<std::string, Real>& field_tols,
+                       bool use_mixed, const Int packn) {
+    const std::string label = use_mixed ? "mixed precision" : "pack size " + std::to_string(packn);
+    Int nerr = 0, ne;
+    std::map<std::string, Real> max_rel_diffs;
+    int case_num = 0;
+    for (auto ps : params_) {
+      case_num++;
+      const auto d_ref = ic::Factory::create(ps.ic, ps.ncol, ps.nlev);
+      set_params(ps, *d_ref);
+      const auto d = ic::Factory::create(ps.ic, ps.ncol, ps.nlev);
+      set_params(ps, *d);
+      p3_init();
+      for (int it=0; it<ps.nsteps; it++) {
+        std::cout << "--- checking case # " << case_num << ", timestep # " << it+1 << " of " << ps.nsteps << " ---\n" << std::flush;
+        physics::set_pack_size(SCREAM_SMALL_PACK_SIZE);
+        p3_main(*d_ref, false, false);
+        physics::set_pack_size(packn);
+        p3_main(*d, false, use_mixed);
+        ne = compare(tol, field_tols, d_ref, d, &max_rel_diffs);
+        if (ne) std::cout << "The " << label << " run failed.\n";
+        nerr += ne;
+      }
+    }
+    physics::set_pack_size(SCREAM_SMALL_PACK_SIZE);
+    std::cout << "Max rel diff of the " << label << " run, per field:\n";
+    for (const auto& it : max_rel_diffs) {
+      printf("  %-24s %1.3e\n", it.first.c_str(), it.second);
+    }
+    return nerr;
+  }
+
 private:
 
   // Full specification for a run
@@ -260,6 +336,7 @@ int main (int argc, char** argv) {
       "Options:\n"
       "  -g                  Generate baseline file. Default False.\n"
       "  -f                  Use fortran impls instead of c++. Default False.\n"
+      "  -m                  Run c++ impls in mixed precision. Default False.\n"
       "  -t <tol>            Tolerance for relative error. Default 0.\n"
       "  -s <steps>          Number of timesteps. Default=6.\n"
       "  -dt <seconds>       Length of timestep. Default=300.\n"
@@ -267,11 +344,13 @@ int main (int argc, char** argv) {
       "  -k <nlev>           Number of vertical levels. Default=72.\n"
       "  -r <repeat>         Number of repetitions, implies timing run (generate + no I/O). Default=0.\n"
       "  -p <predict_nc>     yes|no|both. Default=both.\n"
-      "  -c <prescribed_ccn> yes|no|both. Default=both.\n";
+      "  -c <prescribed_ccn> yes|no|both. Default=both.\n"
+      "  -P <packs>          Comma-separated pack sizes, or all; compare the c++ impl at each\n"
+      "                      with the c++ impl at the default pack size. Default=none.\n";
     return 1;
   }
 
-  bool generate = false, use_fortran = false;
+  bool generate = false, use_fortran = false, use_mixed = false, tol_given = false;
   scream::Real tol = SCREAM_BFB_TESTING ? 0 : std::numeric_limits<Real>::infinity();
   Int timesteps = 6;
   Int dt = 300;
@@ -282,13 +361,16 @@ int main (int argc, char** argv) {
   std::string predict_nc = "both";
   std::string prescribed_ccn = "both";
   std::string baseline_fn;
-  for (int i = 1; i < argc-1; ++i) {
+  std::vector<Int> packs;
+  for (int i = 1; i < argc; ++i) {
     if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
     if (ekat::argv_matches(argv[i], "-f", "--fortran")) use_fortran = true;
+    if (ekat::argv_matches(argv[i], "-m", "--mixed")) use_mixed = true;
     if (ekat::argv_matches(argv[i], "-t", "--tol")) {
       expect_another_arg(i, argc);
       ++i;
       tol = std::atof(argv[i]);
+      tol_given = true;
     }
     if (ekat::argv_matches(argv[i], "-b", "--baseline-file")) {
       expect_another_arg(i, argc);
@@ -342,6 +424,26 @@ int main (int argc, char** argv) {
       EKAT_REQUIRE_MSG(prescribed_ccn == "yes" || prescribed_ccn == "no" || prescribed_ccn == "both",
                        "Prescribed CCN option value must be one of yes|no|both");
     }
+    if (ekat::argv_matches(argv[i], "-P", "--pack")) {
+      expect_another_arg(i, argc);
+      ++i;
+      packs = scream::bench::parse_pack_list(argv[i]);
+    }
+  }
+  EKAT_REQUIRE_MSG(packs.empty() || !(use_fortran || use_mixed),
+                   "Pack sizes can only be compared for the double c++ impl.");
+
+  // A mixed precision run is not BFB with the baseline. Unless a tolerance
+  // is given, check each field against its mixed precision tolerance.
+  std::map<std::string, Real> field_tols;
+  if (use_mixed && !tol_given) {
+    tol = mixed_tol;
+    field_tols = mixed_field_tols;
+  }
+
+  // The pack size does not change the result of p3_main.
+  if (!packs.empty() && !tol_given) {
+    tol = 0;
   }
 
   // Decorate baseline name with precision.
@@ -376,7 +478,15 @@ int main (int argc, char** argv) {
     Baseline bln(timesteps, static_cast<Real>(dt), ncol, nlev, repeat, predict_nc, prescribed_ccn);
     if (generate) {
       std::cout << "Generating to " << baseline_fn << "\n";
-      nerr += bln.generate_baseline(baseline_fn, use_fortran);
+      nerr += bln.generate_baseline(baseline_fn, use_fortran, use_mixed);
+    } else if (use_mixed) {
+      printf("Comparing with the double c++ impl at tol %1.1e\n", tol);
+      nerr += bln.run_and_cmp_cxx(tol, field_tols, true, SCREAM_SMALL_PACK_SIZE);
+    } else if (!packs.empty()) {
+      for (const auto n : packs) {
+        printf("Comparing pack size %d with pack size %d at tol %1.1e\n", n, SCREAM_SMALL_PACK_SIZE, tol);
+        nerr += bln.run_and_cmp_cxx(tol, field_tols, false, n);
+      }
     } else {
       printf("Comparing with %s at tol %1.1e\n", baseline_fn.c_str(), tol);
       nerr += bln.run_and_cmp(baseline_fn, tol, use_fortran);
@@ -0,0 +1,176 @@
+#include "physics_bench.hpp"
+#include "physics_pack_dispatch.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+
+namespace scream {
+namespace bench {
+
+namespace {
+
+// Percentile p in [0,1] of the sorted samples s.
+double percentile (const std::vector<double>& s, const double p) {
+  const double x = p*(s.size() - 1);
+  const size_t i = static_cast<size_t>(x);
+  if (i + 1 >= s.size()) return s.back();
+  return s[i] + (x - i)*(s[i+1] - s[i]);
+}
+
+std::vector<std::string> split (const std::string& s, const char delim) {
+  std::vector<std::string> tokens;
+  std::istringstream is(s);
+  std::string token;
+  while (std::getline(is, token, delim)) tokens.push_back(token);
+  return tokens;
+}
+
+// The fields identifying a record, as they appear in the CSV.
+std::string key (const Config& c, const std::string& stage) {
+  std::ostringstream os;
+  os << c.scheme << "," << c.ic << "," << c.impl << "," << c.ncol << "," << c.nlev
+     << "," << c.pack << "," << c.threads << "," << stage;
+  return os.str();
+}
+
+constexpr int num_key_fields = 8;
+
+} // namespace anon
+
+Stats compute_stats (std::vector<double> samples) {
+  EKAT_REQUIRE_MSG(!samples.empty(), "Error! Cannot compute stats of zero samples.\n");
+  std::sort(samples.begin(), samples.end());
+
+  Stats s;
+  s.n      = samples.size();
+  s.min    = samples.front();
+  s.p10    = percentile(samples, 0.1);
+  s.median = percentile(samples, 0.5);
+  s.p90    = percentile(samples, 0.9);
+  s.max    = samples.back();
+  s.mean   = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+  return s;
+}
+
+void Report::add (const Config& c, const std::string& stage, const std::vector<double>& samples) {
+  Record r;
+  r.config = c;
+  r.stage  = stage;
+  r.stats  = compute_stats(samples);
+  r.cols_per_sec = r.stats.median > 0 ? c.ncol / r.stats.median : 0;
+  m_records.push_back(r);
+}
+
+void Report::write_csv (std::ostream& os, const bool header) const {
+  if (header) {
+    os << "scheme,ic,impl,ncol,nlev,pack,threads,stage,"
+       << "n,min,p10,median,p90,max,mean,cols_per_sec\n";
+  }
+  char buf[256];
+  for (const auto& r : m_records) {
+    const auto& s = r.stats;
+    std::snprintf(buf, sizeof(buf), "%d,%.6e,%.6e,%.6e,%.6e,%.6e,%.6e,%.6e",
+                  s.n, s.min, s.p10, s.median, s.p90, s.max, s.mean, r.cols_per_sec);
+    os << key(r.config, r.stage) << "," << buf << "\n";
+  }
+}
+
+void Report::write_json (std::ostream& os) const {
+  char buf[256];
+  os << "[\n";
+  for (size_t i = 0; i < m_records.size(); ++i) {
+    const auto& r = m_records[i];
+    const auto& c = r.config;
+    const auto& s = r.stats;
+    os << "  {\"scheme\": \"" << c.scheme << "\", \"ic\": \"" << c.ic
+       << "\", \"impl\": \"" << c.impl << "\", \"ncol\": " << c.ncol
+       << ", \"nlev\": " << c.nlev << ", \"pack\": " << c.pack
+       << ", \"threads\": " << c.threads << ", \"stage\": \"" << r.stage << "\", ";
+    std::snprintf(buf, sizeof(buf),
+                  "\"n\": %d, \"min\": %.6e, \"p10\": %.6e, \"median\": %.6e, "
+                  "\"p90\": %.6e, \"max\": %.6e, \"mean\": %.6e, \"cols_per_sec\": %.6e}",
+                  s.n, s.min, s.p10, s.median, s.p90, s.max, s.mean, r.cols_per_sec);
+    os << buf << (i+1 < m_records.size() ? ",\n" : "\n");
+  }
+  os << "]\n";
+}
+
+void Report::write (const std::string& filename, const std::string& format) const {
+  EKAT_REQUIRE_MSG(format == "csv" || format == "json",
+                   "Error! Unsupported report format '" << format << "'; use csv or json.\n");
+  std::ofstream ofs;
+  const bool to_stdout = filename.empty() || filename == "-";
+  if (!to_stdout) {
+    ofs.open(filename);
+    EKAT_REQUIRE_MSG(ofs.good(), "Error! Cannot write " << filename << ".\n");
+  }
+  std::ostream& os = to_stdout ? std::cout : ofs;
+  if (format == "csv") write_csv(os);
+  else                 write_json(os);
+}
+
+Int Report::compare (const std::string& baseline_csv, const double tol) const {
+  std::ifstream ifs(baseline_csv);
+  EKAT_REQUIRE_MSG(ifs.good(), "Error! Cannot read " << baseline_csv << ".\n");
+
+  // key -> baseline median
+  std::map<std::string, double> baseline;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    const auto tokens = split(line, ',');
+    if (tokens.size() < num_key_fields + 4 || tokens[0] == "scheme") continue;
+    std::string k = tokens[0];
+    for (int i = 1; i < num_key_fields; ++i) k += "," + tokens[i];
+    baseline[k] = std::atof(tokens[num_key_fields + 3].c_str());
+  }
+
+  Int nslow = 0;
+  for (const auto& r : m_records) {
+    const auto it = baseline.find(key(r.config, r.stage));
+    if (it == baseline.end() || it->second <= 0) continue;
+    const double rel = r.stats.median / it->second - 1;
+    if (rel > tol) {
+      std::printf("Regression: %s median %.3e s vs baseline %.3e s (%+.1f%%)\n",
+                  key(r.config, r.stage).c_str(), r.stats.median, it->second, 100*rel);
+      ++nslow;
+    }
+  }
+  return nslow;
+}
+
+std::vector<Int> parse_int_list (const std::string& s) {
+  std::vector<Int> values;
+  for (const auto& token : split(s, ',')) {
+    if (token.empty()) continue;
+    const Int v = std::atoi(token.c_str());
+    EKAT_REQUIRE_MSG(v > 0, "Error! Expected a list of positive ints, got '" << s << "'.\n");
+    values.push_back(v);
+  }
+  EKAT_REQUIRE_MSG(!values.empty(), "Error! Empty list '" << s << "'.\n");
+  return values;
+}
+
+std::vector<Int> parse_pack_list (const std::string& s) {
+  const auto available = physics::available_pack_sizes();
+  if (s == "all") return std::vector<Int>(available.begin(), available.end());
+  const auto values = parse_int_list(s);
+  for (const auto v : values) {
+    EKAT_REQUIRE_MSG(std::find(available.begin(), available.end(), v) != available.end(),
+                     "Error! Pack size " << v << " is not built; add it to SCREAM_EXTRA_PACK_SIZES.\n");
+  }
+  return values;
+}
+
+Int default_concurrency () {
+  return DefaultDevice::execution_space().concurrency();
+}
+
+} // namespace bench
+} // namespace scream
@@ -0,0 +1,94 @@
+#ifndef SCREAM_PHYSICS_BENCH_HPP
+#define SCREAM_PHYSICS_BENCH_HPP
+
+#include "share/scream_types.hpp"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/*
+The bench namespace collects the pieces shared by the standalone benchmark
+drivers of the physics schemes (p3_bench, shoc_bench): summary statistics of
+timing samples, and a Report that accumulates one record per (configuration,
+stage) and writes them as CSV or JSON. A Report can also be compared against
+the CSV of a previous run, so that a nightly job can flag regressions:
+
+  bench::Report report;
+  for (each configuration c) {
+    std::vector<double> total, main;   // one sample [s] per timed repetition
+    ...
+    report.add(c, "total", total);
+    report.add(c, "main", main);
+  }
+  report.write("p3_bench.csv", "csv");
+  nerr += report.compare("p3_bench.baseline.csv", 0.1);
+*/
+
+namespace scream {
+namespace bench {
+
+// Summary of a set of timing samples, in seconds. Percentiles are linearly
+// interpolated between the order statistics.
+struct Stats {
+  Int n;
+  double min, p10, median, p90, max, mean;
+};
+
+Stats compute_stats(std::vector<double> samples);
+
+// One benchmark configuration. pack is the small pack size the scheme ran
+// with and threads the concurrency of the default execution space, so CSVs
+// of several builds and thread counts can simply be concatenated.
+struct Config {
+  std::string scheme; // e.g. p3, shoc
+  std::string ic;     // name of the ic::Factory case
+  std::string impl;   // cxx or f90
+  Int ncol, nlev, pack, threads;
+};
+
+struct Record {
+  Config      config;
+  std::string stage;
+  Stats       stats;
+  double      cols_per_sec; // ncol / median
+};
+
+class Report {
+public:
+  // Add the record of stage for configuration c. samples are in seconds.
+  void add(const Config& c, const std::string& stage, const std::vector<double>& samples);
+
+  const std::vector<Record>& records() const { return m_records; }
+
+  void write_csv(std::ostream& os, const bool header = true) const;
+  void write_json(std::ostream& os) const;
+
+  // Write the records to filename in format ("csv" or "json"). If filename
+  // is empty or "-", write to stdout.
+  void write(const std::string& filename, const std::string& format) const;
+
+  // Compare the median times against those in baseline_csv, a file written
+  // by write_csv. Records that are slower than the baseline by more than
+  // the relative tolerance tol are reported and counted; records with no
+  // matching (config, stage) in the baseline are skipped. Returns the count.
+  Int compare(const std::string& baseline_csv, const double tol) const;
+
+private:
+  std::vector<Record> m_records;
+};
+
+// Parse a comma-separated list of ints, e.g. "1,8,64".
+std::vector<Int> parse_int_list(const std::string& s);
+
+// Parse a list of pack sizes: "all" for physics::available_pack_sizes(),
+// otherwise as parse_int_list. Each size must be available.
+std::vector<Int> parse_pack_list(const std::string& s);
+
+// Concurrency of the default execution space.
+Int default_concurrency();
+
+} // namespace bench
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_BENCH_HPP
@@ -20,11 +20,11 @@ namespace physics {
  *  - Kokkos team policies have a vector length of 1
  */
 
-template <typename ScalarT, typename DeviceT>
+template <typename ScalarT, typename DeviceT, int PackN = small_pack_size<ScalarT>()>
 struct Functions
 {
 
-  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1};
+  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1, MurphyKoopTable = 2};
 
   //
   // ------- Types --------
@@ -35,8 +35,10 @@ struct Functions
 
   template <typename S>
   using BigPack = ekat::Pack<Scalar,SCREAM_PACK_SIZE>;
+  // PackN defaults to small_pack_size<Scalar>(); other widths are built with
+  // SCREAM_EXTRA_PACK_SIZES (see physics_pack_dispatch.hpp).
   template <typename S>
-  using SmallPack = ekat::Pack<S,SCREAM_SMALL_PACK_SIZE>;
+  using SmallPack = ekat::Pack<S,PackN>;
 
   using IntSmallPack = SmallPack<Int>;
   using Pack         = BigPack<Scalar>;
@@ -92,6 +94,23 @@ struct Functions
   KOKKOS_FUNCTION
   static Spack MurphyKoop_svp(const Spack& t, const bool ice, const Smask& range_mask);
 
+  //  compute saturation vapor pressure by interpolating a table of the
+  //  Murphy and Koop (2005) formulation, which avoids evaluating transcendental
+  //  functions other than a single exp.
+  //  tabulated_svp returned in units of pa.
+  //  t is input in units of k.
+  //  ice refers to saturation with respect to liquid (false) or ice (true)
+  //  For svp_table_tmin <= t < svp_table_tmax, the relative difference with
+  //  MurphyKoop_svp is at most svp_table_max_rel_err in double precision
+  //  (in single precision, it is dominated by roundoff, ~1e-5); other
+  //  temperatures fall back to MurphyKoop_svp.
+  KOKKOS_FUNCTION
+  static Spack tabulated_svp(const Spack& t, const bool ice, const Smask& range_mask);
+
+  static constexpr Scalar svp_table_tmin = 101;   // [K]
+  static constexpr Scalar svp_table_tmax = 399;   // [K]
+  static constexpr Scalar svp_table_max_rel_err = 5e-7;
+
   // Calls a function to obtain the saturation vapor pressure, and then computes
   // and returns the saturation mixing ratio, with respect to either liquid or ice,
   // depending on value of 'ice'
@@ -0,0 +1,81 @@
+#ifndef SCREAM_PHYSICS_MIXED_PRECISION_HPP
+#define SCREAM_PHYSICS_MIXED_PRECISION_HPP
+
+#include "share/scream_types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace scream {
+namespace physics {
+
+/*
+ * KernelArrays holds copies, in the kernel scalar type S, of host arrays of
+ * Reals passed to a bridge. It lets a bridge that takes Real* arguments run
+ * a kernel instantiated for a narrower S (mixed precision mode), so that only
+ * the computation of the rates and of the new values is done in S. Each
+ * array is copied and rounded to S on add, and copy_back writes the results
+ * of the kernel back according to the intent of the array:
+ *  - In: not written back.
+ *  - Out: overwritten by the kernel, so the copy is widened back.
+ *  - State: prognostic state updated by the kernel. The state stays in Real:
+ *    the kernel's change (output minus the rounded input) is added to the
+ *    Real value, so values left unchanged by the kernel are not rounded.
+ *    Values the kernel set to zero are set to zero exactly, rather than to
+ *    the rounding error of the input.
+ *
+ *   KernelArrays<float> f;
+ *   const auto nerr = kernel_f<float>(f.add(qc, n, Intent::State), f.add(pres, n), ...);
+ *   f.copy_back();
+ */
+template <typename S>
+class KernelArrays {
+public:
+  enum class Intent { In, Out, State };
+
+  // Return a copy of the n values of data, which copy_back handles according
+  // to intent.
+  S* add (Real* data, const Int n, const Intent intent = Intent::In) {
+    m_arrays.push_back(Array{data, n, intent, std::unique_ptr<S[]>(new S[n])});
+    auto& a = m_arrays.back();
+    for (Int i = 0; i < n; ++i) a.copy[i] = data[i];
+    return a.copy.get();
+  }
+
+  void copy_back () const {
+    for (const auto& a : m_arrays) {
+      switch (a.intent) {
+        case Intent::In:
+          break;
+        case Intent::Out:
+          for (Int i = 0; i < a.n; ++i) a.data[i] = a.copy[i];
+          break;
+        case Intent::State:
+          for (Int i = 0; i < a.n; ++i) {
+            const S in = static_cast<S>(a.data[i]);
+            if (a.copy[i] == 0) {
+              a.data[i] = 0;
+            } else if (a.copy[i] != in) {
+              a.data[i] += static_cast<Real>(a.copy[i]) - static_cast<Real>(in);
+            }
+          }
+          break;
+      }
+    }
+  }
+
+private:
+  struct Array {
+    Real* data;
+    Int n;
+    Intent intent;
+    std::unique_ptr<S[]> copy;
+  };
+
+  std::vector<Array> m_arrays;
+};
+
+} // namespace physics
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_MIXED_PRECISION_HPP
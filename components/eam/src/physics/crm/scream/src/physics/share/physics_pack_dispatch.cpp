@@ -0,0 +1,59 @@
+#include "physics_pack_dispatch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace scream {
+namespace physics {
+
+namespace {
+int g_pack_size = SCREAM_SMALL_PACK_SIZE;
+}
+
+std::vector<int> available_pack_sizes () {
+  std::vector<int> sizes = {SCREAM_SMALL_PACK_SIZE};
+#define SCREAM_ADD_PACK_SIZE(unused, N) sizes.push_back(N);
+  SCREAM_FOR_EACH_EXTRA_PACK_SIZE(SCREAM_ADD_PACK_SIZE, )
+#undef SCREAM_ADD_PACK_SIZE
+  std::sort(sizes.begin(), sizes.end());
+  sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+  return sizes;
+}
+
+void set_pack_size (const int n) {
+  const auto sizes = available_pack_sizes();
+  EKAT_REQUIRE_MSG(std::find(sizes.begin(), sizes.end(), n) != sizes.end(),
+                   "Error! Pack size " << n << " is not built; add it to SCREAM_EXTRA_PACK_SIZES.\n");
+  g_pack_size = n;
+}
+
+int get_pack_size () {
+  return g_pack_size;
+}
+
+int calibrate_pack_size (const std::function<void(int)>& run, const int repeat) {
+  EKAT_REQUIRE_MSG(repeat > 0, "Error! Number of repetitions must be positive.\n");
+  int best = SCREAM_SMALL_PACK_SIZE;
+  double best_time = std::numeric_limits<double>::max();
+  for (const auto n : available_pack_sizes()) {
+    set_pack_size(n);
+    run(n);
+    double t = std::numeric_limits<double>::max();
+    for (int r = 0; r < repeat; ++r) {
+      const auto start = std::chrono::steady_clock::now();
+      run(n);
+      const auto finish = std::chrono::steady_clock::now();
+      t = std::min(t, std::chrono::duration<double>(finish - start).count());
+    }
+    if (t < best_time) {
+      best_time = t;
+      best = n;
+    }
+  }
+  set_pack_size(best);
+  return best;
+}
+
+} // namespace physics
+} // namespace scream
@@ -0,0 +1,67 @@
+#ifndef SCREAM_PHYSICS_PACK_DISPATCH_HPP
+#define SCREAM_PHYSICS_PACK_DISPATCH_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+/*
+P3 and SHOC are instantiated for the small pack size SCREAM_SMALL_PACK_SIZE
+and for each size in SCREAM_EXTRA_PACK_SIZES. Their f90 bridges (p3_main_f,
+shoc_main_f) run the kernels with the pack size selected here, so that pack
+sizes can be compared with one binary:
+
+  for (const auto n : physics::available_pack_sizes()) {
+    physics::set_pack_size(n);
+    p3_main(*d);
+  }
+
+Alternatively, calibrate_pack_size times a run for each available size and
+selects the fastest one. In a bridge, dispatch_pack_size turns the selected
+size into a template argument:
+
+  physics::dispatch_pack_size(physics::get_pack_size(), [&] (auto n) {
+    p3_main_f_impl<Real, decltype(n)::value>(...);
+  });
+*/
+
+namespace scream {
+namespace physics {
+
+// The small pack sizes P3 and SHOC are built for, in increasing order.
+std::vector<int> available_pack_sizes();
+
+// Select the pack size of subsequent bridge calls; n must be one of
+// available_pack_sizes(). The initial selection is SCREAM_SMALL_PACK_SIZE.
+void set_pack_size(const int n);
+int get_pack_size();
+
+// Call run(n) once as a warmup, then repeat times, for each available pack
+// size n. Select the size with the smallest time and return it.
+int calibrate_pack_size(const std::function<void(int)>& run, const int repeat = 3);
+
+// Call f(std::integral_constant<int,n>()). n must be an available pack size.
+template <typename F>
+void dispatch_pack_size (const int n, F&& f) {
+  if (n == SCREAM_SMALL_PACK_SIZE) {
+    f(std::integral_constant<int,SCREAM_SMALL_PACK_SIZE>());
+    return;
+  }
+#define SCREAM_DISPATCH_PACK_SIZE(unused, N)    \
+  if (n == N) {                                 \
+    f(std::integral_constant<int,N>());         \
+    return;                                     \
+  }
+  SCREAM_FOR_EACH_EXTRA_PACK_SIZE(SCREAM_DISPATCH_PACK_SIZE, )
+#undef SCREAM_DISPATCH_PACK_SIZE
+  EKAT_ERROR_MSG("Error! Pack size " << n << " is not built; add it to SCREAM_EXTRA_PACK_SIZES.\n");
+}
+
+} // namespace physics
+} // namespace scream
+
+#endif // SCREAM_PHYSICS_PACK_DISPATCH_HPP
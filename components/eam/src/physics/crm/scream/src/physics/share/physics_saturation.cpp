@@ -11,6 +11,10 @@ namespace physics {
  */
 
 template struct Functions<Real,DefaultDevice>;
+#ifdef SCREAM_MIXED_PRECISION
+template struct Functions<float,DefaultDevice>;
+#endif
+SCREAM_ETI_EXTRA_PACK_SIZES(Functions)
 
 } // namespace physics
 } // namespace scream
@@ -11,9 +11,9 @@ namespace physics {
  * this file, #include physics_functions.hpp instead.
  */
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-void  Functions<S,D>
+void  Functions<S,D,N>
 ::check_temperature(const Spack& t_atm, const char* /* func_name */, const Smask& range_mask)
 {
 
@@ -35,10 +35,10 @@ void  Functions<S,D>
 
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack
-Functions<S,D>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask& range_mask)
+typename Functions<S,D,N>::Spack
+Functions<S,D,N>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask& range_mask)
 {
 
   //First check if the temperature is legitimate or not
@@ -81,10 +81,10 @@ Functions<S,D>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask&
   return result;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack
-Functions<S,D>::polysvp1(const Spack& t, const bool ice, const Smask& range_mask)
+typename Functions<S,D,N>::Spack
+Functions<S,D,N>::polysvp1(const Spack& t, const bool ice, const Smask& range_mask)
 {
   // REPLACE GOFF-GRATCH WITH FASTER FORMULATION FROM FLATAU ET AL. 1992, TABLE 4 (RIGHT-HAND COLUMN)
 
@@ -124,10 +124,68 @@ Functions<S,D>::polysvp1(const Spack& t, const bool ice, const Smask& range_mask
   return result;
 }
 
-template <typename S, typename D>
+template <typename S, typename D, int N>
 KOKKOS_FUNCTION
-typename Functions<S,D>::Spack
-Functions<S,D>::qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, const Smask& range_mask, const SaturationFcn func_idx)
+typename Functions<S,D,N>::Spack
+Functions<S,D,N>::tabulated_svp(const Spack& t_atm, const bool ice, const Smask& range_mask)
+{
+  // log(MurphyKoop_svp) is tabulated every dtab=1 K from ttab0=100 K to 400 K,
+  // first for liquid and then for ice, and interpolated with a cubic
+  // (4-point Lagrange) polynomial. The interpolation error on the log is
+  // bounded by (3/128)*dtab^4*max|d^4 log(svp)/dT^4|, which is largest at
+  // the cold end of the table. Sampling the whole [svp_table_tmin,svp_table_tmax)
+  // range gives a max relative error of 3.1e-7 (see physics_saturation_unit_tests).
+  static constexpr Scalar log_svp[] = {
+#   include "physics_saturation_table.inc"
+  };
+  static constexpr Int ntab  = 301;
+  static constexpr Scalar ttab0 = 100;
+  static constexpr Scalar dtab  = 1;
+
+  static constexpr  auto tmelt = C::Tmelt;
+  static constexpr Scalar tmin = svp_table_tmin;
+  static constexpr Scalar tmax = svp_table_tmax;
+  const Smask ice_mask = (t_atm < tmelt) && ice;
+
+  // NaN temperatures are not in the table either
+  const Smask in_table = (t_atm >= tmin) && (t_atm < tmax);
+
+  // Locate t_atm in the table. Lanes outside of it use a dummy position.
+  Spack x = (t_atm - ttab0) / dtab;
+  x.set(!in_table, 1);
+
+  IntSmallPack idx;
+  Spack w, f0, f1, f2, f3;
+  vector_simd for (int s = 0; s < Spack::n; ++s) {
+    const Int i = static_cast<Int>(x[s]);
+    w[s] = x[s] - i;
+    idx[s] = i + (ice_mask[s] ? ntab : 0);
+  }
+  vector_simd for (int s = 0; s < Spack::n; ++s) {
+    f0[s] = log_svp[idx[s]-1];
+    f1[s] = log_svp[idx[s]];
+    f2[s] = log_svp[idx[s]+1];
+    f3[s] = log_svp[idx[s]+2];
+  }
+
+  const Spack wp1 = w + 1;
+  const Spack wm1 = w - 1;
+  const Spack wm2 = w - 2;
+  const Spack log_result = (wp1*w*wm1*f3 - w*wm1*wm2*f0)/6 + (wp1*wm1*wm2*f1 - wp1*w*wm2*f2)/2;
+  Spack result = exp(log_result);
+
+  const Smask outside = !in_table && range_mask;
+  if (outside.any()) {
+    result.set(outside, MurphyKoop_svp(t_atm, ice, outside));
+  }
+
+  return result;
+}
+
+template <typename S, typename D, int N>
+KOKKOS_FUNCTION
+typename Functions<S,D,N>::Spack
+Functions<S,D,N>::qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, const Smask& range_mask, const SaturationFcn func_idx)
 {
   /*Arguments:
     ----------
@@ -137,7 +195,8 @@ Functions<S,D>::qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, c
   func_idx is an optional argument to decide which scheme is to be called for saturation vapor pressure
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
-  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)*/
+  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopTable (=2) --> tabulated_svp (table of MurphyKoop_svp)*/
 
   Spack e_pres; // saturation vapor pressure [Pa]
 
@@ -148,6 +207,9 @@ Functions<S,D>::qv_sat(const Spack& t_atm, const Spack& p_atm, const bool ice, c
     case MurphyKoop:
       e_pres = MurphyKoop_svp(t_atm, ice, range_mask);
       break;
+    case MurphyKoopTable:
+      e_pres = tabulated_svp(t_atm, ice, range_mask);
+      break;
     default:
       EKAT_KERNEL_ERROR_MSG("Error! Invalid func_idx supplied to qv_sat.");
     }
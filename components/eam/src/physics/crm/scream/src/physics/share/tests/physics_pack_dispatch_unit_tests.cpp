@@ -0,0 +1,43 @@
+#include "catch2/catch.hpp"
+
+#include "physics/share/physics_bench.hpp"
+#include "physics/share/physics_pack_dispatch.hpp"
+#include "share/scream_types.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+TEST_CASE("physics_pack_dispatch", "[physics_pack_dispatch]")
+{
+  using namespace scream;
+
+  const auto sizes = physics::available_pack_sizes();
+  REQUIRE(std::is_sorted(sizes.begin(), sizes.end()));
+  REQUIRE(std::find(sizes.begin(), sizes.end(), SCREAM_SMALL_PACK_SIZE) != sizes.end());
+  REQUIRE(physics::get_pack_size() == SCREAM_SMALL_PACK_SIZE);
+
+  // Each built size can be selected, dispatched to and parsed.
+  for (const auto n : sizes) {
+    physics::set_pack_size(n);
+    REQUIRE(physics::get_pack_size() == n);
+    int dispatched = 0;
+    physics::dispatch_pack_size(n, [&] (auto N) { dispatched = decltype(N)::value; });
+    REQUIRE(dispatched == n);
+    REQUIRE(bench::parse_pack_list(std::to_string(n)) == std::vector<Int>{n});
+  }
+  REQUIRE(bench::parse_pack_list("all") == std::vector<Int>(sizes.begin(), sizes.end()));
+  physics::set_pack_size(SCREAM_SMALL_PACK_SIZE);
+
+  // A size that is not built is rejected, and the selection is unchanged.
+  const auto unbuilt = std::to_string(sizes.back() + 1);
+  REQUIRE_THROWS(physics::set_pack_size(sizes.back() + 1));
+  REQUIRE(physics::get_pack_size() == SCREAM_SMALL_PACK_SIZE);
+  REQUIRE_THROWS(physics::dispatch_pack_size(sizes.back() + 1, [] (auto) {}));
+  REQUIRE_THROWS(bench::parse_pack_list(unbuilt));
+  REQUIRE_THROWS(bench::parse_pack_list(std::to_string(SCREAM_SMALL_PACK_SIZE) + "," + unbuilt));
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+#include "physics/share/physics_functions.hpp"
+#include "physics/share/physics_saturation_impl.hpp"
+
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+
+namespace {
+using namespace scream;
+
+  /* physics_saturation_bench times qv_sat for each SaturationFcn, for both
+   * liquid and ice, over n temperatures spread over [200,320) K. For each
+   * function, the best time over r repetitions is reported per value,
+   * together with the max relative difference of the saturation vapor
+   * pressure against MurphyKoop_svp, so that the cost/accuracy trade-off
+   * of the table can be compared against the analytic formulas.
+   */
+
+using physics = physics::Functions<Real, DefaultDevice>;
+using Spack   = physics::Spack;
+using Smask   = physics::Smask;
+using view_1d = physics::view_1d<Spack>;
+
+struct SaturationBench {
+  SaturationBench (const Int n, const Int repeat)
+    : m_npack(ekat::npack<Spack>(n))
+    , m_repeat(repeat)
+    , m_temp("temp", m_npack)
+    , m_pres("pres", m_npack)
+    , m_qv("qv", m_npack)
+  {
+    const auto temp = m_temp;
+    const auto pres = m_pres;
+    Kokkos::parallel_for("SaturationBench::init", m_npack, KOKKOS_LAMBDA(const Int& i) {
+      for (Int s = 0; s < Spack::n; ++s) {
+        temp(i)[s] = 200 + 120*Real((i*Spack::n + s) % 1000)/1000;
+        pres(i)[s] = 5e4;
+      }
+    });
+  }
+
+  // Best time per value [ns] of qv_sat with func_idx.
+  double time_qv_sat (const bool ice, const physics::SaturationFcn func_idx) const {
+    const auto temp = m_temp;
+    const auto pres = m_pres;
+    const auto qv   = m_qv;
+    double best = std::numeric_limits<double>::max();
+    for (Int r = 0; r < m_repeat; ++r) {
+      Kokkos::fence();
+      Kokkos::Timer timer;
+      Kokkos::parallel_for("SaturationBench::qv_sat", m_npack, KOKKOS_LAMBDA(const Int& i) {
+        qv(i) = physics::qv_sat(temp(i), pres(i), ice, Smask(true), func_idx);
+      });
+      Kokkos::fence();
+      best = std::min(best, timer.seconds());
+    }
+    return best*1e9/(m_npack*Spack::n);
+  }
+
+  // Max relative difference of the svp behind func_idx wrt MurphyKoop_svp.
+  Real max_rel_diff (const bool ice, const physics::SaturationFcn func_idx) const {
+    const auto temp = m_temp;
+    Real diff = 0;
+    Kokkos::parallel_reduce("SaturationBench::max_rel_diff", m_npack, KOKKOS_LAMBDA(const Int& i, Real& d) {
+      const Spack ref = physics::MurphyKoop_svp(temp(i), ice, Smask(true));
+      Spack svp;
+      switch (func_idx) {
+        case physics::Polysvp1:        svp = physics::polysvp1(temp(i), ice, Smask(true));      break;
+        case physics::MurphyKoopTable: svp = physics::tabulated_svp(temp(i), ice, Smask(true)); break;
+        default:                       svp = ref;
+      }
+      for (Int s = 0; s < Spack::n; ++s) {
+        const Real rel = std::abs(svp[s] - ref[s])/ref[s];
+        if (rel > d) d = rel;
+      }
+    }, Kokkos::Max<Real>(diff));
+    return diff;
+  }
+
+  Int run () const {
+    static constexpr physics::SaturationFcn funcs[] = {physics::Polysvp1, physics::MurphyKoop, physics::MurphyKoopTable};
+    static constexpr const char* names[] = {"Polysvp1", "MurphyKoop", "MurphyKoopTable"};
+
+    printf("%-8s %-16s %12s %14s\n", "phase", "function", "ns/value", "max rel diff");
+    for (const bool ice : {false, true}) {
+      for (int f = 0; f < 3; ++f) {
+        printf("%-8s %-16s %12.3f %14.3e\n", ice ? "ice" : "liquid", names[f],
+               time_qv_sat(ice, funcs[f]), max_rel_diff(ice, funcs[f]));
+      }
+    }
+    return 0;
+  }
+
+  const Int m_npack, m_repeat;
+  view_1d m_temp, m_pres, m_qv;
+};
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  int nerr = 0;
+
+  Int n = 1 << 20;
+  Int repeat = 10;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-h", "--help")) {
+      std::cout <<
+        argv[0] << " [options]\n"
+        "Options:\n"
+        "  -n <values>       Number of temperatures. Default=1048576.\n"
+        "  -r <repeat>       Number of repetitions; the best time is reported. Default=10.\n";
+      return 0;
+    }
+    if (ekat::argv_matches(argv[i], "-n", "--num-values")) {
+      expect_another_arg(i, argc);
+      ++i;
+      n = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      repeat = std::atoi(argv[i]);
+    }
+  }
+
+  scream::initialize_scream_session(argc, argv); {
+    SaturationBench bench(n, repeat);
+    nerr += bench.run();
+  } scream::finalize_scream_session();
+
+  return nerr != 0 ? 1 : 0;
+}
@@ -403,6 +403,72 @@ struct UnitWrap::UnitTest<D>::TestSaturation
     Kokkos::fence();
     REQUIRE(nerr == 0);
   }
+
+  static void run_table()
+  {
+    // Check tabulated_svp (and qv_sat with MurphyKoopTable) against MurphyKoop_svp
+    // over the whole table range, and outside of it, where it must fall back to
+    // MurphyKoop_svp. In single precision, the difference is dominated by the
+    // roundoff of both functions, rather than by the interpolation error.
+
+    using physics = scream::physics::Functions<Scalar, Device>;
+
+    static constexpr bool is_single_prec = ekat::is_single_precision<Scalar>::value;
+    static constexpr Scalar tol = is_single_prec ? 5e-5 : physics::svp_table_max_rel_err;
+    static constexpr Scalar tmin = physics::svp_table_tmin;
+    static constexpr Scalar tmax = physics::svp_table_tmax;
+    static constexpr Scalar ep_2 = C::ep_2;
+
+    // Sample the table range much more finely than its 1 K spacing
+    static constexpr Int nsamples = 100000;
+    const Int npacks = ekat::npack<Spack>(nsamples);
+
+    int nerr = 0;
+    Kokkos::parallel_reduce("TestSaturation::run_table", RangePolicy(0, npacks),
+                            KOKKOS_LAMBDA(const Int& i, int& errors) {
+      Spack temps;
+      for (Int s = 0; s < Spack::n; ++s) {
+        temps[s] = tmin + (tmax - tmin)*((i*Spack::n + s) % nsamples)/nsamples;
+      }
+      const Spack pres(1e5);
+
+      for (int ice = 0; ice < 2; ++ice) {
+        const Spack svp_mk  = physics::MurphyKoop_svp(temps, ice, Smask(true));
+        const Spack svp_tab = physics::tabulated_svp(temps, ice, Smask(true));
+        const Spack qv_tab  = physics::qv_sat(temps, pres, ice, Smask(true), physics::MurphyKoopTable);
+        const Spack qv_exp  = ep_2 * svp_tab / max(pres - svp_tab, sp(1.e-3));
+        for (Int s = 0; s < Spack::n; ++s) {
+          if (std::abs(svp_tab[s] - svp_mk[s]) > tol*svp_mk[s]) {
+            printf("tabulated_svp for T = %f ice = %d: rel diff is %e but max allowed is %e\n",
+                   temps[s], ice, std::abs(svp_tab[s] - svp_mk[s])/svp_mk[s], tol);
+            ++errors;
+          }
+          if (qv_tab[s] != qv_exp[s]) {
+            printf("qv_sat with MurphyKoopTable for T = %f ice = %d does not use tabulated_svp\n",
+                   temps[s], ice);
+            ++errors;
+          }
+        }
+      }
+
+      // Outside of the table, MurphyKoop_svp is used
+      if (i == 0) {
+        const Scalar tout[] = {90, 100, tmax, 400, 410};
+        for (int j = 0; j < 5; ++j) {
+          const Scalar t = tout[j];
+          for (int ice = 0; ice < 2; ++ice) {
+            if (physics::tabulated_svp(Spack(t), ice, Smask(true))[0] !=
+                physics::MurphyKoop_svp(Spack(t), ice, Smask(true))[0]) {
+              ++errors;
+            }
+          }
+        }
+      }
+    }, nerr);
+
+    Kokkos::fence();
+    REQUIRE(nerr == 0);
+  }
 }; //end of TestSaturation struct
 
 } // namespace unit_test
@@ -416,4 +482,9 @@ TEST_CASE("physics_saturation_test", "[physics_saturation_test]"){
 
  } // TEST_CASE
 
+TEST_CASE("physics_saturation_table_test", "[physics_saturation_test]"){
+  scream::physics::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestSaturation::run_table();
+
+ } // TEST_CASE
+
 } // namespace
@@ -11,13 +11,13 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::adv_sgs_tke(
   const MemberType&            team,
   const Int&                   nlev,
-  const Real&                  dtime,
+  const Scalar&                dtime,
   const uview_1d<const Spack>& shoc_mix,
   const uview_1d<const Spack>& wthv_sec,
   const uview_1d<const Spack>& sterm_zt,
@@ -29,8 +29,8 @@ void Functions<S,D>
   //Shared constants
   static constexpr Scalar ggr      = C::gravit;
   static constexpr Scalar basetemp = C::basetemp;
-  static constexpr Scalar mintke   = scream::shoc::Constants<Real>::mintke;
-  static constexpr Scalar maxtke   = scream::shoc::Constants<Real>::maxtke;
+  static constexpr Scalar mintke   = scream::shoc::Constants<Scalar>::mintke;
+  static constexpr Scalar maxtke   = scream::shoc::Constants<Scalar>::maxtke;
 
   //declare some constants
   static constexpr Scalar Cs  = 0.15;
@@ -22,9 +22,9 @@ namespace shoc {
  *  Larson et al. (2002) for Analytic Double Gaussian 1.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::shoc_assumed_pdf(
+void Functions<S,D,N>::shoc_assumed_pdf(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -39,8 +39,7 @@ void Functions<S,D>::shoc_assumed_pdf(
   const uview_1d<const Spack>& qwthl_sec,
   const uview_1d<const Spack>& w3,
   const uview_1d<const Spack>& pres,
-  const uview_1d<const Spack>& zt_grid,
-  const uview_1d<const Spack>& zi_grid,
+  const LinearInterpWeights&   zi_to_zt,
   const Workspace&             workspace,
   const uview_1d<Spack>&       shoc_cldfrac,
   const uview_1d<Spack>&       shoc_ql,
@@ -74,12 +73,12 @@ void Functions<S,D>::shoc_assumed_pdf(
   const Scalar epsterm = rair/rv;
 
   // Interpolate many variables from interface grid to thermo grid
-  linear_interp(team,zi_grid,zt_grid,w3,w3_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,thl_sec,thl_sec_zt,nlevi,nlev,0);
-  linear_interp(team,zi_grid,zt_grid,wthl_sec,wthl_sec_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,qwthl_sec,qwthl_sec_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,wqw_sec,wqw_sec_zt,nlevi,nlev,largeneg);
-  linear_interp(team,zi_grid,zt_grid,qw_sec,qw_sec_zt,nlevi,nlev,0);
+  linear_interp(team,zi_to_zt,w3,w3_zt,nlevi,nlev,largeneg);
+  linear_interp(team,zi_to_zt,thl_sec,thl_sec_zt,nlevi,nlev,0);
+  linear_interp(team,zi_to_zt,wthl_sec,wthl_sec_zt,nlevi,nlev,largeneg);
+  linear_interp(team,zi_to_zt,qwthl_sec,qwthl_sec_zt,nlevi,nlev,largeneg);
+  linear_interp(team,zi_to_zt,wqw_sec,wqw_sec_zt,nlevi,nlev,largeneg);
+  linear_interp(team,zi_to_zt,qw_sec,qw_sec_zt,nlevi,nlev,0);
 
   // The following is morally a const var, but there are issues with
   // gnu and std=c++14. The macro ConstExceptGnu is defined in ekat_kokkos_types.hpp.
@@ -239,8 +238,8 @@ void Functions<S,D>::shoc_assumed_pdf(
       {
         // Compute MurphyKoop_svp
         const int liquid = 0;
-        const Spack esval1_1 = scream::physics::Functions<S,D>::MurphyKoop_svp(Tl1_1,liquid,active_entries);
-        const Spack esval1_2 = scream::physics::Functions<S,D>::MurphyKoop_svp(Tl1_2,liquid,active_entries);
+        const Spack esval1_1 = scream::physics::Functions<S,D,N>::MurphyKoop_svp(Tl1_1,liquid,active_entries);
+        const Spack esval1_2 = scream::physics::Functions<S,D,N>::MurphyKoop_svp(Tl1_2,liquid,active_entries);
         const Spack lstarn(lcond);
 
         qs1 = sp(0.622)*esval1_1/ekat::max(esval1_1, pval - esval1_1);
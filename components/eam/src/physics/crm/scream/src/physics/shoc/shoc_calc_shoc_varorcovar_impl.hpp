@@ -6,9 +6,9 @@
 namespace scream {
 namespace shoc {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::calc_shoc_varorcovar(
   const MemberType&            team,
   const Int&                   nlev,
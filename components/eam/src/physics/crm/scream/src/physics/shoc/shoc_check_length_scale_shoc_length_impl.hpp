@@ -6,16 +6,16 @@
 namespace scream {
 namespace shoc {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::check_length_scale_shoc_length(
+void Functions<S,D,N>::check_length_scale_shoc_length(
   const MemberType&      team,
   const Int&             nlev,
   const Scalar&          dx,
   const Scalar&          dy,
   const uview_1d<Spack>& shoc_mix)
 {
-  const auto minlen = scream::shoc::Constants<Real>::minlen;
+  const auto minlen = scream::shoc::Constants<Scalar>::minlen;
 
   const Int nlev_pack = ekat::npack<Spack>(nlev);
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev_pack), [&] (const Int& k) {
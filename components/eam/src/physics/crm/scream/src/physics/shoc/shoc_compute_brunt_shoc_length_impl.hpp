@@ -6,9 +6,9 @@
 namespace scream {
 namespace shoc {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::compute_brunt_shoc_length(
+void Functions<S,D,N>::compute_brunt_shoc_length(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -15,9 +15,9 @@ namespace shoc {
  * and diagnostic cloud water mixing ratio.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::compute_shoc_vapor(
+void Functions<S,D,N>::compute_shoc_vapor(
   const MemberType&            team,
   const Int&                   nlev,
   const uview_1d<const Spack>& qw,
@@ -11,9 +11,9 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::shoc_diag_obklen(
+void Functions<S,D,N>::shoc_diag_obklen(
   const Scalar& uw_sfc,
   const Scalar& vw_sfc,
   const Scalar& wthl_sfc,
@@ -11,14 +11,14 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::diag_second_moments(
+void Functions<S,D,N>::diag_second_moments(
   const MemberType& team, const Int& nlev, const Int& nlevi,
   const uview_1d<const Spack>& thetal, const uview_1d<const Spack>& qw, const uview_1d<const Spack>& u_wind,
   const uview_1d<const Spack>& v_wind, const uview_1d<const Spack>& tke, const uview_1d<const Spack>& isotropy,
   const uview_1d<const Spack>& tkh, const uview_1d<const Spack>& tk, const uview_1d<const Spack>& dz_zi,
-  const uview_1d<const Spack>& zt_grid, const uview_1d<const Spack>& zi_grid, const uview_1d<const Spack>& shoc_mix,
+  const LinearInterpWeights& zt_to_zi, const uview_1d<const Spack>& shoc_mix,
   const uview_1d<Spack>& isotropy_zi, const uview_1d<Spack>& tkh_zi, const uview_1d<Spack>& tk_zi,
   const uview_1d<Spack>& thl_sec, const uview_1d<Spack>& qw_sec, const uview_1d<Spack>& wthl_sec, const uview_1d<Spack>& wqw_sec,
   const uview_1d<Spack>& qwthl_sec, const uview_1d<Spack>& uw_sec, const uview_1d<Spack>& vw_sec, const uview_1d<Spack>& wtke_sec,
@@ -43,9 +43,9 @@ void Functions<S,D>::diag_second_moments(
   const auto w2tune = 1;
 
   // Interpolate some variables from the midpoint grid to the interface grid
-  linear_interp(team, zt_grid, zi_grid, isotropy, isotropy_zi, nlev, nlevi, 0);
-  linear_interp(team, zt_grid, zi_grid, tkh,      tkh_zi,      nlev, nlevi, 0);
-  linear_interp(team, zt_grid, zi_grid, tk,       tk_zi,       nlev, nlevi, 0);
+  linear_interp(team, zt_to_zi, isotropy, isotropy_zi, nlev, nlevi, 0);
+  linear_interp(team, zt_to_zi, tkh,      tkh_zi,      nlev, nlevi, 0);
+  linear_interp(team, zt_to_zi, tk,       tk_zi,       nlev, nlevi, 0);
   team.team_barrier();
 
   // Vertical velocity variance is assumed to be propotional to the TKE
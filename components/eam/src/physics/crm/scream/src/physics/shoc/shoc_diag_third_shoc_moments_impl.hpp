@@ -11,9 +11,9 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::diag_third_shoc_moments(
+void Functions<S,D,N>::diag_third_shoc_moments(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -26,8 +26,7 @@ void Functions<S,D>::diag_third_shoc_moments(
   const uview_1d<const Spack>& tke,
   const uview_1d<const Spack>& dz_zt,
   const uview_1d<const Spack>& dz_zi,
-  const uview_1d<const Spack>& zt_grid,
-  const uview_1d<const Spack>& zi_grid,
+  const LinearInterpWeights&   zt_to_zi,
   const Workspace&             workspace,
   const uview_1d<Spack>&       w3)
 {
@@ -42,10 +41,10 @@ void Functions<S,D>::diag_third_shoc_moments(
   const auto mintke = SC::mintke;
 
   // Interpolate variables onto the interface levels
-  linear_interp(team,zt_grid,zi_grid,isotropy,isotropy_zi,nlev,nlevi,0);
-  linear_interp(team,zt_grid,zi_grid,brunt,brunt_zi,nlev,nlevi,largeneg);
-  linear_interp(team,zt_grid,zi_grid,w_sec,w_sec_zi,nlev,nlevi,sp(2.0/3.0)*mintke);
-  linear_interp(team,zt_grid,zi_grid,thetal,thetal_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,isotropy,isotropy_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,brunt,brunt_zi,nlev,nlevi,largeneg);
+  linear_interp(team,zt_to_zi,w_sec,w_sec_zi,nlev,nlevi,sp(2.0/3.0)*mintke);
+  linear_interp(team,zt_to_zi,thetal,thetal_zi,nlev,nlevi,0);
   team.team_barrier();
 
   //Diagnose the third moment of the vertical-velocity
@@ -11,9 +11,9 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::eddy_diffusivities(
+void Functions<S,D,N>::eddy_diffusivities(
   const MemberType&            team,
   const Int&                   nlev,
   const Scalar&                obklen,
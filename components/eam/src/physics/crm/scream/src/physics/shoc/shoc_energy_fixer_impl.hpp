@@ -11,16 +11,15 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::shoc_energy_fixer(
+void Functions<S,D,N>::shoc_energy_fixer(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
   const Scalar&                dtime,
   const Int&                   nadv,
-  const uview_1d<const Spack>& zt_grid,
-  const uview_1d<const Spack>& zi_grid,
+  const LinearInterpWeights&   zt_to_zi,
   const Scalar&                se_b,
   const Scalar&                ke_b,
   const Scalar&                wv_b,
@@ -55,7 +54,7 @@ void Functions<S,D>::shoc_energy_fixer(
   // Compute linear interpolation of data into rho_zi
   // This calculation is needed for stand alone tests,
   // but it redundant when calling shoc_main
-  linear_interp(team,zt_grid,zi_grid,rho_zt,rho_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,rho_zt,rho_zi,nlev,nlevi,0);
   team.team_barrier();
 
   // Compute the host timestep
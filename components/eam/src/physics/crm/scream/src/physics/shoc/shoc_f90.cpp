@@ -139,9 +139,10 @@ void shoc_init(Int nlev, bool use_fortran, bool force_reinit) {
   shoc_use_cxx_c(!use_fortran);
 }
 
-Int shoc_main(FortranData& d, bool use_fortran) {
+Int shoc_main(FortranData& d, bool use_fortran, bool use_mixed) {
   EKAT_REQUIRE_MSG(d.dtime > 0, "Invalid dtime");
   EKAT_REQUIRE_MSG(d.nadv > 0,  "Invalid nadv");
+  EKAT_REQUIRE_MSG(!(use_fortran && use_mixed), "Mixed precision is only available for the c++ shoc_main");
   if (use_fortran) {
     Real elapsed_s;
     shoc_main_c((int)d.shcol, (int)d.nlev, (int)d.nlevi, d.dtime, (int)d.nadv,
@@ -159,7 +160,30 @@ Int shoc_main(FortranData& d, bool use_fortran) {
                 d.uw_sec.data(), d.vw_sec.data(), d.w3.data(), d.wqls_sec.data(),
                 d.brunt.data(), d.shoc_ql2.data(), &elapsed_s);
     return static_cast<Int>(elapsed_s * 1000000);
-  } else {
+  }
+#ifdef SCREAM_MIXED_PRECISION
+  else if (use_mixed) {
+    const int npbl = d.nlev;
+    return shoc_main_f_mixed((int)d.shcol, (int)d.nlev, (int)d.nlevi, d.dtime, (int)d.nadv,
+                             npbl, d.host_dx.data(), d.host_dy.data(),
+                             d.thv.data(), d.zt_grid.data(), d.zi_grid.data(), d.pres.data(),
+                             d.presi.data(), d.pdel.data(), d.wthl_sfc.data(),
+                             d.wqw_sfc.data(), d.uw_sfc.data(), d.vw_sfc.data(),
+                             d.wtracer_sfc.data(), (int)d.num_qtracers,
+                             d.w_field.data(), d.inv_exner.data(), d.phis.data(), d.host_dse.data(),
+                             d.tke.data(), d.thetal.data(), d.qw.data(),
+                             d.u_wind.data(), d.v_wind.data(), d.qtracers.data(), d.wthv_sec.data(),
+                             d.tk.data(), d.shoc_ql.data(),
+                             d.shoc_cldfrac.data(), d.pblh.data(), d.shoc_mix.data(), d.isotropy.data(),
+                             d.w_sec.data(), d.thl_sec.data(),
+                             d.qw_sec.data(), d.qwthl_sec.data(), d.wthl_sec.data(), d.wqw_sec.data(),
+                             d.wtke_sec.data(), d.uw_sec.data(),
+                             d.vw_sec.data(), d.w3.data(), d.wqls_sec.data(), d.brunt.data(),
+                             d.shoc_ql2.data());
+  }
+#endif
+  else {
+    EKAT_REQUIRE_MSG(!use_mixed, "Mixed precision requires a build with SCREAM_MIXED_PRECISION=ON");
     const int npbl = d.nlev;
     return shoc_main_f((int)d.shcol, (int)d.nlev, (int)d.nlevi, d.dtime, (int)d.nadv,
                        npbl, d.host_dx.data(), d.host_dy.data(),
@@ -70,8 +70,9 @@ private:
 // Initialize SHOC with the given number of levels.
 void shoc_init(Int nlev, bool use_fortran=false, bool force_reinit=false);
 
-// Run SHOC subroutines, populating inout and out fields of d.
-ekat::Int shoc_main(FortranData& d, bool use_fortran);
+// Run SHOC subroutines, populating inout and out fields of d. If use_mixed,
+// the c++ shoc_main runs in single precision (requires SCREAM_MIXED_PRECISION).
+ekat::Int shoc_main(FortranData& d, bool use_fortran, bool use_mixed=false);
 
 // We will likely want to remove these checks in the future, as we're not tied
 // to the exact implementation or arithmetic in SHOC. For now, these checks are
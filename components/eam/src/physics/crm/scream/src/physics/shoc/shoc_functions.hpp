@@ -21,7 +21,7 @@ namespace shoc {
  *  - Kokkos team policies have a vector length of 1
  */
 
-template <typename ScalarT, typename DeviceT>
+template <typename ScalarT, typename DeviceT, int PackN = small_pack_size<ScalarT>()>
 struct Functions
 {
   //
@@ -33,8 +33,10 @@ struct Functions
 
   template <typename S>
   using BigPack = ekat::Pack<S,SCREAM_PACK_SIZE>;
+  // PackN defaults to small_pack_size<Scalar>(); other widths are built with
+  // SCREAM_EXTRA_PACK_SIZES (see physics_pack_dispatch.hpp).
   template <typename S>
-  using SmallPack = ekat::Pack<S,SCREAM_SMALL_PACK_SIZE>;
+  using SmallPack = ekat::Pack<S,PackN>;
   
   using IntSmallPack = SmallPack<Int>;
   using Pack = BigPack<Scalar>;
@@ -181,6 +183,17 @@ struct Functions
     view_2d<Spack>  isotropy;
   };
 
+  // This struct stores precomputed weights for linear_interp between
+  // two fixed vertical grids of a column. For each target level k,
+  //   num(k) = x2(k) - x1(kl),  den(k) = x1(ku) - x1(kl),
+  // where kl < ku are the source levels bracketing (or, at the
+  // boundaries, nearest to) x2(k). Numerator and denominator are kept
+  // separate so that interpolating with them is BFB with linear_interp.
+  struct LinearInterpWeights {
+    uview_1d<Spack> num;
+    uview_1d<Spack> den;
+  };
+
   //
   // --------- Functions ---------
   //
@@ -283,6 +296,35 @@ struct Functions
     const Int& km2,
     const Scalar& minthresh);
 
+  // Same as above, but using weights from linear_interp_weights,
+  // which only depend on the grids.
+  KOKKOS_FUNCTION
+  static void linear_interp(
+    const MemberType& team,
+    const LinearInterpWeights& weights,
+    const uview_1d<const Spack>& y1,
+    const uview_1d<Spack>& y2,
+    const Int& km1,
+    const Int& km2,
+    const Scalar& minthresh);
+
+  KOKKOS_FUNCTION
+  static void linear_interp_weights(
+    const MemberType& team,
+    const uview_1d<const Spack>& x1,
+    const uview_1d<const Spack>& x2,
+    const Int& km1,
+    const Int& km2,
+    const LinearInterpWeights& weights);
+
+  // Upper source level of the pair used to interpolate to levels
+  // k2*Spack::n..(k2+1)*Spack::n-1 of the target grid.
+  KOKKOS_INLINE_FUNCTION
+  static IntSmallPack linear_interp_index(
+    const Int& k2,
+    const Int& km1,
+    const Int& km2);
+
   KOKKOS_FUNCTION
   static void shoc_energy_integrals(
     const MemberType&            team,
@@ -310,7 +352,7 @@ struct Functions
      const uview_1d<const Spack>& thetal, const uview_1d<const Spack>& qw, const uview_1d<const Spack>& u_wind,
      const uview_1d<const Spack>& v_wind, const uview_1d<const Spack>& tke, const uview_1d<const Spack>& isotropy,
      const uview_1d<const Spack>& tkh, const uview_1d<const Spack>& tk, const uview_1d<const Spack>& dz_zi,
-     const uview_1d<const Spack>& zt_grid, const uview_1d<const Spack>& zi_grid, const uview_1d<const Spack>& shoc_mix,
+     const LinearInterpWeights& zt_to_zi, const uview_1d<const Spack>& shoc_mix,
      const uview_1d<Spack>& isotropy_zi, const uview_1d<Spack>& tkh_zi, const uview_1d<Spack>& tk_zi,
      const uview_1d<Spack>& thl_sec, const uview_1d<Spack>& qw_sec, const uview_1d<Spack>& wthl_sec,
      const uview_1d<Spack>& wqw_sec, const uview_1d<Spack>& qwthl_sec, const uview_1d<Spack>& uw_sec,
@@ -321,7 +363,7 @@ struct Functions
      const uview_1d<const Spack>& thetal, const uview_1d<const Spack>& qw, const uview_1d<const Spack>& u_wind,
      const uview_1d<const Spack>& v_wind, const uview_1d<const Spack>& tke, const uview_1d<const Spack>& isotropy,
      const uview_1d<const Spack>& tkh, const uview_1d<const Spack>& tk, const uview_1d<const Spack>& dz_zi,
-     const uview_1d<const Spack>& zt_grid, const uview_1d<const Spack>& zi_grid, const uview_1d<const Spack>& shoc_mix,
+     const LinearInterpWeights& zt_to_zi, const uview_1d<const Spack>& shoc_mix,
      const Scalar& wthl_sfc, const Scalar& wqw_sfc, const Scalar& uw_sfc, const Scalar& vw_sfc, Scalar& ustar2, Scalar& wstar,
      const Workspace workspace, const uview_1d<Spack>& thl_sec,
      const uview_1d<Spack>& qw_sec, const uview_1d<Spack>& wthl_sec, const uview_1d<Spack>& wqw_sec, const uview_1d<Spack>& qwthl_sec,
@@ -380,7 +422,7 @@ struct Functions
     const Scalar&                dx,
     const Scalar&                dy,
     const uview_1d<const Spack>& zt_grid,
-    const uview_1d<const Spack>& zi_grid,
+    const LinearInterpWeights&   zt_to_zi,
     const uview_1d<const Spack>& dz_zt,
     const uview_1d<const Spack>& tke,    
     const uview_1d<const Spack>& thv,
@@ -395,8 +437,7 @@ struct Functions
     const Int&                   nlevi,
     const Scalar&                dtime,
     const Int&                   nadv,
-    const uview_1d<const Spack>& zt_grid,
-    const uview_1d<const Spack>& zi_grid,
+    const LinearInterpWeights&   zt_to_zi,
     const Scalar&                se_b,
     const Scalar&                ke_b,
     const Scalar&                wv_b,
@@ -431,8 +472,7 @@ struct Functions
     const uview_1d<const Spack>& dz_zt,
     const uview_1d<const Spack>& dz_zi,
     const uview_1d<const Spack>& rho_zt,
-    const uview_1d<const Spack>& zt_grid,
-    const uview_1d<const Spack>& zi_grid,
+    const LinearInterpWeights&   zt_to_zi,
     const uview_1d<const Spack>& tk,
     const uview_1d<const Spack>& tkh,
     const Scalar&                uw_sfc,
@@ -462,8 +502,7 @@ struct Functions
     const uview_1d<const Spack>& tke,
     const uview_1d<const Spack>& dz_zt,
     const uview_1d<const Spack>& dz_zi,
-    const uview_1d<const Spack>& zt_grid,
-    const uview_1d<const Spack>& zi_grid,
+    const LinearInterpWeights&   zt_to_zi,
     const Workspace&             workspace,
     const uview_1d<Spack>&       w3);
 
@@ -471,7 +510,7 @@ struct Functions
   static void adv_sgs_tke(
     const MemberType&            team,
     const Int&                   nlev,
-    const Real&                  dtime,
+    const Scalar&                dtime,
     const uview_1d<const Spack>& shoc_mix,
     const uview_1d<const Spack>& wthv_sec,
     const uview_1d<const Spack>& sterm_zt,
@@ -495,8 +534,7 @@ struct Functions
     const uview_1d<const Spack>& qwthl_sec,
     const uview_1d<const Spack>& w3,
     const uview_1d<const Spack>& pres,
-    const uview_1d<const Spack>& zt_grid,
-    const uview_1d<const Spack>& zi_grid,
+    const LinearInterpWeights&   zi_to_zt,
     const Workspace&             workspace,
     const uview_1d<Spack>&       shoc_cldfrac,
     const uview_1d<Spack>&       shoc_ql,
@@ -739,7 +777,7 @@ struct Functions
     const uview_1d<const Spack>& brunt,
     const Scalar&                obklen,
     const uview_1d<const Spack>& zt_grid,
-    const uview_1d<const Spack>& zi_grid,
+    const LinearInterpWeights&   zi_to_zt,
     const Scalar&                pblh,
     const Workspace&             workspace,
     const uview_1d<Spack>&       tke,
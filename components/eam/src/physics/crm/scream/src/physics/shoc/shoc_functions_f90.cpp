@@ -8,6 +8,8 @@
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
 #include "share/util/scream_deep_copy.hpp"
+#include "physics/share/physics_mixed_precision.hpp"
+#include "physics/share/physics_pack_dispatch.hpp"
 
 #include <random>
 
@@ -1505,7 +1507,9 @@ void diag_second_moments_f(Int shcol, Int nlev, Int nlevi, Real* thetal, Real* q
   view_2d w_sec_2d("w_sec", shcol, nlev_packs),
           isotropy_zi_2d("isotropy_zi", shcol, nlevi_packs),
           tkh_zi_2d("tkh_zi", shcol, nlevi_packs),
-          tk_zi_2d("tk_zi", shcol, nlevi_packs);
+          tk_zi_2d("tk_zi", shcol, nlevi_packs),
+          zt_to_zi_num_2d("zt_to_zi_num", shcol, nlevi_packs),
+          zt_to_zi_den_2d("zt_to_zi_den", shcol, nlevi_packs);
 
   const Int nk_pack = ekat::npack<Spack>(nlev);
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nk_pack);
@@ -1537,8 +1541,14 @@ void diag_second_moments_f(Int shcol, Int nlev, Int nlevi, Real* thetal, Real* q
     const auto tkh_zi_1d      = ekat::subview(tkh_zi_2d, i);
     const auto tk_zi_1d       = ekat::subview(tk_zi_2d, i);
 
+    // Weights for interpolating from the thermo to the interface grid
+    const SHOC::LinearInterpWeights zt_to_zi{ekat::subview(zt_to_zi_num_2d, i),
+                                             ekat::subview(zt_to_zi_den_2d, i)};
+    SHOC::linear_interp_weights(team, zt_grid_1d, zi_grid_1d, nlev, nlevi, zt_to_zi);
+    team.team_barrier();
+
     SHOC::diag_second_moments(team, nlev, nlevi, thetal_1d, qw_1d, u_wind_1d, v_wind_1d, tke_1d, isotropy_1d, tkh_1d, tk_1d,
-                     dz_zi_1d, zt_grid_1d, zi_grid_1d, shoc_mix_1d, isotropy_zi_1d, tkh_zi_1d, tk_zi_1d,
+                     dz_zi_1d, zt_to_zi, shoc_mix_1d, isotropy_zi_1d, tkh_zi_1d, tk_zi_1d,
                      thl_sec_1d, qw_sec_1d, wthl_sec_1d, wqw_sec_1d,
                      qwthl_sec_1d, uw_sec_1d, vw_sec_1d, wtke_sec_1d, w_sec_1d);
 
@@ -1614,7 +1624,7 @@ void diag_second_shoc_moments_f(Int shcol, Int nlev, Int nlevi, Real* thetal, Re
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
 
   // Local variable workspace
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 3, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 5, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -1650,11 +1660,20 @@ void diag_second_shoc_moments_f(Int shcol, Int nlev, Int nlevi, Real* thetal, Re
     Scalar ustar2_s = ustar2_1d(i);
     Scalar wstar_s  = wstar_1d(i);
 
+    // Weights for interpolating from the thermo to the interface grid
+    SHOC::uview_1d<Spack> zt_to_zi_num, zt_to_zi_den;
+    workspace.template take_many_and_reset<2>({"zt_to_zi_num", "zt_to_zi_den"}, {&zt_to_zi_num, &zt_to_zi_den});
+    const SHOC::LinearInterpWeights zt_to_zi{zt_to_zi_num, zt_to_zi_den};
+    SHOC::linear_interp_weights(team, zt_grid_1d, zi_grid_1d, nlev, nlevi, zt_to_zi);
+    team.team_barrier();
+
     SHOC::diag_second_shoc_moments(team, nlev, nlevi,
-       thetal_1d, qw_1d, u_wind_1d, v_wind_1d, tke_1d, isotropy_1d, tkh_1d, tk_1d, dz_zi_1d, zt_grid_1d, zi_grid_1d, shoc_mix_1d,
+       thetal_1d, qw_1d, u_wind_1d, v_wind_1d, tke_1d, isotropy_1d, tkh_1d, tk_1d, dz_zi_1d, zt_to_zi, shoc_mix_1d,
        wthl_s, wqw_s, uw_s, vw_s, ustar2_s, wstar_s,
        workspace, thl_sec_1d, qw_sec_1d, wthl_sec_1d, wqw_sec_1d, qwthl_sec_1d,
        uw_sec_1d, vw_sec_1d, wtke_sec_1d, w_sec_1d);
+
+    workspace.template release_many_contiguous<2>({&zt_to_zi_num, &zt_to_zi_den});
   });
 
   std::vector<Int> dim1(9, shcol);
@@ -1934,7 +1953,7 @@ void shoc_length_f(Int shcol, Int nlev, Int nlevi, Real* host_dx, Real* host_dy,
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
 
   // Local variable workspace
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 1, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 3, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -1953,9 +1972,18 @@ void shoc_length_f(Int shcol, Int nlev, Int nlevi, Real* host_dx, Real* host_dy,
     const auto brunt_s = ekat::subview(brunt_d, i);
     const auto shoc_mix_s = ekat::subview(shoc_mix_d, i);
 
+    // Weights for interpolating from the thermo to the interface grid
+    SHF::uview_1d<Spack> zt_to_zi_num, zt_to_zi_den;
+    workspace.template take_many_and_reset<2>({"zt_to_zi_num", "zt_to_zi_den"}, {&zt_to_zi_num, &zt_to_zi_den});
+    const SHF::LinearInterpWeights zt_to_zi{zt_to_zi_num, zt_to_zi_den};
+    SHF::linear_interp_weights(team, zt_grid_s, zi_grid_s, nlev, nlevi, zt_to_zi);
+    team.team_barrier();
+
     SHF::shoc_length(team,nlev,nlevi,host_dx_s,host_dy_s,
-                     zt_grid_s,zi_grid_s,dz_zt_s,tke_s,
+                     zt_grid_s,zt_to_zi,dz_zt_s,tke_s,
                      thv_s,workspace,brunt_s,shoc_mix_s);
+
+    workspace.template release_many_contiguous<2>({&zt_to_zi_num, &zt_to_zi_den});
   });
 
   // Sync back to host
@@ -2019,7 +2047,7 @@ void shoc_energy_fixer_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, R
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
 
   // Local variable workspace
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 1, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 3, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -2044,9 +2072,18 @@ void shoc_energy_fixer_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, R
     const auto tke_s = ekat::subview(tke_d, i);
     const auto host_dse_s = ekat::subview(host_dse_d, i);
 
-    SHF::shoc_energy_fixer(team,nlev,nlevi,dtime,nadv,zt_grid_s,zi_grid_s,se_b_s,
+    // Weights for interpolating from the thermo to the interface grid
+    SHF::uview_1d<Spack> zt_to_zi_num, zt_to_zi_den;
+    workspace.template take_many_and_reset<2>({"zt_to_zi_num", "zt_to_zi_den"}, {&zt_to_zi_num, &zt_to_zi_den});
+    const SHF::LinearInterpWeights zt_to_zi{zt_to_zi_num, zt_to_zi_den};
+    SHF::linear_interp_weights(team, zt_grid_s, zi_grid_s, nlev, nlevi, zt_to_zi);
+    team.team_barrier();
+
+    SHF::shoc_energy_fixer(team,nlev,nlevi,dtime,nadv,zt_to_zi,se_b_s,
                            ke_b_s,wv_b_s,wl_b_s,se_a_s,ke_a_s,wv_a_s,wl_a_s,
                            wthl_sfc_s,wqw_sfc_s,rho_zt_s,tke_s,pint_s,workspace,host_dse_s);
+
+    workspace.template release_many_contiguous<2>({&zt_to_zi_num, &zt_to_zi_den});
   });
 
   // Sync back to host
@@ -2177,7 +2214,7 @@ void update_prognostics_implicit_f(Int shcol, Int nlev, Int nlevi, Int num_trace
   // Local variable workspace
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(num_tracer+3)*Spack::n;
-  const int tmp_var_size = 8+n_wind_slots+n_trac_slots;
+  const int tmp_var_size = 10+n_wind_slots+n_trac_slots;
   ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, tmp_var_size, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
@@ -2205,12 +2242,21 @@ void update_prognostics_implicit_f(Int shcol, Int nlev, Int nlevi, Int num_trace
     const auto tke_s = ekat::subview(tke_d, i);
     const auto tracer_s = Kokkos::subview(qtracers_cxx_d, i, Kokkos::ALL(), Kokkos::ALL());
 
+    // Weights for interpolating from the thermo to the interface grid
+    SHF::uview_1d<Spack> zt_to_zi_num, zt_to_zi_den;
+    workspace.template take_many_and_reset<2>({"zt_to_zi_num", "zt_to_zi_den"}, {&zt_to_zi_num, &zt_to_zi_den});
+    const SHF::LinearInterpWeights zt_to_zi{zt_to_zi_num, zt_to_zi_den};
+    SHF::linear_interp_weights(team, zt_grid_s, zi_grid_s, nlev, nlevi, zt_to_zi);
+    team.team_barrier();
+
     SHF::update_prognostics_implicit(team, nlev, nlevi, num_tracer, dtime,
-                                     dz_zt_s, dz_zi_s, rho_zt_s, zt_grid_s,
-                                     zi_grid_s, tk_s, tkh_s, uw_sfc_s, vw_sfc_s,
+                                     dz_zt_s, dz_zi_s, rho_zt_s, zt_to_zi,
+                                     tk_s, tkh_s, uw_sfc_s, vw_sfc_s,
                                      wthl_sfc_s, wqw_sfc_s, wtracer_sfc_s,
                                      workspace,
                                      thetal_s, qw_s, tracer_s, tke_s, u_wind_s, v_wind_s);
+
+    workspace.template release_many_contiguous<2>({&zt_to_zi_num, &zt_to_zi_den});
   });
 
   // Transpose tracers
@@ -2276,7 +2322,7 @@ void diag_third_shoc_moments_f(Int shcol, Int nlev, Int nlevi, Real* w_sec, Real
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
 
   // Local variable workspace
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 4, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 6, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -2296,11 +2342,20 @@ void diag_third_shoc_moments_f(Int shcol, Int nlev, Int nlevi, Real* w_sec, Real
     const auto zi_grid_s = ekat::subview(zi_grid_d, i);
     const auto w3_s = ekat::subview(w3_d, i);
 
+    // Weights for interpolating from the thermo to the interface grid
+    SHF::uview_1d<Spack> zt_to_zi_num, zt_to_zi_den;
+    workspace.template take_many_and_reset<2>({"zt_to_zi_num", "zt_to_zi_den"}, {&zt_to_zi_num, &zt_to_zi_den});
+    const SHF::LinearInterpWeights zt_to_zi{zt_to_zi_num, zt_to_zi_den};
+    SHF::linear_interp_weights(team, zt_grid_s, zi_grid_s, nlev, nlevi, zt_to_zi);
+    team.team_barrier();
+
     SHF::diag_third_shoc_moments(team, nlev, nlevi, wsec_s, thl_sec_s,
                                  wthl_sec_s, isotropy_s, brunt_s, thetal_s, tke_s,
-                                 dz_zt_s, dz_zi_s, zt_grid_s, zi_grid_s,
+                                 dz_zt_s, dz_zi_s, zt_to_zi,
                                  workspace,
                                  w3_s);
+
+    workspace.template release_many_contiguous<2>({&zt_to_zi_num, &zt_to_zi_den});
   });
 
   // Sync back to host
@@ -2410,7 +2465,7 @@ void shoc_assumed_pdf_f(Int shcol, Int nlev, Int nlevi, Real* thetal, Real* qw,
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
 
   // Local variable workspace
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlev_packs, 6, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlev_packs, 8, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -2436,10 +2491,19 @@ void shoc_assumed_pdf_f(Int shcol, Int nlev, Int nlevi, Real* thetal, Real* qw,
     const auto wthv_sec_s = ekat::subview(wthv_sec_d, i);
     const auto shoc_ql2_s = ekat::subview(shoc_ql2_d, i);
 
+    // Weights for interpolating from the interface to the thermo grid
+    SHF::uview_1d<Spack> zi_to_zt_num, zi_to_zt_den;
+    workspace.template take_many_and_reset<2>({"zi_to_zt_num", "zi_to_zt_den"}, {&zi_to_zt_num, &zi_to_zt_den});
+    const SHF::LinearInterpWeights zi_to_zt{zi_to_zt_num, zi_to_zt_den};
+    SHF::linear_interp_weights(team, zi_grid_s, zt_grid_s, nlevi, nlev, zi_to_zt);
+    team.team_barrier();
+
     SHF::shoc_assumed_pdf(team, nlev, nlevi, thetal_s, qw_s, w_field_s, thl_sec_s, qw_sec_s, wthl_sec_s, w_sec_s,
-                          wqw_sec_s, qwthl_sec_s, w3_s, pres_s, zt_grid_s, zi_grid_s,
+                          wqw_sec_s, qwthl_sec_s, w3_s, pres_s, zi_to_zt,
                           workspace,
                           shoc_cldfrac_s, shoc_ql_s, wqls_s, wthv_sec_s, shoc_ql2_s);
+
+    workspace.template release_many_contiguous<2>({&zi_to_zt_num, &zi_to_zt_den});
   });
 
   // Sync back to host
@@ -2696,24 +2760,28 @@ int shoc_init_f(Int nlev, Real *pref_mid, Int nbot_shoc, Int ntop_shoc)
   return SHF::shoc_init(nbot_shoc,ntop_shoc,pref_mid_d);
 }
 
-Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl, Real* host_dx, Real* host_dy, Real* thv, Real* zt_grid,
-                Real* zi_grid, Real* pres, Real* presi, Real* pdel, Real* wthl_sfc, Real* wqw_sfc, Real* uw_sfc, Real* vw_sfc,
-                Real* wtracer_sfc, Int num_qtracers, Real* w_field, Real* inv_exner, Real* phis, Real* host_dse, Real* tke,
-                Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk,
-                Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
-                Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
-                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+namespace {
+
+// shoc_main_f for the kernel scalar type Scalar and small pack size N; see
+// shoc_main_f_mixed and physics::dispatch_pack_size.
+template <typename Scalar, int N = small_pack_size<Scalar>()>
+Int shoc_main_f_impl(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl, Scalar* host_dx, Scalar* host_dy, Scalar* thv, Scalar* zt_grid,
+                     Scalar* zi_grid, Scalar* pres, Scalar* presi, Scalar* pdel, Scalar* wthl_sfc, Scalar* wqw_sfc, Scalar* uw_sfc, Scalar* vw_sfc,
+                     Scalar* wtracer_sfc, Int num_qtracers, Scalar* w_field, Scalar* inv_exner, Scalar* phis, Scalar* host_dse, Scalar* tke,
+                     Scalar* thetal, Scalar* qw, Scalar* u_wind, Scalar* v_wind, Scalar* qtracers, Scalar* wthv_sec, Scalar* tkh, Scalar* tk,
+                     Scalar* shoc_ql, Scalar* shoc_cldfrac, Scalar* pblh, Scalar* shoc_mix, Scalar* isotropy, Scalar* w_sec, Scalar* thl_sec,
+                     Scalar* qw_sec, Scalar* qwthl_sec, Scalar* wthl_sec, Scalar* wqw_sec, Scalar* wtke_sec, Scalar* uw_sec, Scalar* vw_sec,
+                     Scalar* w3, Scalar* wqls_sec, Scalar* brunt, Scalar* shoc_ql2)
 {
   // tkh is a local variable in C++ impl
   (void)tkh;
 
-  using SHF  = Functions<Real, DefaultDevice>;
+  using SHF  = Functions<Scalar, DefaultDevice, N>;
 
-  using Scalar     = typename SHF::Scalar;
   using Spack      = typename SHF::Spack;
-  using view_1d    = typename SHF::view_1d<Scalar>;
-  using view_2d    = typename SHF::view_2d<Spack>;
-  using view_3d    = typename SHF::view_3d<Spack>;
+  using view_1d    = typename SHF::template view_1d<Scalar>;
+  using view_2d    = typename SHF::template view_2d<Spack>;
+  using view_3d    = typename SHF::template view_3d<Spack>;
   using ExeSpace   = typename SHF::KT::ExeSpace;
   using MemberType = typename SHF::MemberType;
 
@@ -2741,9 +2809,9 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
                                     nlevi, nlevi, nlevi,        nlevi, nlevi,
                                     nlevi, nlevi, nlev,         nlev,  nlev};
 
-  std::vector<const Real*> ptr_array_1d = {host_dx, host_dy, wthl_sfc, wqw_sfc,
+  std::vector<const Scalar*> ptr_array_1d = {host_dx, host_dy, wthl_sfc, wqw_sfc,
                                            uw_sfc,  vw_sfc,  phis};
-  std::vector<const Real*> ptr_array_2d = {zt_grid,   zi_grid,  pres,        presi,        pdel,
+  std::vector<const Scalar*> ptr_array_2d = {zt_grid,   zi_grid,  pres,        presi,        pdel,
                                            thv,       w_field,  wtracer_sfc, inv_exner,        host_dse,
                                            tke,       thetal,   qw,          u_wind,       v_wind,
                                            wthv_sec,  tk,       shoc_cldfrac, shoc_ql,
@@ -2812,6 +2880,9 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   view_3d horiz_wind_d("horiz_wind",shcol,2,nlev_packs);
   view_3d qtracers_cxx_d("qtracers",shcol,num_qtracers,nlev_packs);
 
+  // tkh is a local variable of the C++ impl, but shoc_main still needs storage for it
+  view_2d tkh_d("tkh",shcol,nlev_packs);
+
   // scalarize each view
   const auto u_wind_d_s = ekat::scalarize(u_wind_d);
   const auto v_wind_d_s = ekat::scalarize(v_wind_d);
@@ -2833,15 +2904,15 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   });
 
   // Pack our data into structs and ship it off to shoc_main.
-  SHF::SHOCInput shoc_input{host_dx_d,  host_dy_d,     zt_grid_d,   zi_grid_d,
+  typename SHF::SHOCInput shoc_input{host_dx_d,  host_dy_d,     zt_grid_d,   zi_grid_d,
                              pres_d,    presi_d,       pdel_d,      thv_d,
                              w_field_d, wthl_sfc_d,    wqw_sfc_d,   uw_sfc_d,
                              vw_sfc_d,  wtracer_sfc_d, inv_exner_d, phis_d};
-  SHF::SHOCInputOutput shoc_input_output{host_dse_d,   tke_d,      thetal_d,       qw_d,
+  typename SHF::SHOCInputOutput shoc_input_output{host_dse_d,   tke_d,      thetal_d,       qw_d,
                                          horiz_wind_d, wthv_sec_d, qtracers_cxx_d,
-                                         tk_d,         shoc_cldfrac_d, shoc_ql_d};
-  SHF::SHOCOutput shoc_output{pblh_d, shoc_ql2_d};
-  SHF::SHOCHistoryOutput shoc_history_output{shoc_mix_d,  w_sec_d,    thl_sec_d, qw_sec_d,
+                                         tk_d,         tkh_d,      shoc_cldfrac_d, shoc_ql_d};
+  typename SHF::SHOCOutput shoc_output{pblh_d, shoc_ql2_d};
+  typename SHF::SHOCHistoryOutput shoc_history_output{shoc_mix_d,  w_sec_d,    thl_sec_d, qw_sec_d,
                                              qwthl_sec_d, wthl_sec_d, wqw_sec_d, wtke_sec_d,
                                              uw_sec_d,    vw_sec_d,   w3_d,      wqls_sec_d,
                                              brunt_d,     isotropy_d};
@@ -2850,7 +2921,7 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   const auto nlevi_packs = ekat::npack<Spack>(nlevi);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(num_qtracers+3)*Spack::n;
-  ekat::WorkspaceManager<Spack, SHF::KT::Device> workspace_mgr(nlevi_packs, 13+(n_wind_slots+n_trac_slots), policy);
+  ekat::WorkspaceManager<Spack, typename SHF::KT::Device> workspace_mgr(nlevi_packs, 17+(n_wind_slots+n_trac_slots), policy);
 
   const auto elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
                                                workspace_mgr,
@@ -2888,7 +2959,7 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
                                   nlevi, nlevi, nlevi, nlevi, nlevi,
                                   nlevi, nlevi, nlevi, nlev,  nlev,
                                   nlev};
-  std::vector<Real*> ptr_array_2d_out = {host_dse, tke,       thetal,   qw,       u_wind,
+  std::vector<Scalar*> ptr_array_2d_out = {host_dse, tke,       thetal,   qw,       u_wind,
                                          v_wind,   wthv_sec,  tk,       shoc_cldfrac,
                                          shoc_ql,  shoc_ql2,  shoc_mix, w_sec,    thl_sec,
                                          qw_sec,   qwthl_sec, wthl_sec, wqw_sec,  wtke_sec,
@@ -2909,6 +2980,66 @@ Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl,
   return elapsed_microsec;
 }
 
+} // namespace anon
+
+Int shoc_main_f(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl, Real* host_dx, Real* host_dy, Real* thv, Real* zt_grid,
+                Real* zi_grid, Real* pres, Real* presi, Real* pdel, Real* wthl_sfc, Real* wqw_sfc, Real* uw_sfc, Real* vw_sfc,
+                Real* wtracer_sfc, Int num_qtracers, Real* w_field, Real* inv_exner, Real* phis, Real* host_dse, Real* tke,
+                Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk,
+                Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
+                Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
+                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+{
+  Int elapsed_microsec = 0;
+  physics::dispatch_pack_size(physics::get_pack_size(), [&] (auto n) {
+    elapsed_microsec = shoc_main_f_impl<Real, decltype(n)::value>(
+      shcol, nlev, nlevi, dtime, nadv, npbl, host_dx, host_dy, thv, zt_grid, zi_grid, pres, presi,
+      pdel, wthl_sfc, wqw_sfc, uw_sfc, vw_sfc, wtracer_sfc, num_qtracers, w_field, inv_exner, phis,
+      host_dse, tke, thetal, qw, u_wind, v_wind, qtracers, wthv_sec, tkh, tk, shoc_ql, shoc_cldfrac,
+      pblh, shoc_mix, isotropy, w_sec, thl_sec, qw_sec, qwthl_sec, wthl_sec, wqw_sec, wtke_sec,
+      uw_sec, vw_sec, w3, wqls_sec, brunt, shoc_ql2);
+  });
+  return elapsed_microsec;
+}
+
+#ifdef SCREAM_MIXED_PRECISION
+Int shoc_main_f_mixed(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npbl, Real* host_dx, Real* host_dy, Real* thv, Real* zt_grid,
+                      Real* zi_grid, Real* pres, Real* presi, Real* pdel, Real* wthl_sfc, Real* wqw_sfc, Real* uw_sfc, Real* vw_sfc,
+                      Real* wtracer_sfc, Int num_qtracers, Real* w_field, Real* inv_exner, Real* phis, Real* host_dse, Real* tke,
+                      Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tk,
+                      Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
+                      Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
+                      Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+{
+  // Sizes of the surface, midpoint and interface arrays
+  const Int nmid = shcol*nlev, nint = shcol*nlevi;
+
+  // The prognostic state is updated in Real; the diagnostics are outputs.
+  using KA = physics::KernelArrays<float>;
+  constexpr auto state = KA::Intent::State, out = KA::Intent::Out;
+  KA f;
+  const auto elapsed_microsec = shoc_main_f_impl<float>(
+    shcol, nlev, nlevi, dtime, nadv, npbl, f.add(host_dx, shcol), f.add(host_dy, shcol),
+    f.add(thv, nmid), f.add(zt_grid, nmid), f.add(zi_grid, nint), f.add(pres, nmid),
+    f.add(presi, nint), f.add(pdel, nmid), f.add(wthl_sfc, shcol), f.add(wqw_sfc, shcol),
+    f.add(uw_sfc, shcol), f.add(vw_sfc, shcol), f.add(wtracer_sfc, shcol*num_qtracers),
+    num_qtracers, f.add(w_field, nmid), f.add(inv_exner, nmid), f.add(phis, shcol),
+    f.add(host_dse, nmid, state), f.add(tke, nmid, state), f.add(thetal, nmid, state),
+    f.add(qw, nmid, state), f.add(u_wind, nmid, state), f.add(v_wind, nmid, state),
+    f.add(qtracers, nmid*num_qtracers, state), f.add(wthv_sec, nmid, out), nullptr,
+    f.add(tk, nmid, out), f.add(shoc_ql, nmid, out), f.add(shoc_cldfrac, nmid, out),
+    f.add(pblh, shcol, out), f.add(shoc_mix, nmid, out), f.add(isotropy, nmid, out),
+    f.add(w_sec, nmid, out), f.add(thl_sec, nint, out), f.add(qw_sec, nint, out),
+    f.add(qwthl_sec, nint, out), f.add(wthl_sec, nint, out), f.add(wqw_sec, nint, out),
+    f.add(wtke_sec, nint, out), f.add(uw_sec, nint, out), f.add(vw_sec, nint, out),
+    f.add(w3, nint, out), f.add(wqls_sec, nmid, out), f.add(brunt, nmid, out),
+    f.add(shoc_ql2, nmid, out));
+  f.copy_back();
+
+  return elapsed_microsec;
+}
+#endif
+
 void pblintd_height_f(Int shcol, Int nlev, Real* z, Real* u, Real* v, Real* ustar, Real* thv, Real* thv_ref, Real* pblh, Real* rino, bool* check)
 {
   using SHOC       = Functions<Real, DefaultDevice>;
@@ -3384,7 +3515,7 @@ void shoc_tke_f(Int shcol, Int nlev, Int nlevi, Real dtime, Real* wthv_sec, Real
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
 
   // Local variable workspace
-  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 3, policy);
+  ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr(nlevi_packs, 5, policy);
 
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
@@ -3409,10 +3540,19 @@ void shoc_tke_f(Int shcol, Int nlev, Int nlevi, Real dtime, Real* wthv_sec, Real
     const auto tkh_s = ekat::subview(tkh_d, i);
     const auto isotropy_s = ekat::subview(isotropy_d, i);
 
+    // Weights for interpolating from the interface to the thermo grid
+    SHF::uview_1d<Spack> zi_to_zt_num, zi_to_zt_den;
+    workspace.template take_many_and_reset<2>({"zi_to_zt_num", "zi_to_zt_den"}, {&zi_to_zt_num, &zi_to_zt_den});
+    const SHF::LinearInterpWeights zi_to_zt{zi_to_zt_num, zi_to_zt_den};
+    SHF::linear_interp_weights(team, zi_grid_s, zt_grid_s, nlevi, nlev, zi_to_zt);
+    team.team_barrier();
+
     SHF::shoc_tke(team,nlev,nlevi,dtime,wthv_sec_s,shoc_mix_s,dz_zi_s,dz_zt_s,pres_s,
-                  u_wind_s,v_wind_s,brunt_s,obklen_s,zt_grid_s,zi_grid_s,pblh_s,
+                  u_wind_s,v_wind_s,brunt_s,obklen_s,zt_grid_s,zi_to_zt,pblh_s,
                   workspace,
                   tke_s,tk_s,tkh_s,isotropy_s);
+
+    workspace.template release_many_contiguous<2>({&zi_to_zt_num, &zi_to_zt_den});
   });
 
   // Sync back to host
@@ -17,9 +17,9 @@ namespace shoc {
  * also define air density in SHOC
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::shoc_grid(
+void Functions<S,D,N>::shoc_grid(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -6,9 +6,9 @@
 namespace scream {
 namespace shoc {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::shoc_length(
   const MemberType&            team,
   const Int&                   nlev,
@@ -16,7 +16,7 @@ void Functions<S,D>
   const Scalar&                dx,
   const Scalar&                dy,
   const uview_1d<const Spack>& zt_grid,
-  const uview_1d<const Spack>& zi_grid,
+  const LinearInterpWeights&   zt_to_zi,
   const uview_1d<const Spack>& dz_zt,
   const uview_1d<const Spack>& tke,
   const uview_1d<const Spack>& thv,
@@ -27,7 +27,7 @@ void Functions<S,D>
   // Define temporary variable
   auto thv_zi = workspace.take("thv_zi");
 
-  linear_interp(team,zt_grid,zi_grid,thv,thv_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,thv,thv_zi,nlev,nlevi,0);
   team.team_barrier();
 
   compute_brunt_shoc_length(team,nlev,nlevi,dz_zt,thv,thv_zi,brunt);
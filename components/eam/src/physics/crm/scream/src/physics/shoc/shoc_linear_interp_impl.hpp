@@ -11,9 +11,32 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
+KOKKOS_INLINE_FUNCTION
+typename Functions<S,D,N>::IntSmallPack
+Functions<S,D,N>::linear_interp_index(
+  const Int& k2,
+  const Int& km1,
+  const Int& km2)
+{
+  IntSmallPack indx_pack;
+  if (km1 == km2+1) {
+    indx_pack = ekat::range<IntSmallPack>(k2*Spack::n + 1);
+
+    // Avoid reading out of bounds for x1/y1
+    indx_pack.set(indx_pack>=km1, km1-1);
+  }
+  else {
+    indx_pack = ekat::range<IntSmallPack>(k2*Spack::n);
+    indx_pack.set(indx_pack < 1, 1); // special shift for 0 boundary case
+    indx_pack.set(indx_pack >= km2-1, km1-1); // special shift for top boundary case
+  }
+  return indx_pack;
+}
+
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::linear_interp(
+void Functions<S,D,N>::linear_interp(
   const MemberType& team,
   const uview_1d<const Spack>& x1,
   const uview_1d<const Spack>& x2,
@@ -23,48 +46,81 @@ void Functions<S,D>::linear_interp(
   const Int& km2,
   const Scalar& minthresh)
 {
+  EKAT_KERNEL_REQUIRE_MSG(km1 == km2+1 || km2 == km1+1, "Unsupported dimensions for linear interp");
+
   const auto sx1 = scalarize(x1);
   const auto sy1 = scalarize(y1);
   const Int km2_pack = ekat::npack<Spack>(km2);
 
-  if (km1 == km2+1) {
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, km2_pack), [&] (const Int& k2) {
-      Spack x1, x1s, y1, y1s; // s->-1 shift
-      auto indx_pack = ekat::range<IntSmallPack>(k2*Spack::n + 1);
+  // TODO: When interpolating to the interface grid, this implementation may need
+  // to be tweaked for better CPU performance. Specifically, CPU perf may improve
+  // if the top and bottom pack are handled in a Kokkos::single block so that all
+  // conditionals can be removed from the ||4. Keep thread0 unoccupied so it can
+  // process the Kokkos::single while other threads are doing the ||4.
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, km2_pack), [&] (const Int& k2) {
+    Spack x1, x1s, y1, y1s; // s->-1 shift
+    const auto indx_pack = linear_interp_index(k2, km1, km2);
+    ekat::index_and_shift<-1>(sx1, indx_pack, x1, x1s);
+    ekat::index_and_shift<-1>(sy1, indx_pack, y1, y1s);
 
-      // Avoid reading out of bounds for x1/y1
-      indx_pack.set(indx_pack>=km1, km1-1);
+    y2(k2) = y1s + (y1-y1s)*(x2(k2)-x1s)/(x1-x1s);
+  });
+  team.team_barrier();
 
-      ekat::index_and_shift<-1>(sx1, indx_pack, x1, x1s);
-      ekat::index_and_shift<-1>(sy1, indx_pack, y1, y1s);
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, km2_pack), [&] (const Int& k2) {
+    y2(k2).set(y2(k2) < minthresh, minthresh);
+  });
+}
 
-      y2(k2) = y1s + (y1-y1s)*(x2(k2)-x1s)/(x1-x1s);
-    });
-  }
-  else if (km2 == km1+1) {
-
-    // TODO: This implementation may need to be tweaked for better CPU performance.
-    // Specifically, CPU perf may improve if the top and bottom pack are handled in
-    // a Kokkos::single block so that all conditionals can be removed from the ||4.
-    // Keep thread0 unoccupied so it can process the Kokkos::single while other threads
-    // are doing the ||4.
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, km2_pack), [&] (const Int& k2) {
-      Spack x1, x1s, y1, y1s; // s->-1 shift
-      auto indx_pack = ekat::range<IntSmallPack>(k2*Spack::n);
-      indx_pack.set(indx_pack < 1, 1); // special shift for 0 boundary case
-      indx_pack.set(indx_pack >= km2-1, km1-1); // special shift for top boundary case
-      ekat::index_and_shift<-1>(sx1, indx_pack, x1, x1s);
-      ekat::index_and_shift<-1>(sy1, indx_pack, y1, y1s);
-
-      y2(k2) = y1s + (y1-y1s)*(x2(k2)-x1s)/(x1-x1s);
-    });
-  }
-  else {
-    EKAT_KERNEL_REQUIRE_MSG(false, "Unsupported dimensions for linear interp");
-  }
-  team.team_barrier();
+template<typename S, typename D, int N>
+KOKKOS_FUNCTION
+void Functions<S,D,N>::linear_interp_weights(
+  const MemberType& team,
+  const uview_1d<const Spack>& x1,
+  const uview_1d<const Spack>& x2,
+  const Int& km1,
+  const Int& km2,
+  const LinearInterpWeights& weights)
+{
+  EKAT_KERNEL_REQUIRE_MSG(km1 == km2+1 || km2 == km1+1, "Unsupported dimensions for linear interp");
+
+  const auto sx1 = scalarize(x1);
+  const Int km2_pack = ekat::npack<Spack>(km2);
 
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, km2_pack), [&] (const Int& k2) {
+    Spack x1, x1s; // s->-1 shift
+    const auto indx_pack = linear_interp_index(k2, km1, km2);
+    ekat::index_and_shift<-1>(sx1, indx_pack, x1, x1s);
+
+    weights.num(k2) = x2(k2)-x1s;
+    weights.den(k2) = x1-x1s;
+  });
+}
+
+template<typename S, typename D, int N>
+KOKKOS_FUNCTION
+void Functions<S,D,N>::linear_interp(
+  const MemberType& team,
+  const LinearInterpWeights& weights,
+  const uview_1d<const Spack>& y1,
+  const uview_1d<Spack>& y2,
+  const Int& km1,
+  const Int& km2,
+  const Scalar& minthresh)
+{
+  EKAT_KERNEL_REQUIRE_MSG(km1 == km2+1 || km2 == km1+1, "Unsupported dimensions for linear interp");
+
+  const auto sy1 = scalarize(y1);
+  const Int km2_pack = ekat::npack<Spack>(km2);
+
+  // Each thread only touches its own packs of y2, so the threshold
+  // can be applied in the same loop.
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, km2_pack), [&] (const Int& k2) {
+    Spack y1, y1s; // s->-1 shift
+    const auto indx_pack = linear_interp_index(k2, km1, km2);
+    ekat::index_and_shift<-1>(sy1, indx_pack, y1, y1s);
+
+    y2(k2) = y1s + (y1-y1s)*weights.num(k2)/weights.den(k2);
     y2(k2).set(y2(k2) < minthresh, minthresh);
   });
 }
@@ -15,8 +15,8 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
-Int Functions<S,D>::shoc_init(
+template<typename S, typename D, int N>
+Int Functions<S,D,N>::shoc_init(
   const Int&                  nbot_shoc,
   const Int&                  ntop_shoc,
   const view_1d<const Spack>& pref_mid)
@@ -61,9 +61,9 @@ Int Functions<S,D>::shoc_init(
   return host_view(0);
 }
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::shoc_main_internal(
+void Functions<S,D,N>::shoc_main_internal(
   const MemberType&            team,
   const Int&                   nlev,         // Number of levels
   const Int&                   nlevi,        // Number of levels on interface grid
@@ -123,10 +123,13 @@ void Functions<S,D>::shoc_main_internal(
   const uview_1d<Spack>&       isotropy)
 {
   // Define temporary variables
-  uview_1d<Spack> rho_zt, shoc_qv, dz_zt, dz_zi;
-  workspace.template take_many_and_reset<4>(
-    {"rho_zt", "shoc_qv", "dz_zt", "dz_zi"},
-    {&rho_zt, &shoc_qv, &dz_zt, &dz_zi});
+  uview_1d<Spack> rho_zt, shoc_qv, dz_zt, dz_zi,
+                  zt_to_zi_num, zt_to_zi_den, zi_to_zt_num, zi_to_zt_den;
+  workspace.template take_many_and_reset<8>(
+    {"rho_zt", "shoc_qv", "dz_zt", "dz_zi",
+     "zt_to_zi_num", "zt_to_zi_den", "zi_to_zt_num", "zi_to_zt_den"},
+    {&rho_zt, &shoc_qv, &dz_zt, &dz_zi,
+     &zt_to_zi_num, &zt_to_zi_den, &zi_to_zt_num, &zi_to_zt_den});
 
   // Local scalars
   Scalar se_b{0},   ke_b{0}, wv_b{0},   wl_b{0},
@@ -145,6 +148,14 @@ void Functions<S,D>::shoc_main_internal(
   shoc_energy_integrals(team,nlev,host_dse,pdel,qw,shoc_ql,u_wind,v_wind, // Input
                         se_b,ke_b,wv_b,wl_b);                             // Output
 
+  // The grids do not change during the call, so the weights for
+  // interpolating between them are computed once for all substeps.
+  const LinearInterpWeights zt_to_zi{zt_to_zi_num, zt_to_zi_den};
+  const LinearInterpWeights zi_to_zt{zi_to_zt_num, zi_to_zt_den};
+  linear_interp_weights(team,zt_grid,zi_grid,nlev,nlevi,zt_to_zi);
+  linear_interp_weights(team,zi_grid,zt_grid,nlevi,nlev,zi_to_zt);
+  team.team_barrier();
+
   for (Int t=0; t<nadv; ++t) {
     // Check TKE to make sure values lie within acceptable
     // bounds after host model performs horizontal advection
@@ -183,17 +194,17 @@ void Functions<S,D>::shoc_main_internal(
             pblh);                    // Output
 
     // Update the turbulent length scale
-    shoc_length(team,nlev,nlevi,dx,dy, // Input
-                zt_grid,zi_grid,dz_zt, // Input
-                tke,thv,               // Input
-                workspace,             // Workspace
-                brunt,shoc_mix);       // Output
+    shoc_length(team,nlev,nlevi,dx,dy,  // Input
+                zt_grid,zt_to_zi,dz_zt, // Input
+                tke,thv,                // Input
+                workspace,              // Workspace
+                brunt,shoc_mix);        // Output
 
     // Advance the SGS TKE equation
     shoc_tke(team,nlev,nlevi,dtime,wthv_sec,    // Input
              shoc_mix,dz_zi,dz_zt,pres,u_wind,  // Input
              v_wind,brunt,obklen,zt_grid,       // Input
-             zi_grid,pblh,                      // Input
+             zi_to_zt,pblh,                     // Input
              workspace,                         // Workspace
              tke,tk,tkh,                        // Input/Output
              isotropy);                         // Output
@@ -202,14 +213,14 @@ void Functions<S,D>::shoc_main_internal(
     // via implicit diffusion solver
     team.team_barrier();
     update_prognostics_implicit(team,nlev,nlevi,num_qtracers,dtime,dz_zt,   // Input
-                                dz_zi,rho_zt,zt_grid,zi_grid,tk,tkh,uw_sfc, // Input
+                                dz_zi,rho_zt,zt_to_zi,tk,tkh,uw_sfc,        // Input
                                 vw_sfc,wthl_sfc,wqw_sfc,wtracer_sfc,        // Input
                                 workspace,                                  // Workspace
                                 thetal,qw,qtracers,tke,u_wind,v_wind);   // Input/Output
 
     // Diagnose the second order moments
     diag_second_shoc_moments(team,nlev,nlevi,thetal,qw,u_wind,v_wind,   // Input
-                             tke,isotropy,tkh,tk,dz_zi,zt_grid,zi_grid, // Input
+                             tke,isotropy,tkh,tk,dz_zi,zt_to_zi,        // Input
                              shoc_mix,wthl_sfc,wqw_sfc,uw_sfc,vw_sfc,   // Input
                              ustar2,wstar,                              // Input/Output
                              workspace,                                 // Workspace
@@ -220,7 +231,7 @@ void Functions<S,D>::shoc_main_internal(
     //  needed for the PDF closure
     diag_third_shoc_moments(team,nlev,nlevi,w_sec,thl_sec,wthl_sec, // Input
                             isotropy,brunt,thetal,tke,dz_zt,dz_zi,  // Input
-                            zt_grid,zi_grid,                        // Input
+                            zt_to_zi,                               // Input
                             workspace,                              // Workspace
                             w3);                                    // Output
 
@@ -228,7 +239,7 @@ void Functions<S,D>::shoc_main_internal(
     team.team_barrier();
     shoc_assumed_pdf(team,nlev,nlevi,thetal,qw,w_field,thl_sec,qw_sec, // Input
                      wthl_sec,w_sec,wqw_sec,qwthl_sec,w3,pres,         // Input
-                     zt_grid, zi_grid,                                 // Input
+                     zi_to_zt,                                         // Input
                      workspace,                                        // Workspace
                      shoc_cldfrac,shoc_ql,wqls_sec,wthv_sec,shoc_ql2); // Ouptut
 
@@ -250,7 +261,7 @@ void Functions<S,D>::shoc_main_internal(
                         qw,shoc_ql,u_wind,v_wind, // Input
                         se_a,ke_a,wv_a,wl_a);     // Output
 
-  shoc_energy_fixer(team,nlev,nlevi,dtime,nadv,zt_grid,zi_grid, // Input
+  shoc_energy_fixer(team,nlev,nlevi,dtime,nadv,zt_to_zi,        // Input
                     se_b,ke_b,wv_b,wl_b,se_a,ke_a,wv_a,wl_a,    // Input
                     wthl_sfc,wqw_sfc,rho_zt,tke,presi,          // Input
                     workspace,                                  // Workspace
@@ -283,13 +294,14 @@ void Functions<S,D>::shoc_main_internal(
           pblh);                          // Output
 
   // Release temporary variables from the workspace
-  workspace.template release_many_contiguous<4>(
-    {&rho_zt, &shoc_qv, &dz_zt, &dz_zi});
+  workspace.template release_many_contiguous<8>(
+    {&rho_zt, &shoc_qv, &dz_zt, &dz_zi,
+     &zt_to_zi_num, &zt_to_zi_den, &zi_to_zt_num, &zi_to_zt_den});
 }
 
 
-template<typename S, typename D>
-Int Functions<S,D>::shoc_main(
+template<typename S, typename D, int N>
+Int Functions<S,D,N>::shoc_main(
   const Int&               shcol,               // Number of SHOC columns in the array
   const Int&               nlev,                // Number of levels
   const Int&               nlevi,               // Number of levels on interface grid
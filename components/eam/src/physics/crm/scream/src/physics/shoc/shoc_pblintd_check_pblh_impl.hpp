@@ -11,9 +11,9 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::pblintd_check_pblh(const Int& nlevi, const Int& npbl, 
+void Functions<S,D,N>::pblintd_check_pblh(const Int& nlevi, const Int& npbl, 
        const uview_1d<const Spack>& z, const Scalar& ustar, const bool& check, Scalar& pblh)
 {
    // PBL height must be greater than some minimum mechanical mixing depth
@@ -8,9 +8,9 @@
 namespace scream {
 namespace shoc {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>
+void Functions<S,D,N>
 ::shoc_pblintd_cldcheck(
     const Scalar& zi, const Scalar& cldn, 
     Scalar& pblh)
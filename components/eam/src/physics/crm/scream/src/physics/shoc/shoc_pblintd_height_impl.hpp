@@ -14,9 +14,9 @@ namespace shoc {
 // PBL height calculation: Scan upward until the Richardson number between
 // the first level and the current level exceeds the "critical" value.
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::pblintd_height(
+void Functions<S,D,N>::pblintd_height(
   const MemberType& team,
   const Int& nlev,
   const Int& npbl,
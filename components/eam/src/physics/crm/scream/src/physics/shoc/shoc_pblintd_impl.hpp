@@ -37,9 +37,9 @@ namespace shoc {
 // Author: B. Stevens (extracted from pbldiff, August 2000)
 //
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::pblintd(
+void Functions<S,D,N>::pblintd(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -17,9 +17,9 @@ namespace shoc {
  * production, and dissipation processes.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::shoc_tke(
+void Functions<S,D,N>::shoc_tke(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -34,7 +34,7 @@ void Functions<S,D>::shoc_tke(
   const uview_1d<const Spack>& brunt,
   const Scalar&                obklen,
   const uview_1d<const Spack>& zt_grid,
-  const uview_1d<const Spack>& zi_grid,
+  const LinearInterpWeights&   zi_to_zt,
   const Scalar&                pblh,
   const Workspace&             workspace,
   const uview_1d<Spack>&       tke,
@@ -58,7 +58,7 @@ void Functions<S,D>::shoc_tke(
 
   // Interpolate shear term from interface to thermo grid
   team.team_barrier();
-  linear_interp(team,zi_grid,zt_grid,sterm,sterm_zt,nlevi,nlev,0);
+  linear_interp(team,zi_to_zt,sterm,sterm_zt,nlevi,nlev,0);
 
   // Advance sgs TKE
   adv_sgs_tke(team,nlev,dtime,shoc_mix,wthv_sec,sterm_zt,tk,tke,a_diss);
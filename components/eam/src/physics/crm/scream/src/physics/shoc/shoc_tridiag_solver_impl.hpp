@@ -7,9 +7,9 @@
 namespace scream {
 namespace shoc {
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::vd_shoc_decomp(
+void Functions<S,D,N>::vd_shoc_decomp(
   const MemberType&            team,
   const Int&                   nlev,
   const uview_1d<const Spack>& kv_term,
@@ -74,9 +74,9 @@ void Functions<S,D>::vd_shoc_decomp(
   });
 }
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::vd_shoc_solve(
+void Functions<S,D,N>::vd_shoc_solve(
   const MemberType&      team,
   const uview_1d<Scalar>& du,
   const uview_1d<Scalar>& dl,
@@ -11,9 +11,9 @@ namespace shoc {
  * #include this file, but include shoc_functions.hpp instead.
  */
 
-template<typename S, typename D>
+template<typename S, typename D, int N>
 KOKKOS_FUNCTION
-void Functions<S,D>::update_prognostics_implicit(
+void Functions<S,D,N>::update_prognostics_implicit(
   const MemberType&            team,
   const Int&                   nlev,
   const Int&                   nlevi,
@@ -22,8 +22,7 @@ void Functions<S,D>::update_prognostics_implicit(
   const uview_1d<const Spack>& dz_zt,
   const uview_1d<const Spack>& dz_zi,
   const uview_1d<const Spack>& rho_zt,
-  const uview_1d<const Spack>& zt_grid,
-  const uview_1d<const Spack>& zi_grid,
+  const LinearInterpWeights&   zt_to_zi,
   const uview_1d<const Spack>& tk,
   const uview_1d<const Spack>& tkh,
   const Scalar&                uw_sfc,
@@ -88,9 +87,9 @@ void Functions<S,D>::update_prognostics_implicit(
   const auto wtracer_sfc_s  = ekat::scalarize(wtracer_sfc);
 
   // linearly interpolate tkh, tk, and air density onto the interface grids
-  linear_interp(team,zt_grid,zi_grid,tkh,tkh_zi,nlev,nlevi,0);
-  linear_interp(team,zt_grid,zi_grid,tk,tk_zi,nlev,nlevi,0);
-  linear_interp(team,zt_grid,zi_grid,rho_zt,rho_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,tkh,tkh_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,tk,tk_zi,nlev,nlevi,0);
+  linear_interp(team,zt_to_zi,rho_zt,rho_zi,nlev,nlevi,0);
 
   // Define the tmpi variable, which is really dt*(g*rho)**2/dp
   // at interfaces. Substitue dp = g*rho*dz in the above equation
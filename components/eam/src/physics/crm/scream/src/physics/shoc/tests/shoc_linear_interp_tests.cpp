@@ -11,6 +11,7 @@
 #include "ekat/ekat_pack.hpp"
 #include "ekat/util/ekat_arch.hpp"
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
 
 #include <algorithm>
 #include <array>
@@ -390,6 +391,80 @@ struct UnitWrap::UnitTest<D>::TestShocLinearInt {
     }
   } // run_bfb
 
+  static void run_weights()
+  {
+    // Interpolating with weights from linear_interp_weights must give
+    // exactly the same answers as linear_interp on the grids.
+    auto engine = setup_random_test();
+
+    LinearInterpData ref_data[] = {
+      //                   shcol, nlev(km1), nlevi(km2), minthresh
+      LinearInterpData(10, 72, 71, 1e-15),
+      LinearInterpData(10, 71, 72, 1e-15),
+      LinearInterpData(1, 15, 16, 1e-15),
+      LinearInterpData(1, 16, 15, 1e-15),
+      LinearInterpData(1, 5, 6, 1e-15),
+      LinearInterpData(1, 6, 5, 1e-15),
+    };
+
+    for (auto& d : ref_data) {
+      d.randomize(engine);
+
+      const Int ncol = d.ncol, km1 = d.km1, km2 = d.km2;
+      const Scalar minthresh = d.minthresh;
+      const Int km1_pack = ekat::npack<Spack>(km1);
+      const Int km2_pack = ekat::npack<Spack>(km2);
+
+      view_2d<Spack> x1_d("x1", ncol, km1_pack), y1_d("y1", ncol, km1_pack),
+                     x2_d("x2", ncol, km2_pack), y2_d("y2", ncol, km2_pack),
+                     num_d("num", ncol, km2_pack), den_d("den", ncol, km2_pack);
+
+      const auto x1_h = Kokkos::create_mirror_view(x1_d);
+      const auto y1_h = Kokkos::create_mirror_view(y1_d);
+      const auto x2_h = Kokkos::create_mirror_view(x2_d);
+      for (Int i = 0; i < ncol; ++i) {
+        for (Int k = 0; k < km1; ++k) {
+          x1_h(i, k/Spack::n)[k%Spack::n] = d.x1[i*km1 + k];
+          y1_h(i, k/Spack::n)[k%Spack::n] = d.y1[i*km1 + k];
+        }
+        for (Int k = 0; k < km2; ++k) {
+          x2_h(i, k/Spack::n)[k%Spack::n] = d.x2[i*km2 + k];
+        }
+      }
+      Kokkos::deep_copy(x1_d, x1_h);
+      Kokkos::deep_copy(y1_d, y1_h);
+      Kokkos::deep_copy(x2_d, x2_h);
+
+      const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, std::max(km1_pack, km2_pack));
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+        const Int i = team.league_rank();
+
+        const typename Functions::LinearInterpWeights weights{ekat::subview(num_d, i),
+                                                              ekat::subview(den_d, i)};
+        Functions::linear_interp_weights(team, ekat::subview(x1_d, i), ekat::subview(x2_d, i),
+                                         km1, km2, weights);
+        team.team_barrier();
+
+        Functions::linear_interp(team, weights, ekat::subview(y1_d, i), ekat::subview(y2_d, i),
+                                 km1, km2, minthresh);
+      });
+
+      const auto y2_h = Kokkos::create_mirror_view(y2_d);
+      Kokkos::deep_copy(y2_h, y2_d);
+
+      // Reference, using the grids directly
+      d.transpose<ekat::TransposeDirection::c2f>(); // _f expects data in fortran layout
+      linear_interp_f(d.x1, d.x2, d.y1, d.y2, d.km1, d.km2, d.ncol, d.minthresh);
+      d.transpose<ekat::TransposeDirection::f2c>(); // go back to C layout
+
+      for (Int i = 0; i < ncol; ++i) {
+        for (Int k = 0; k < km2; ++k) {
+          REQUIRE(d.y2[i*km2 + k] == y2_h(i, k/Spack::n)[k%Spack::n]);
+        }
+      }
+    }
+  } // run_weights
+
 };
 
 }  // namespace unit_test
@@ -412,4 +487,11 @@ TEST_CASE("shoc_linear_interp_bfb", "shoc")
   TestStruct::run_bfb();
 }
 
+TEST_CASE("shoc_linear_interp_weights", "shoc")
+{
+  using TestStruct = scream::shoc::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestShocLinearInt;
+
+  TestStruct::run_weights();
+}
+
 } // namespace
@@ -16,12 +16,37 @@ using Real = double;
 using Real = float;
 #endif
 
+// Number of lanes of the small packs of physics kernels running on scalar type
+// S. A kernel on a scalar type narrower than Real (float kernels in a mixed
+// precision build) gets proportionally more lanes, so that its packs span as
+// many bytes as a small pack of Reals. The result is clamped to
+// SCREAM_PACK_SIZE, and falls back to SCREAM_SMALL_PACK_SIZE if it does not
+// divide SCREAM_PACK_SIZE, so that small packs still tile big packs. GPU
+// builds (pack size 1) are unaffected.
+template <typename S>
+constexpr int small_pack_size () {
+  return (SCREAM_SMALL_PACK_SIZE > 1 && sizeof(S) < sizeof(Real)) ?
+    (SCREAM_SMALL_PACK_SIZE*static_cast<int>(sizeof(Real)/sizeof(S)) >= SCREAM_PACK_SIZE ?
+     SCREAM_PACK_SIZE :
+     (SCREAM_PACK_SIZE % (SCREAM_SMALL_PACK_SIZE*static_cast<int>(sizeof(Real)/sizeof(S))) == 0 ?
+      SCREAM_SMALL_PACK_SIZE*static_cast<int>(sizeof(Real)/sizeof(S)) :
+      SCREAM_SMALL_PACK_SIZE)) :
+    SCREAM_SMALL_PACK_SIZE;
+}
+
 // Kokkos types
 using ekat::KokkosTypes;
 using ekat::DefaultDevice;
 using ekat::HostDevice;
 using ekat::Unmanaged;
 
+// Explicitly instantiate F<Real,DefaultDevice,N> for each extra small pack size
+// N (SCREAM_EXTRA_PACK_SIZES). Goes next to the ETI of the P3, SHOC and shared
+// physics Functions structs for the default pack size.
+#define SCREAM_ETI_EXTRA_PACK_SIZE(F, N) template struct F<Real,DefaultDevice,N>;
+#define SCREAM_ETI_EXTRA_PACK_SIZES(F) \
+  SCREAM_FOR_EACH_EXTRA_PACK_SIZE(SCREAM_ETI_EXTRA_PACK_SIZE, F)
+
 // Miscellanea
 
 // An enum to be used with object that have 'repository'-like behavior
@@ -7,6 +7,16 @@
 #include "rrtmgp_const.h"
 #include "mo_fluxes_byband.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 // Prototypes
 extern "C" int get_nband_sw();
 extern "C" int get_nband_lw();
@@ -17,6 +27,7 @@ extern "C" double get_max_temperature();
 extern "C" void get_gpoint_bands_sw(int *gpoint_bands);
 extern "C" void get_gpoint_bands_lw(int *gpoint_bands);
 extern "C" void rrtmgp_finalize();
+extern "C" void rrtmgp_set_ncol_chunk_cxx(int ncol_chunk, bool verbose);
 extern "C" void rrtmgp_run_sw (
         int ngas, int ncol, int nlay,
         double *gas_vmr_p, double *pmid_p      , double *tmid_p      , double *pint_p,
@@ -27,7 +38,7 @@ extern "C" void rrtmgp_run_sw (
         double *allsky_bnd_flux_up_p, double *allsky_bnd_flux_dn_p, double *allsky_bnd_flux_net_p, double *allsky_bnd_flux_dn_dir_p,
         double *clrsky_flux_up_p    , double *clrsky_flux_dn_p    , double *clrsky_flux_net_p    , double *clrsky_flux_dn_dir_p,
         double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p, double *clrsky_bnd_flux_dn_dir_p,
-        double tsi_scaling
+        double tsi_scaling, int output_mask
         );
 extern "C" void rrtmgp_run_lw (
         int ngas, int ncol, int nlay,
@@ -38,9 +49,19 @@ extern "C" void rrtmgp_run_lw (
         double *allsky_flux_up_p    , double *allsky_flux_dn_p    , double *allsky_flux_net_p    ,
         double *allsky_bnd_flux_up_p, double *allsky_bnd_flux_dn_p, double *allsky_bnd_flux_net_p,
         double *clrsky_flux_up_p    , double *clrsky_flux_dn_p    , double *clrsky_flux_net_p    ,
-        double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p
+        double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p,
+        int output_mask
         );
 
+// Bits of the output_mask argument of rrtmgp_run_sw and rrtmgp_run_lw, which
+// select the optional outputs; these must match the rrtmgp_output_*
+// parameters in rrtmgp_interface.F90. All-sky broadband fluxes are always
+// computed. Outputs that are not selected are neither computed nor copied
+// back, and are left untouched on host.
+int constexpr OUTPUT_CLRSKY     = 1;  // Clear-sky fluxes (an extra rte_sw/rte_lw pass)
+int constexpr OUTPUT_ALLSKY_BND = 2;  // Band-resolved all-sky fluxes
+int constexpr OUTPUT_CLRSKY_BND = 4;  // Band-resolved clear-sky fluxes (with OUTPUT_CLRSKY)
+
 // Objects live here in file scope because they need to be initialized just *once*
 GasOpticsRRTMGP k_dist_sw;
 GasOpticsRRTMGP k_dist_lw;
@@ -48,6 +69,93 @@ GasOpticsRRTMGP k_dist_lw;
 // Vector of strings to hold active gas names. 
 string1d active_gases;
 
+// Device data that persists across radiation calls, so that rrtmgp_run_sw and
+// rrtmgp_run_lw do not allocate on every call. Arrays are carved out of flat
+// buffers that only ever grow, so once the largest ncol has been seen (all
+// columns for LW, all daytime columns for SW) no further device allocations
+// are done. Each array is wrapped with the exact dimensions of the current
+// call, since RTE and RRTMGP take ncol and nlay from the array dimensions.
+struct RadiationWorkspace {
+    // Get a device array of the given dimensions, backed by the buffer called
+    // name. Arrays obtained with different names do not alias each other.
+    template <class... Dims>
+    Array<real,sizeof...(Dims),memDevice,styleFortran> get(std::string const &name, Dims... dims) {
+        int n = 1;
+        for (int d : {dims...}) { n *= d; }
+        auto &buf = buffers[name];
+        if (!buf.initialized() || buf.get_totElems() < n) {
+            if (buf.initialized()) { bytes -= buf.get_totElems()*sizeof(real); }
+            buf = real1d(name.c_str(), n);
+            bytes += n*sizeof(real);
+        }
+        return Array<real,sizeof...(Dims),memDevice,styleFortran>(name.c_str(), buf.data(), dims...);
+    }
+
+    // Same as get, for the host buffers used to stage blocks of columns
+    realHost1d get_host(std::string const &name, int n) {
+        auto &buf = host_buffers[name];
+        if (!buf.initialized() || buf.get_totElems() < n) {
+            buf = realHost1d(name.c_str(), n);
+        }
+        return realHost1d(name.c_str(), buf.data(), n);
+    }
+
+    std::map<std::string,real1d> buffers;
+    std::map<std::string,realHost1d> host_buffers;
+
+    // Device memory held by buffers. Buffers never shrink, so this is also the
+    // high-water mark of the workspace.
+    size_t bytes = 0;
+
+    // Maximum number of columns per block in rrtmgp_run_sw and rrtmgp_run_lw,
+    // or all columns at once if <= 0 (see run_column_blocks)
+    int ncol_chunk = 0;
+
+    // Timings of rrtmgp_run_sw and rrtmgp_run_lw by output_mask, reported at
+    // finalization if verbose, so that different ncol_chunk and output
+    // selections can be compared.
+    struct RunStats {
+        int    ncalls  = 0;
+        double ncols   = 0;
+        double seconds = 0;
+        void add(int ncol, double elapsed) { ncalls++; ncols += ncol; seconds += elapsed; }
+    };
+    std::map<int,RunStats> sw_stats, lw_stats;
+    bool verbose = false;
+
+    // Optical properties and gas concentrations only need their spectral
+    // discretization (and gas names) set once; their arrays are set to
+    // workspace arrays on each call.
+    GasConcs gas_concs;
+    OpticalProps2str sw_combined_optics, sw_aerosol_optics, sw_cloud_optics;
+    OpticalProps1scl lw_combined_optics, lw_aerosol_optics, lw_cloud_optics;
+
+    // Source functions are allocated once per problem size. With column
+    // blocks there are two sizes per call, the block size and the remainder,
+    // so at most two sizes are kept, evicting the least recently used one.
+    // The list is ordered from most to least recently used.
+    SourceFuncLW &get_lw_sources(int ncol, int nlay) {
+        auto key = std::make_pair(ncol, nlay);
+        auto it = std::find_if(lw_sources.begin(), lw_sources.end(),
+                               [&](const std::pair<std::pair<int,int>,SourceFuncLW> &s) { return s.first == key; });
+        if (it == lw_sources.end()) {
+            if (lw_sources.size() >= 2) { lw_sources.pop_back(); }
+            lw_sources.emplace_front(key, SourceFuncLW());
+            lw_sources.front().second.alloc(ncol, nlay, k_dist_lw);
+        } else {
+            lw_sources.splice(lw_sources.begin(), lw_sources, it);
+        }
+        return lw_sources.front().second;
+    }
+    std::list<std::pair<std::pair<int,int>,SourceFuncLW>> lw_sources;
+
+    // Gaussian quadrature for rte_lw
+    static int constexpr max_gauss_pts = 4;
+    real2d gauss_Ds;
+    real2d gauss_wts;
+};
+std::unique_ptr<RadiationWorkspace> workspace;
+
 extern "C" void rrtmgp_initialize_cxx(int ngas, char *gas_names[], char const *coefficients_file_sw, char const *coefficients_file_lw) {
     // First, make sure yakl has been initialized
     if (!yakl::isInitialized()) {
@@ -71,9 +179,64 @@ extern "C" void rrtmgp_initialize_cxx(int ngas, char *gas_names[], char const *c
     available_gases.init(active_gases, 1, 1);
     load_and_init(k_dist_sw, coefficients_file_sw, available_gases);
     load_and_init(k_dist_lw, coefficients_file_lw, available_gases);
+
+    // Set up the workspace for rrtmgp_run_sw and rrtmgp_run_lw
+    workspace = std::unique_ptr<RadiationWorkspace>(new RadiationWorkspace());
+    auto &ws = *workspace;
+    ws.gas_concs.init(active_gases, 1, 1);
+    ws.sw_combined_optics.init(k_dist_sw.get_band_lims_wavenumber(), k_dist_sw.get_band_lims_gpoint());
+    ws.sw_aerosol_optics .init(k_dist_sw.get_band_lims_wavenumber(), k_dist_sw.get_band_lims_gpoint());
+    ws.sw_cloud_optics   .init(k_dist_sw.get_band_lims_wavenumber(), k_dist_sw.get_band_lims_gpoint());
+    ws.lw_combined_optics.init(k_dist_lw.get_band_lims_wavenumber(), k_dist_lw.get_band_lims_gpoint());
+    ws.lw_aerosol_optics .init(k_dist_lw.get_band_lims_wavenumber());
+    ws.lw_cloud_optics   .init(k_dist_lw.get_band_lims_wavenumber(), k_dist_lw.get_band_lims_gpoint());
+
+    // Weights and angle secants for first order (k=1) Gaussian quadrature.
+    //   Values from Table 2, Clough et al, 1992, doi:10.1029/92JD01419
+    //   after Abramowitz & Stegun 1972, page 921
+    int constexpr max_gauss_pts = RadiationWorkspace::max_gauss_pts;
+    realHost2d gauss_Ds_host ("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
+    gauss_Ds_host(1,1) = 1.66_wp      ; gauss_Ds_host(2,1) =         0._wp; gauss_Ds_host(3,1) =         0._wp; gauss_Ds_host(4,1) =         0._wp;
+    gauss_Ds_host(1,2) = 1.18350343_wp; gauss_Ds_host(2,2) = 2.81649655_wp; gauss_Ds_host(3,2) =         0._wp; gauss_Ds_host(4,2) =         0._wp;
+    gauss_Ds_host(1,3) = 1.09719858_wp; gauss_Ds_host(2,3) = 1.69338507_wp; gauss_Ds_host(3,3) = 4.70941630_wp; gauss_Ds_host(4,3) =         0._wp;
+    gauss_Ds_host(1,4) = 1.06056257_wp; gauss_Ds_host(2,4) = 1.38282560_wp; gauss_Ds_host(3,4) = 2.40148179_wp; gauss_Ds_host(4,4) = 7.15513024_wp;
+
+    realHost2d gauss_wts_host("gauss_wts",max_gauss_pts,max_gauss_pts);
+    gauss_wts_host(1,1) = 0.5_wp         ; gauss_wts_host(2,1) = 0._wp          ; gauss_wts_host(3,1) = 0._wp          ; gauss_wts_host(4,1) = 0._wp          ;
+    gauss_wts_host(1,2) = 0.3180413817_wp; gauss_wts_host(2,2) = 0.1819586183_wp; gauss_wts_host(3,2) = 0._wp          ; gauss_wts_host(4,2) = 0._wp          ;
+    gauss_wts_host(1,3) = 0.2009319137_wp; gauss_wts_host(2,3) = 0.2292411064_wp; gauss_wts_host(3,3) = 0.0698269799_wp; gauss_wts_host(4,3) = 0._wp          ;
+    gauss_wts_host(1,4) = 0.1355069134_wp; gauss_wts_host(2,4) = 0.2034645680_wp; gauss_wts_host(3,4) = 0.1298475476_wp; gauss_wts_host(4,4) = 0.0311809710_wp;
+
+    ws.gauss_Ds  = real2d("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
+    ws.gauss_wts = real2d("gauss_wts",max_gauss_pts,max_gauss_pts);
+    gauss_Ds_host .deep_copy_to(ws.gauss_Ds );
+    gauss_wts_host.deep_copy_to(ws.gauss_wts);
+    yakl::fence();
+}
+
+extern "C" void rrtmgp_set_ncol_chunk_cxx(int ncol_chunk, bool verbose) {
+    workspace->ncol_chunk = ncol_chunk;
+    workspace->verbose = verbose;
 }
 
 extern "C" void rrtmgp_finalize() {
+    auto &ws = *workspace;
+    if (ws.verbose) {
+        printf("RRTMGP column blocks: ncol_chunk = %d, device workspace = %.1f MB\n",
+               ws.ncol_chunk, ws.bytes / (1024.*1024.));
+        for (auto const &s : {std::make_pair("SW", &ws.sw_stats), std::make_pair("LW", &ws.lw_stats)}) {
+            for (auto const &m : *s.second) {
+                int const mask = m.first;
+                auto const &stats = m.second;
+                printf("  %s (clrsky %d, allsky bnd %d, clrsky bnd %d): %d calls, %.0f columns, %.3f s, %.1f columns/s\n",
+                       s.first, (mask & OUTPUT_CLRSKY) != 0, (mask & OUTPUT_ALLSKY_BND) != 0, (mask & OUTPUT_CLRSKY_BND) != 0,
+                       stats.ncalls, stats.ncols, stats.seconds, stats.ncols / stats.seconds);
+            }
+        }
+    }
+
+    // Workspace arrays must be released before yakl is finalized
+    workspace.reset();
     k_dist_sw.finalize();
     k_dist_lw.finalize();
     yakl::finalize();
@@ -117,119 +280,157 @@ extern "C" void get_gpoint_bands_lw(int *gpoint_bands_p) {
     yakl::fence();
 }
 
-extern "C" void rrtmgp_run_sw (
-        int ngas, int ncol, int nlay,
-        double *gas_vmr_p, double *pmid_p      , double *tmid_p      , double *pint_p,
-        double *coszrs_p , double *albedo_dir_p, double *albedo_dif_p,
-        double *cld_tau_gpt_p, double *cld_ssa_gpt_p, double *cld_asm_gpt_p,
-        double *aer_tau_bnd_p, double *aer_ssa_bnd_p, double *aer_asm_bnd_p,
-        double *allsky_flux_up_p    , double *allsky_flux_dn_p    , double *allsky_flux_net_p    , double *allsky_flux_dn_dir_p,
-        double *allsky_bnd_flux_up_p, double *allsky_bnd_flux_dn_p, double *allsky_bnd_flux_net_p, double *allsky_bnd_flux_dn_dir_p,
-        double *clrsky_flux_up_p    , double *clrsky_flux_dn_p    , double *clrsky_flux_net_p    , double *clrsky_flux_dn_dir_p,
-        double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p, double *clrsky_bnd_flux_dn_dir_p,
-        double tsi_scaling
-        ) {
+// A host array in Fortran order with dimensions (nlead, ncol, ntrail), where
+// nlead and/or ntrail may be 1, e.g. gas_vmr(ngas,ncol,nlay) or
+// pint(ncol,nlay+1). A block of columns of such an array is a strided set of
+// contiguous runs of nlead*nc values.
+struct ColumnArray {
+    char const *name;
+    real *p;
+    int nlead;
+    int ntrail;
+};
+
+// Copy columns [icol0, icol0+nc) of an array with ncol columns to a contiguous
+// buffer dimensioned (nlead, nc, ntrail)
+static void pack_columns(ColumnArray const &a, int ncol, int icol0, int nc, real *buf) {
+    for (int k = 0; k < a.ntrail; k++) {
+        std::copy_n(a.p + (size_t(k)*ncol + icol0)*a.nlead, size_t(nc)*a.nlead, buf + size_t(k)*nc*a.nlead);
+    }
+}
+
+// Inverse of pack_columns
+static void unpack_columns(ColumnArray const &a, int ncol, int icol0, int nc, real const *buf) {
+    for (int k = 0; k < a.ntrail; k++) {
+        std::copy_n(buf + size_t(k)*nc*a.nlead, size_t(nc)*a.nlead, a.p + (size_t(k)*ncol + icol0)*a.nlead);
+    }
+}
+
+// Run compute(nc, in, out) over blocks of at most workspace->ncol_chunk
+// columns, where in and out hold device pointers to the inputs and outputs
+// of a block of nc columns, dimensioned as the host arrays but with nc
+// columns. Outputs with a null host pointer are skipped, and get a null
+// device pointer. Inputs are double-buffered on device: kernels are launched
+// asynchronously, so while the device works on block N the inputs of block
+// N+1 are packed on host and copied into the other set of buffers, and block
+// N+1 can start as soon as the outputs of block N have been copied out.
+template <class F>
+static void run_column_blocks(int ncol, std::vector<ColumnArray> const &inputs,
+                              std::vector<ColumnArray> const &outputs, F const &compute) {
+    auto &ws = *workspace;
+    int const chunk = ws.ncol_chunk > 0 ? std::min(ws.ncol_chunk, ncol) : ncol;
+    int const nblocks = (ncol + chunk - 1) / chunk;
+
+    // With a single block the host arrays are copied as they are
+    auto copy_in = [&] (int iblock, std::vector<real*> &in) {
+        int const icol0 = iblock * chunk;
+        int const nc = std::min(chunk, ncol - icol0);
+        std::string const slot = iblock % 2 == 0 ? "_0" : "_1";
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto const &a = inputs[i];
+            int const n = a.nlead * nc * a.ntrail;
+            auto dev = ws.get(a.name + slot, n);
+            if (nblocks == 1) {
+                realHost1d(a.name, a.p, n).deep_copy_to(dev);
+            } else {
+                auto host = ws.get_host(a.name + slot, n);
+                pack_columns(a, ncol, icol0, nc, host.data());
+                host.deep_copy_to(dev);
+            }
+            in[i] = dev.data();
+        }
+    };
+
+    std::vector<real*> in(inputs.size()), in_next(inputs.size()), out(outputs.size());
+    copy_in(0, in);
+    for (int iblock = 0; iblock < nblocks; iblock++) {
+        int const icol0 = iblock * chunk;
+        int const nc = std::min(chunk, ncol - icol0);
+        for (size_t i = 0; i < outputs.size(); i++) {
+            auto const &a = outputs[i];
+            out[i] = a.p == nullptr ? nullptr : ws.get(a.name, a.nlead * nc * a.ntrail).data();
+        }
+
+        compute(nc, in, out);
+
+        if (iblock + 1 < nblocks) {
+            copy_in(iblock + 1, in_next);
+        }
+
+        for (size_t i = 0; i < outputs.size(); i++) {
+            auto const &a = outputs[i];
+            if (a.p == nullptr) { continue; }
+            int const n = a.nlead * nc * a.ntrail;
+            auto dev = real1d(a.name, out[i], n);
+            if (nblocks == 1) {
+                dev.deep_copy_to(realHost1d(a.name, a.p, n));
+            } else {
+                dev.deep_copy_to(ws.get_host(a.name, n));
+            }
+        }
+        yakl::fence();
+        if (nblocks > 1) {
+            for (auto const &a : outputs) {
+                if (a.p == nullptr) { continue; }
+                unpack_columns(a, ncol, icol0, nc, ws.get_host(a.name, a.nlead * nc * a.ntrail).data());
+            }
+        }
+        std::swap(in, in_next);
+    }
+}
+
+// Wrap a device pointer to a block output; outputs that were not selected
+// give an unallocated array, which the flux reductions in RTE skip.
+template <class... Dims>
+static Array<real,sizeof...(Dims),memDevice,styleFortran> wrap_output(char const *name, real *p, Dims... dims) {
+    if (p == nullptr) { return Array<real,sizeof...(Dims),memDevice,styleFortran>(); }
+    return Array<real,sizeof...(Dims),memDevice,styleFortran>(name, p, dims...);
+}
+
+// Compute SW fluxes for a block of ncol columns. in and out are device
+// pointers to the inputs and outputs of rrtmgp_run_sw, in the same order.
+static void run_sw_block(int ngas, int ncol, int nlay, bool top_at_1, double tsi_scaling, int output_mask,
+                         std::vector<real*> const &in, std::vector<real*> const &out) {
 
-    // Wrap pointers in YAKL arrays
     int nswbands = k_dist_sw.get_nband();
     int nswgpts  = k_dist_sw.get_ngpt();
-    auto gas_vmr_host                = realHost3d("gas_vmr", gas_vmr_p, ngas, ncol, nlay);
-    auto pmid_host                   = realHost2d("pmid", pmid_p, ncol, nlay);
-    auto tmid_host                   = realHost2d("tmid", tmid_p, ncol, nlay);
-    auto pint_host                   = realHost2d("pint", pint_p, ncol, nlay+1);
-    auto coszrs_host                 = realHost1d("coszrs", coszrs_p, ncol);
-    auto albedo_dir_host             = realHost2d("albedo_dir", albedo_dir_p, nswbands, ncol);
-    auto albedo_dif_host             = realHost2d("albedo_dif", albedo_dif_p, nswbands, ncol);
-    auto cld_tau_gpt_host            = realHost3d("cld_tau_gpt", cld_tau_gpt_p, ncol, nlay, nswgpts);
-    auto cld_ssa_gpt_host            = realHost3d("cld_ssa_gpt", cld_ssa_gpt_p, ncol, nlay, nswgpts);
-    auto cld_asm_gpt_host            = realHost3d("cld_asm_gpt", cld_asm_gpt_p, ncol, nlay, nswgpts);
-    auto aer_tau_bnd_host            = realHost3d("aer_tau_bnd", aer_tau_bnd_p, ncol, nlay, nswbands);
-    auto aer_ssa_bnd_host            = realHost3d("aer_ssa_bnd", aer_ssa_bnd_p, ncol, nlay, nswbands);
-    auto aer_asm_bnd_host            = realHost3d("aer_asm_bnd", aer_asm_bnd_p, ncol, nlay, nswbands);
-    auto allsky_flux_up_host         = realHost2d("allsky_flux_up", allsky_flux_up_p, ncol, nlay+1);
-    auto allsky_flux_dn_host         = realHost2d("allsky_flux_dn", allsky_flux_dn_p, ncol, nlay+1);
-    auto allsky_flux_dn_dir_host     = realHost2d("allsky_flux_dn_dir", allsky_flux_dn_dir_p, ncol, nlay+1);
-    auto allsky_flux_net_host        = realHost2d("allsky_flux_net", allsky_flux_net_p, ncol, nlay+1);
-    auto clrsky_flux_up_host         = realHost2d("clrsky_flux_up", clrsky_flux_up_p, ncol, nlay+1);
-    auto clrsky_flux_dn_host         = realHost2d("clrsky_flux_dn", clrsky_flux_dn_p, ncol, nlay+1);
-    auto clrsky_flux_dn_dir_host     = realHost2d("clrsky_flux_dn_dir", clrsky_flux_dn_dir_p, ncol, nlay+1);
-    auto clrsky_flux_net_host        = realHost2d("clrsky_flux_net", clrsky_flux_net_p, ncol, nlay+1);
-    auto allsky_bnd_flux_up_host     = realHost3d("allsky_bnd_flux_up", allsky_bnd_flux_up_p, ncol, nlay+1, nswbands);
-    auto allsky_bnd_flux_dn_host     = realHost3d("allsky_bnd_flux_dn", allsky_bnd_flux_dn_p, ncol, nlay+1, nswbands);
-    auto allsky_bnd_flux_dn_dir_host = realHost3d("allsky_bnd_flux_dn_dir", allsky_bnd_flux_dn_dir_p, ncol, nlay+1, nswbands);
-    auto allsky_bnd_flux_net_host    = realHost3d("allsky_bnd_flux_net", allsky_bnd_flux_net_p, ncol, nlay+1, nswbands);
-    auto clrsky_bnd_flux_up_host     = realHost3d("clrsky_bnd_flux_up", clrsky_bnd_flux_up_p, ncol, nlay+1, nswbands);
-    auto clrsky_bnd_flux_dn_host     = realHost3d("clrsky_bnd_flux_dn", clrsky_bnd_flux_dn_p, ncol, nlay+1, nswbands);
-    auto clrsky_bnd_flux_dn_dir_host = realHost3d("clrsky_bnd_flux_dn_dir", clrsky_bnd_flux_dn_dir_p, ncol, nlay+1, nswbands);
-    auto clrsky_bnd_flux_net_host    = realHost3d("clrsky_bnd_flux_net", clrsky_bnd_flux_net_p, ncol, nlay+1, nswbands);
-
-    real3d gas_vmr               ("gas_vmr", ngas, ncol, nlay);
-    real2d pmid                  ("pmid", ncol, nlay);
-    real2d tmid                  ("tmid", ncol, nlay);
-    real2d pint                  ("pint", ncol, nlay+1);
-    real1d coszrs                ("coszrs", ncol);
-    real2d albedo_dir            ("albedo_dir", nswbands, ncol);
-    real2d albedo_dif            ("albedo_dif", nswbands, ncol);
-    real3d cld_tau_gpt           ("cld_tau_gpt", ncol, nlay, nswgpts);
-    real3d cld_ssa_gpt           ("cld_ssa_gpt", ncol, nlay, nswgpts);
-    real3d cld_asm_gpt           ("cld_asm_gpt", ncol, nlay, nswgpts);
-    real3d aer_tau_bnd           ("aer_tau_bnd", ncol, nlay, nswbands);
-    real3d aer_ssa_bnd           ("aer_ssa_bnd", ncol, nlay, nswbands);
-    real3d aer_asm_bnd           ("aer_asm_bnd", ncol, nlay, nswbands);
-    real2d allsky_flux_up        ("allsky_flux_up", ncol, nlay+1);
-    real2d allsky_flux_dn        ("allsky_flux_dn", ncol, nlay+1);
-    real2d allsky_flux_dn_dir    ("allsky_flux_dn_dir", ncol, nlay+1);
-    real2d allsky_flux_net       ("allsky_flux_net", ncol, nlay+1);
-    real2d clrsky_flux_up        ("clrsky_flux_up", ncol, nlay+1);
-    real2d clrsky_flux_dn        ("clrsky_flux_dn", ncol, nlay+1);
-    real2d clrsky_flux_dn_dir    ("clrsky_flux_dn_dir", ncol, nlay+1);
-    real2d clrsky_flux_net       ("clrsky_flux_net", ncol, nlay+1);
-    real3d allsky_bnd_flux_up    ("allsky_bnd_flux_up", ncol, nlay+1, nswbands);
-    real3d allsky_bnd_flux_dn    ("allsky_bnd_flux_dn", ncol, nlay+1, nswbands);
-    real3d allsky_bnd_flux_dn_dir("allsky_bnd_flux_dn_dir", ncol, nlay+1, nswbands);
-    real3d allsky_bnd_flux_net   ("allsky_bnd_flux_net", ncol, nlay+1, nswbands);
-    real3d clrsky_bnd_flux_up    ("clrsky_bnd_flux_up", ncol, nlay+1, nswbands);
-    real3d clrsky_bnd_flux_dn    ("clrsky_bnd_flux_dn", ncol, nlay+1, nswbands);
-    real3d clrsky_bnd_flux_dn_dir("clrsky_bnd_flux_dn_dir", ncol, nlay+1, nswbands);
-    real3d clrsky_bnd_flux_net   ("clrsky_bnd_flux_net", ncol, nlay+1, nswbands);
-
-    // TODO: Only copy in the inputs
-    gas_vmr_host               .deep_copy_to(gas_vmr               );
-    pmid_host                  .deep_copy_to(pmid                  );
-    tmid_host                  .deep_copy_to(tmid                  );
-    pint_host                  .deep_copy_to(pint                  );
-    coszrs_host                .deep_copy_to(coszrs                );
-    albedo_dir_host            .deep_copy_to(albedo_dir            );
-    albedo_dif_host            .deep_copy_to(albedo_dif            );
-    cld_tau_gpt_host           .deep_copy_to(cld_tau_gpt           );
-    cld_ssa_gpt_host           .deep_copy_to(cld_ssa_gpt           );
-    cld_asm_gpt_host           .deep_copy_to(cld_asm_gpt           );
-    aer_tau_bnd_host           .deep_copy_to(aer_tau_bnd           );
-    aer_ssa_bnd_host           .deep_copy_to(aer_ssa_bnd           );
-    aer_asm_bnd_host           .deep_copy_to(aer_asm_bnd           );
-    //allsky_flux_up_host        .deep_copy_to(allsky_flux_up        );
-    //allsky_flux_dn_host        .deep_copy_to(allsky_flux_dn        );
-    //allsky_flux_dn_dir_host    .deep_copy_to(allsky_flux_dn_dir    );
-    //allsky_flux_net_host       .deep_copy_to(allsky_flux_net       );
-    //clrsky_flux_up_host        .deep_copy_to(clrsky_flux_up        );
-    //clrsky_flux_dn_host        .deep_copy_to(clrsky_flux_dn        );
-    //clrsky_flux_dn_dir_host    .deep_copy_to(clrsky_flux_dn_dir    );
-    //clrsky_flux_net_host       .deep_copy_to(clrsky_flux_net       );
-    //allsky_bnd_flux_up_host    .deep_copy_to(allsky_bnd_flux_up    );
-    //allsky_bnd_flux_dn_host    .deep_copy_to(allsky_bnd_flux_dn    );
-    //allsky_bnd_flux_dn_dir_host.deep_copy_to(allsky_bnd_flux_dn_dir);
-    //allsky_bnd_flux_net_host   .deep_copy_to(allsky_bnd_flux_net   );
-    //clrsky_bnd_flux_up_host    .deep_copy_to(clrsky_bnd_flux_up    );
-    //clrsky_bnd_flux_dn_host    .deep_copy_to(clrsky_bnd_flux_dn    );
-    //clrsky_bnd_flux_dn_dir_host.deep_copy_to(clrsky_bnd_flux_dn_dir);
-    //clrsky_bnd_flux_net_host   .deep_copy_to(clrsky_bnd_flux_net   );
-
+    auto gas_vmr                = real3d("gas_vmr", in[0], ngas, ncol, nlay);
+    auto pmid                   = real2d("pmid", in[1], ncol, nlay);
+    auto tmid                   = real2d("tmid", in[2], ncol, nlay);
+    auto pint                   = real2d("pint", in[3], ncol, nlay+1);
+    auto coszrs                 = real1d("coszrs", in[4], ncol);
+    auto albedo_dir             = real2d("albedo_dir", in[5], nswbands, ncol);
+    auto albedo_dif             = real2d("albedo_dif", in[6], nswbands, ncol);
+    auto cld_tau_gpt            = real3d("cld_tau_gpt", in[7], ncol, nlay, nswgpts);
+    auto cld_ssa_gpt            = real3d("cld_ssa_gpt", in[8], ncol, nlay, nswgpts);
+    auto cld_asm_gpt            = real3d("cld_asm_gpt", in[9], ncol, nlay, nswgpts);
+    auto aer_tau_bnd            = real3d("aer_tau_bnd", in[10], ncol, nlay, nswbands);
+    auto aer_ssa_bnd            = real3d("aer_ssa_bnd", in[11], ncol, nlay, nswbands);
+    auto aer_asm_bnd            = real3d("aer_asm_bnd", in[12], ncol, nlay, nswbands);
+    auto allsky_flux_up         = wrap_output("allsky_flux_up", out[0], ncol, nlay+1);
+    auto allsky_flux_dn         = wrap_output("allsky_flux_dn", out[1], ncol, nlay+1);
+    auto allsky_flux_net        = wrap_output("allsky_flux_net", out[2], ncol, nlay+1);
+    auto allsky_flux_dn_dir     = wrap_output("allsky_flux_dn_dir", out[3], ncol, nlay+1);
+    auto allsky_bnd_flux_up     = wrap_output("allsky_bnd_flux_up", out[4], ncol, nlay+1, nswbands);
+    auto allsky_bnd_flux_dn     = wrap_output("allsky_bnd_flux_dn", out[5], ncol, nlay+1, nswbands);
+    auto allsky_bnd_flux_net    = wrap_output("allsky_bnd_flux_net", out[6], ncol, nlay+1, nswbands);
+    auto allsky_bnd_flux_dn_dir = wrap_output("allsky_bnd_flux_dn_dir", out[7], ncol, nlay+1, nswbands);
+    auto clrsky_flux_up         = wrap_output("clrsky_flux_up", out[8], ncol, nlay+1);
+    auto clrsky_flux_dn         = wrap_output("clrsky_flux_dn", out[9], ncol, nlay+1);
+    auto clrsky_flux_net        = wrap_output("clrsky_flux_net", out[10], ncol, nlay+1);
+    auto clrsky_flux_dn_dir     = wrap_output("clrsky_flux_dn_dir", out[11], ncol, nlay+1);
+    auto clrsky_bnd_flux_up     = wrap_output("clrsky_bnd_flux_up", out[12], ncol, nlay+1, nswbands);
+    auto clrsky_bnd_flux_dn     = wrap_output("clrsky_bnd_flux_dn", out[13], ncol, nlay+1, nswbands);
+    auto clrsky_bnd_flux_net    = wrap_output("clrsky_bnd_flux_net", out[14], ncol, nlay+1, nswbands);
+    auto clrsky_bnd_flux_dn_dir = wrap_output("clrsky_bnd_flux_dn_dir", out[15], ncol, nlay+1, nswbands);
 
     // Populate gas concentrations object
-    GasConcs gas_concs;
-    gas_concs.init(active_gases, ncol, nlay);
-    real2d tmp2d;
-    tmp2d = real2d("tmp", ncol, nlay);
+    auto &ws = *workspace;
+    auto &gas_concs = ws.gas_concs;
+    gas_concs.ncol  = ncol;
+    gas_concs.nlay  = nlay;
+    gas_concs.concs = ws.get("gas_concs", ncol, nlay, ngas);
+    auto tmp2d = ws.get("tmp2d", ncol, nlay);
     for (int igas = 1; igas <= ngas; igas++) {
         parallel_for(Bounds<2>(nlay,ncol), YAKL_LAMBDA(int ilay, int icol) {
             tmp2d(icol,ilay) = gas_vmr(igas,icol,ilay);
@@ -238,11 +439,11 @@ extern "C" void rrtmgp_run_sw (
     }
 
     // Do gas optics
-    // TODO: should we avoid allocating here?
-    OpticalProps2str combined_optics;
-    combined_optics.alloc_2str(ncol, nlay, k_dist_sw);
-    bool top_at_1 = pmid_host(1, 1) < pmid_host (1, 2);
-    real2d toa_flux("toa_flux", ncol, nswgpts);
+    auto &combined_optics = ws.sw_combined_optics;
+    combined_optics.tau = ws.get("combined_tau", ncol, nlay, nswgpts);
+    combined_optics.ssa = ws.get("combined_ssa", ncol, nlay, nswgpts);
+    combined_optics.g   = ws.get("combined_g"  , ncol, nlay, nswgpts);
+    auto toa_flux = ws.get("toa_flux", ncol, nswgpts);
     k_dist_sw.gas_optics(ncol, nlay, top_at_1, pmid, pint, tmid, gas_concs, combined_optics, toa_flux);
 
     // Apply TOA flux scaling
@@ -250,56 +451,45 @@ extern "C" void rrtmgp_run_sw (
         toa_flux(icol, igpt) = tsi_scaling * toa_flux(icol, igpt);
     });
 
-    // Add in aerosol
-    // TODO: should we avoid allocating here?
-    OpticalProps2str aerosol_optics;
+    // Add in aerosol, mapped from bands to gpoints
+    auto &aerosol_optics = ws.sw_aerosol_optics;
+    aerosol_optics.tau = ws.get("aerosol_tau", ncol, nlay, nswgpts);
+    aerosol_optics.ssa = ws.get("aerosol_ssa", ncol, nlay, nswgpts);
+    aerosol_optics.g   = ws.get("aerosol_g"  , ncol, nlay, nswgpts);
     auto &aerosol_optics_tau = aerosol_optics.tau;
     auto &aerosol_optics_ssa = aerosol_optics.ssa;
     auto &aerosol_optics_g   = aerosol_optics.g  ;
-    if (true) {
-        aerosol_optics.alloc_2str(ncol, nlay, k_dist_sw);
-        auto gpt_bnd = aerosol_optics.get_gpoint_bands();
-        parallel_for(Bounds<3>(nswgpts,nlay,ncol) , YAKL_LAMBDA (int igpt, int ilay, int icol) {
-            aerosol_optics_tau(icol,ilay,igpt) = aer_tau_bnd(icol,ilay,gpt_bnd(igpt));
-            aerosol_optics_ssa(icol,ilay,igpt) = aer_ssa_bnd(icol,ilay,gpt_bnd(igpt));
-            aerosol_optics_g  (icol,ilay,igpt) = aer_asm_bnd(icol,ilay,gpt_bnd(igpt));
-        });
-    } else {
-        aerosol_optics.alloc_2str(ncol, nlay, k_dist_sw.get_band_lims_wavenumber());
-        parallel_for(Bounds<3>(nswbands,nlay,ncol), YAKL_LAMBDA (int ibnd, int ilay, int icol) {
-            aerosol_optics_tau(icol,ilay,ibnd) = aer_tau_bnd(icol,ilay,ibnd);
-            aerosol_optics_ssa(icol,ilay,ibnd) = aer_ssa_bnd(icol,ilay,ibnd);
-            aerosol_optics_g  (icol,ilay,ibnd) = aer_asm_bnd(icol,ilay,ibnd);
-        });
-    }
+    auto gpt_bnd = aerosol_optics.get_gpoint_bands();
+    parallel_for(Bounds<3>(nswgpts,nlay,ncol) , YAKL_LAMBDA (int igpt, int ilay, int icol) {
+        aerosol_optics_tau(icol,ilay,igpt) = aer_tau_bnd(icol,ilay,gpt_bnd(igpt));
+        aerosol_optics_ssa(icol,ilay,igpt) = aer_ssa_bnd(icol,ilay,gpt_bnd(igpt));
+        aerosol_optics_g  (icol,ilay,igpt) = aer_asm_bnd(icol,ilay,gpt_bnd(igpt));
+    });
     aerosol_optics.delta_scale();
     aerosol_optics.increment(combined_optics);
 
-    // Do the clearsky calculation before adding in clouds
-    FluxesByband fluxes_clrsky;
-    fluxes_clrsky.flux_up = real2d("clrsky_flux_up", ncol, nlay+1); // clrsky_flux_up;
-    fluxes_clrsky.flux_dn = real2d("clrsky_flux_up", ncol, nlay+1); //clrsky_flux_dn;
-    fluxes_clrsky.flux_dn_dir = real2d("clrsky_flux_up", ncol, nlay+1); //clrsky_flux_dn_dir;
-    fluxes_clrsky.flux_net = real2d("clrsky_flux_up", ncol, nlay+1); //clrsky_flux_net;
-    fluxes_clrsky.bnd_flux_up = real3d("clrsky_flux_up", ncol, nlay+1, nswbands); //clrsky_bnd_flux_up;
-    fluxes_clrsky.bnd_flux_dn = real3d("clrsky_flux_up", ncol, nlay+1, nswbands); //clrsky_bnd_flux_dn;
-    fluxes_clrsky.bnd_flux_dn_dir = real3d("clrsky_flux_up", ncol, nlay+1, nswbands); //clrsky_bnd_flux_dn_dir;
-    fluxes_clrsky.bnd_flux_net = real3d("clrsky_flux_up", ncol, nlay+1, nswbands); //clrsky_bnd_flux_net;
-    rte_sw(combined_optics, top_at_1, coszrs, toa_flux, albedo_dir, albedo_dif, fluxes_clrsky);
-
-    // Copy fluxes back out of FluxesByband object
-    fluxes_clrsky.flux_up.deep_copy_to(clrsky_flux_up);
-    fluxes_clrsky.flux_dn.deep_copy_to(clrsky_flux_dn);
-    fluxes_clrsky.flux_dn_dir.deep_copy_to(clrsky_flux_dn_dir);
-    fluxes_clrsky.flux_net.deep_copy_to(clrsky_flux_net);
-    fluxes_clrsky.bnd_flux_up.deep_copy_to(clrsky_bnd_flux_up);
-    fluxes_clrsky.bnd_flux_dn.deep_copy_to(clrsky_bnd_flux_dn);
-    fluxes_clrsky.bnd_flux_dn_dir.deep_copy_to(clrsky_bnd_flux_dn_dir);
-    fluxes_clrsky.bnd_flux_net.deep_copy_to(clrsky_bnd_flux_net);
+    // Do the clearsky calculation, if requested, before adding in clouds;
+    // clouds are added to the same optics, so gas and aerosol optics are
+    // shared by both passes. Fluxes are computed directly into the workspace
+    // output arrays.
+    if (output_mask & OUTPUT_CLRSKY) {
+        FluxesByband fluxes_clrsky;
+        fluxes_clrsky.flux_up = clrsky_flux_up;
+        fluxes_clrsky.flux_dn = clrsky_flux_dn;
+        fluxes_clrsky.flux_dn_dir = clrsky_flux_dn_dir;
+        fluxes_clrsky.flux_net = clrsky_flux_net;
+        fluxes_clrsky.bnd_flux_up = clrsky_bnd_flux_up;
+        fluxes_clrsky.bnd_flux_dn = clrsky_bnd_flux_dn;
+        fluxes_clrsky.bnd_flux_dn_dir = clrsky_bnd_flux_dn_dir;
+        fluxes_clrsky.bnd_flux_net = clrsky_bnd_flux_net;
+        rte_sw(combined_optics, top_at_1, coszrs, toa_flux, albedo_dir, albedo_dif, fluxes_clrsky);
+    }
 
     // Add in clouds
-    OpticalProps2str cloud_optics;
-    cloud_optics.alloc_2str(ncol, nlay, k_dist_sw);
+    auto &cloud_optics = ws.sw_cloud_optics;
+    cloud_optics.tau = ws.get("cloud_tau", ncol, nlay, nswgpts);
+    cloud_optics.ssa = ws.get("cloud_ssa", ncol, nlay, nswgpts);
+    cloud_optics.g   = ws.get("cloud_g"  , ncol, nlay, nswgpts);
     auto &cloud_optics_tau = cloud_optics.tau;
     auto &cloud_optics_ssa = cloud_optics.ssa;
     auto &cloud_optics_g   = cloud_optics.g  ;
@@ -313,144 +503,121 @@ extern "C" void rrtmgp_run_sw (
 
     // Call SW flux driver
     FluxesByband fluxes_allsky;
-    fluxes_allsky.flux_up = real2d("allsky_flux_up", ncol, nlay+1); // allsky_flux_up;
-    fluxes_allsky.flux_dn = real2d("allsky_flux_up", ncol, nlay+1); //allsky_flux_dn;
-    fluxes_allsky.flux_dn_dir = real2d("allsky_flux_up", ncol, nlay+1); //allsky_flux_dn_dir;
-    fluxes_allsky.flux_net = real2d("allsky_flux_up", ncol, nlay+1); //allsky_flux_net;
-    fluxes_allsky.bnd_flux_up = real3d("allsky_flux_up", ncol, nlay+1, nswbands); //allsky_bnd_flux_up;
-    fluxes_allsky.bnd_flux_dn = real3d("allsky_flux_up", ncol, nlay+1, nswbands); //allsky_bnd_flux_dn;
-    fluxes_allsky.bnd_flux_dn_dir = real3d("allsky_flux_up", ncol, nlay+1, nswbands); //allsky_bnd_flux_dn_dir;
-    fluxes_allsky.bnd_flux_net = real3d("allsky_flux_up", ncol, nlay+1, nswbands); //allsky_bnd_flux_net;
+    fluxes_allsky.flux_up = allsky_flux_up;
+    fluxes_allsky.flux_dn = allsky_flux_dn;
+    fluxes_allsky.flux_dn_dir = allsky_flux_dn_dir;
+    fluxes_allsky.flux_net = allsky_flux_net;
+    fluxes_allsky.bnd_flux_up = allsky_bnd_flux_up;
+    fluxes_allsky.bnd_flux_dn = allsky_bnd_flux_dn;
+    fluxes_allsky.bnd_flux_dn_dir = allsky_bnd_flux_dn_dir;
+    fluxes_allsky.bnd_flux_net = allsky_bnd_flux_net;
     rte_sw(combined_optics, top_at_1, coszrs, toa_flux, albedo_dir, albedo_dif, fluxes_allsky);
+}
 
-    // Copy fluxes back out of FluxesByband object
-    fluxes_allsky.flux_up.deep_copy_to(allsky_flux_up);
-    fluxes_allsky.flux_dn.deep_copy_to(allsky_flux_dn);
-    fluxes_allsky.flux_dn_dir.deep_copy_to(allsky_flux_dn_dir);
-    fluxes_allsky.flux_net.deep_copy_to(allsky_flux_net);
-    fluxes_allsky.bnd_flux_up.deep_copy_to(allsky_bnd_flux_up);
-    fluxes_allsky.bnd_flux_dn.deep_copy_to(allsky_bnd_flux_dn);
-    fluxes_allsky.bnd_flux_dn_dir.deep_copy_to(allsky_bnd_flux_dn_dir);
-    fluxes_allsky.bnd_flux_net.deep_copy_to(allsky_bnd_flux_net);
-
-    // TODO: Only copy out the outputs
-    //gas_vmr               .deep_copy_to(gas_vmr_host               );
-    //pmid                  .deep_copy_to(pmid_host                  );
-    //tmid                  .deep_copy_to(tmid_host                  );
-    //pint                  .deep_copy_to(pint_host                  );
-    //coszrs                .deep_copy_to(coszrs_host                );
-    //albedo_dir            .deep_copy_to(albedo_dir_host            );
-    //albedo_dif            .deep_copy_to(albedo_dif_host            );
-    //cld_tau_gpt           .deep_copy_to(cld_tau_gpt_host           );
-    //cld_ssa_gpt           .deep_copy_to(cld_ssa_gpt_host           );
-    //cld_asm_gpt           .deep_copy_to(cld_asm_gpt_host           );
-    //aer_tau_bnd           .deep_copy_to(aer_tau_bnd_host           );
-    //aer_ssa_bnd           .deep_copy_to(aer_ssa_bnd_host           );
-    //aer_asm_bnd           .deep_copy_to(aer_asm_bnd_host           );
-    allsky_flux_up        .deep_copy_to(allsky_flux_up_host        );
-    allsky_flux_dn        .deep_copy_to(allsky_flux_dn_host        );
-    allsky_flux_dn_dir    .deep_copy_to(allsky_flux_dn_dir_host    );
-    allsky_flux_net       .deep_copy_to(allsky_flux_net_host       );
-    clrsky_flux_up        .deep_copy_to(clrsky_flux_up_host        );
-    clrsky_flux_dn        .deep_copy_to(clrsky_flux_dn_host        );
-    clrsky_flux_dn_dir    .deep_copy_to(clrsky_flux_dn_dir_host    );
-    clrsky_flux_net       .deep_copy_to(clrsky_flux_net_host       );
-    allsky_bnd_flux_up    .deep_copy_to(allsky_bnd_flux_up_host    );
-    allsky_bnd_flux_dn    .deep_copy_to(allsky_bnd_flux_dn_host    );
-    allsky_bnd_flux_dn_dir.deep_copy_to(allsky_bnd_flux_dn_dir_host);
-    allsky_bnd_flux_net   .deep_copy_to(allsky_bnd_flux_net_host   );
-    clrsky_bnd_flux_up    .deep_copy_to(clrsky_bnd_flux_up_host    );
-    clrsky_bnd_flux_dn    .deep_copy_to(clrsky_bnd_flux_dn_host    );
-    clrsky_bnd_flux_dn_dir.deep_copy_to(clrsky_bnd_flux_dn_dir_host);
-    clrsky_bnd_flux_net   .deep_copy_to(clrsky_bnd_flux_net_host   );
-    yakl::fence();
+extern "C" void rrtmgp_run_sw (
+        int ngas, int ncol, int nlay,
+        double *gas_vmr_p, double *pmid_p      , double *tmid_p      , double *pint_p,
+        double *coszrs_p , double *albedo_dir_p, double *albedo_dif_p,
+        double *cld_tau_gpt_p, double *cld_ssa_gpt_p, double *cld_asm_gpt_p,
+        double *aer_tau_bnd_p, double *aer_ssa_bnd_p, double *aer_asm_bnd_p,
+        double *allsky_flux_up_p    , double *allsky_flux_dn_p    , double *allsky_flux_net_p    , double *allsky_flux_dn_dir_p,
+        double *allsky_bnd_flux_up_p, double *allsky_bnd_flux_dn_p, double *allsky_bnd_flux_net_p, double *allsky_bnd_flux_dn_dir_p,
+        double *clrsky_flux_up_p    , double *clrsky_flux_dn_p    , double *clrsky_flux_net_p    , double *clrsky_flux_dn_dir_p,
+        double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p, double *clrsky_bnd_flux_dn_dir_p,
+        double tsi_scaling, int output_mask
+        ) {
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Describe the host arrays by the dimensions around the column index
+    int nswbands = k_dist_sw.get_nband();
+    int nswgpts  = k_dist_sw.get_ngpt();
+    std::vector<ColumnArray> inputs = {
+        {"gas_vmr"    , gas_vmr_p    , ngas    , nlay        },
+        {"pmid"       , pmid_p       , 1       , nlay        },
+        {"tmid"       , tmid_p       , 1       , nlay        },
+        {"pint"       , pint_p       , 1       , nlay+1      },
+        {"coszrs"     , coszrs_p     , 1       , 1           },
+        {"albedo_dir" , albedo_dir_p , nswbands, 1           },
+        {"albedo_dif" , albedo_dif_p , nswbands, 1           },
+        {"cld_tau_gpt", cld_tau_gpt_p, 1       , nlay*nswgpts},
+        {"cld_ssa_gpt", cld_ssa_gpt_p, 1       , nlay*nswgpts},
+        {"cld_asm_gpt", cld_asm_gpt_p, 1       , nlay*nswgpts},
+        {"aer_tau_bnd", aer_tau_bnd_p, 1       , nlay*nswbands},
+        {"aer_ssa_bnd", aer_ssa_bnd_p, 1       , nlay*nswbands},
+        {"aer_asm_bnd", aer_asm_bnd_p, 1       , nlay*nswbands},
+    };
+    // Outputs that were not selected get a null pointer, so that they are
+    // neither computed nor copied back
+    bool const clrsky     = (output_mask & OUTPUT_CLRSKY) != 0;
+    bool const allsky_bnd = (output_mask & OUTPUT_ALLSKY_BND) != 0;
+    bool const clrsky_bnd = clrsky && (output_mask & OUTPUT_CLRSKY_BND) != 0;
+    auto select = [] (bool selected, double *p) { return selected ? p : nullptr; };
+    std::vector<ColumnArray> outputs = {
+        {"allsky_flux_up"        , allsky_flux_up_p                            , 1, nlay+1           },
+        {"allsky_flux_dn"        , allsky_flux_dn_p                            , 1, nlay+1           },
+        {"allsky_flux_net"       , allsky_flux_net_p                           , 1, nlay+1           },
+        {"allsky_flux_dn_dir"    , allsky_flux_dn_dir_p                        , 1, nlay+1           },
+        {"allsky_bnd_flux_up"    , select(allsky_bnd, allsky_bnd_flux_up_p)    , 1, (nlay+1)*nswbands},
+        {"allsky_bnd_flux_dn"    , select(allsky_bnd, allsky_bnd_flux_dn_p)    , 1, (nlay+1)*nswbands},
+        {"allsky_bnd_flux_net"   , select(allsky_bnd, allsky_bnd_flux_net_p)   , 1, (nlay+1)*nswbands},
+        {"allsky_bnd_flux_dn_dir", select(allsky_bnd, allsky_bnd_flux_dn_dir_p), 1, (nlay+1)*nswbands},
+        {"clrsky_flux_up"        , select(clrsky, clrsky_flux_up_p)            , 1, nlay+1           },
+        {"clrsky_flux_dn"        , select(clrsky, clrsky_flux_dn_p)            , 1, nlay+1           },
+        {"clrsky_flux_net"       , select(clrsky, clrsky_flux_net_p)           , 1, nlay+1           },
+        {"clrsky_flux_dn_dir"    , select(clrsky, clrsky_flux_dn_dir_p)        , 1, nlay+1           },
+        {"clrsky_bnd_flux_up"    , select(clrsky_bnd, clrsky_bnd_flux_up_p)    , 1, (nlay+1)*nswbands},
+        {"clrsky_bnd_flux_dn"    , select(clrsky_bnd, clrsky_bnd_flux_dn_p)    , 1, (nlay+1)*nswbands},
+        {"clrsky_bnd_flux_net"   , select(clrsky_bnd, clrsky_bnd_flux_net_p)   , 1, (nlay+1)*nswbands},
+        {"clrsky_bnd_flux_dn_dir", select(clrsky_bnd, clrsky_bnd_flux_dn_dir_p), 1, (nlay+1)*nswbands},
+    };
+
+    // Vertical ordering is the same for all columns: pmid(1,1) < pmid(1,2)
+    bool top_at_1 = pmid_p[0] < pmid_p[ncol];
+
+    run_column_blocks(ncol, inputs, outputs, [&] (int nc, std::vector<real*> const &in, std::vector<real*> const &out) {
+        run_sw_block(ngas, nc, nlay, top_at_1, tsi_scaling, output_mask, in, out);
+    });
 
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    workspace->sw_stats[output_mask].add(ncol, elapsed.count());
 } 
 
-extern "C" void rrtmgp_run_lw (
-        int ngas, int ncol, int nlay,
-        double *gas_vmr_p           , 
-        double *pmid_p              , double *tmid_p              , double *pint_p               , double *tint_p,
-        double *emis_sfc_p          ,
-        double *cld_tau_gpt_p       , double *aer_tau_bnd_p       ,
-        double *allsky_flux_up_p    , double *allsky_flux_dn_p    , double *allsky_flux_net_p    ,
-        double *allsky_bnd_flux_up_p, double *allsky_bnd_flux_dn_p, double *allsky_bnd_flux_net_p,
-        double *clrsky_flux_up_p    , double *clrsky_flux_dn_p    , double *clrsky_flux_net_p    ,
-        double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p
-        ) {
+// Compute LW fluxes for a block of ncol columns. in and out are device
+// pointers to the inputs and outputs of rrtmgp_run_lw, in the same order.
+static void run_lw_block(int ngas, int ncol, int nlay, bool top_at_1, int output_mask,
+                         std::vector<real*> const &in, std::vector<real*> const &out) {
 
-    // Wrap pointers in YAKL arrays
     int nlwbands = k_dist_lw.get_nband();
     int nlwgpts  = k_dist_lw.get_ngpt();
-    auto gas_vmr_host             = realHost3d("gas_vmr", gas_vmr_p, ngas, ncol, nlay);
-    auto pmid_host                = realHost2d("pmid", pmid_p, ncol, nlay);
-    auto tmid_host                = realHost2d("tmid", tmid_p, ncol, nlay);
-    auto pint_host                = realHost2d("pint", pint_p, ncol, nlay+1);
-    auto tint_host                = realHost2d("tint", tint_p, ncol, nlay+1);
-    auto emis_sfc_host            = realHost2d("emis_sfc", emis_sfc_p, nlwbands, ncol);
-    auto cld_tau_gpt_host         = realHost3d("cld_tau_gpt", cld_tau_gpt_p, ncol, nlay, nlwgpts);
-    auto aer_tau_bnd_host         = realHost3d("aer_tau_bnd", aer_tau_bnd_p, ncol, nlay, nlwbands);
-    auto allsky_flux_up_host      = realHost2d("allsky_flux_up", allsky_flux_up_p, ncol, nlay+1);
-    auto allsky_flux_dn_host      = realHost2d("allsky_flux_dn", allsky_flux_dn_p, ncol, nlay+1);
-    auto allsky_flux_net_host     = realHost2d("allsky_flux_net", allsky_flux_net_p, ncol, nlay+1);
-    auto clrsky_flux_up_host      = realHost2d("clrsky_flux_up", clrsky_flux_up_p, ncol, nlay+1);
-    auto clrsky_flux_dn_host      = realHost2d("clrsky_flux_dn", clrsky_flux_dn_p, ncol, nlay+1);
-    auto clrsky_flux_net_host     = realHost2d("clrsky_flux_net", clrsky_flux_net_p, ncol, nlay+1);
-    auto allsky_bnd_flux_up_host  = realHost3d("allsky_bnd_flux_up", allsky_bnd_flux_up_p, ncol, nlay+1, nlwbands);
-    auto allsky_bnd_flux_dn_host  = realHost3d("allsky_bnd_flux_dn", allsky_bnd_flux_dn_p, ncol, nlay+1, nlwbands);
-    auto allsky_bnd_flux_net_host = realHost3d("allsky_bnd_flux_net", allsky_bnd_flux_net_p, ncol, nlay+1, nlwbands);
-    auto clrsky_bnd_flux_up_host  = realHost3d("clrsky_bnd_flux_up", clrsky_bnd_flux_up_p, ncol, nlay+1, nlwbands);
-    auto clrsky_bnd_flux_dn_host  = realHost3d("clrsky_bnd_flux_dn", clrsky_bnd_flux_dn_p, ncol, nlay+1, nlwbands);
-    auto clrsky_bnd_flux_net_host = realHost3d("clrsky_bnd_flux_net", clrsky_bnd_flux_net_p, ncol, nlay+1, nlwbands);
-
-    real3d gas_vmr            ("gas_vmr", ngas, ncol, nlay);
-    real2d pmid               ("pmid", ncol, nlay);
-    real2d tmid               ("tmid", ncol, nlay);
-    real2d pint               ("pint", ncol, nlay+1);
-    real2d tint               ("tint", ncol, nlay+1);
-    real2d emis_sfc           ("emis_sfc", nlwbands, ncol);
-    real3d cld_tau_gpt        ("cld_tau_gpt", ncol, nlay, nlwgpts);
-    real3d aer_tau_bnd        ("aer_tau_bnd", ncol, nlay, nlwbands);
-    real2d allsky_flux_up     ("allsky_flux_up", ncol, nlay+1);
-    real2d allsky_flux_dn     ("allsky_flux_dn", ncol, nlay+1);
-    real2d allsky_flux_net    ("allsky_flux_net", ncol, nlay+1);
-    real2d clrsky_flux_up     ("clrsky_flux_up", ncol, nlay+1);
-    real2d clrsky_flux_dn     ("clrsky_flux_dn", ncol, nlay+1);
-    real2d clrsky_flux_net    ("clrsky_flux_net", ncol, nlay+1);
-    real3d allsky_bnd_flux_up ("allsky_bnd_flux_up", ncol, nlay+1, nlwbands);
-    real3d allsky_bnd_flux_dn ("allsky_bnd_flux_dn", ncol, nlay+1, nlwbands);
-    real3d allsky_bnd_flux_net("allsky_bnd_flux_net", ncol, nlay+1, nlwbands);
-    real3d clrsky_bnd_flux_up ("clrsky_bnd_flux_up", ncol, nlay+1, nlwbands);
-    real3d clrsky_bnd_flux_dn ("clrsky_bnd_flux_dn", ncol, nlay+1, nlwbands);
-    real3d clrsky_bnd_flux_net("clrsky_bnd_flux_net", ncol, nlay+1, nlwbands);
-
-    // TODO: Only copy in the inputs
-    gas_vmr_host            .deep_copy_to(gas_vmr            );
-    pmid_host               .deep_copy_to(pmid               );
-    tmid_host               .deep_copy_to(tmid               );
-    pint_host               .deep_copy_to(pint               );
-    tint_host               .deep_copy_to(tint               );
-    emis_sfc_host           .deep_copy_to(emis_sfc           );
-    cld_tau_gpt_host        .deep_copy_to(cld_tau_gpt        );
-    aer_tau_bnd_host        .deep_copy_to(aer_tau_bnd        );
-    allsky_flux_up_host     .deep_copy_to(allsky_flux_up     );
-    allsky_flux_dn_host     .deep_copy_to(allsky_flux_dn     );
-    allsky_flux_net_host    .deep_copy_to(allsky_flux_net    );
-    clrsky_flux_up_host     .deep_copy_to(clrsky_flux_up     );
-    clrsky_flux_dn_host     .deep_copy_to(clrsky_flux_dn     );
-    clrsky_flux_net_host    .deep_copy_to(clrsky_flux_net    );
-    allsky_bnd_flux_up_host .deep_copy_to(allsky_bnd_flux_up );
-    allsky_bnd_flux_dn_host .deep_copy_to(allsky_bnd_flux_dn );
-    allsky_bnd_flux_net_host.deep_copy_to(allsky_bnd_flux_net);
-    clrsky_bnd_flux_up_host .deep_copy_to(clrsky_bnd_flux_up );
-    clrsky_bnd_flux_dn_host .deep_copy_to(clrsky_bnd_flux_dn );
-    clrsky_bnd_flux_net_host.deep_copy_to(clrsky_bnd_flux_net);
+    auto gas_vmr             = real3d("gas_vmr", in[0], ngas, ncol, nlay);
+    auto pmid                = real2d("pmid", in[1], ncol, nlay);
+    auto tmid                = real2d("tmid", in[2], ncol, nlay);
+    auto pint                = real2d("pint", in[3], ncol, nlay+1);
+    auto tint                = real2d("tint", in[4], ncol, nlay+1);
+    auto emis_sfc            = real2d("emis_sfc", in[5], nlwbands, ncol);
+    auto cld_tau_gpt         = real3d("cld_tau_gpt", in[6], ncol, nlay, nlwgpts);
+    auto aer_tau_bnd         = real3d("aer_tau_bnd", in[7], ncol, nlay, nlwbands);
+    auto allsky_flux_up      = wrap_output("allsky_flux_up", out[0], ncol, nlay+1);
+    auto allsky_flux_dn      = wrap_output("allsky_flux_dn", out[1], ncol, nlay+1);
+    auto allsky_flux_net     = wrap_output("allsky_flux_net", out[2], ncol, nlay+1);
+    auto allsky_bnd_flux_up  = wrap_output("allsky_bnd_flux_up", out[3], ncol, nlay+1, nlwbands);
+    auto allsky_bnd_flux_dn  = wrap_output("allsky_bnd_flux_dn", out[4], ncol, nlay+1, nlwbands);
+    auto allsky_bnd_flux_net = wrap_output("allsky_bnd_flux_net", out[5], ncol, nlay+1, nlwbands);
+    auto clrsky_flux_up      = wrap_output("clrsky_flux_up", out[6], ncol, nlay+1);
+    auto clrsky_flux_dn      = wrap_output("clrsky_flux_dn", out[7], ncol, nlay+1);
+    auto clrsky_flux_net     = wrap_output("clrsky_flux_net", out[8], ncol, nlay+1);
+    auto clrsky_bnd_flux_up  = wrap_output("clrsky_bnd_flux_up", out[9], ncol, nlay+1, nlwbands);
+    auto clrsky_bnd_flux_dn  = wrap_output("clrsky_bnd_flux_dn", out[10], ncol, nlay+1, nlwbands);
+    auto clrsky_bnd_flux_net = wrap_output("clrsky_bnd_flux_net", out[11], ncol, nlay+1, nlwbands);
 
     // Populate gas concentrations
-    GasConcs gas_concs;
-    gas_concs.init(active_gases, ncol, nlay);
-    real2d tmp2d;
-    tmp2d = real2d("tmp", ncol, nlay);
+    auto &ws = *workspace;
+    auto &gas_concs = ws.gas_concs;
+    gas_concs.ncol  = ncol;
+    gas_concs.nlay  = nlay;
+    gas_concs.concs = ws.get("gas_concs", ncol, nlay, ngas);
+    auto tmp2d = ws.get("tmp2d", ncol, nlay);
     for (int igas = 1; igas <= ngas; igas++) {
         parallel_for(Bounds<2>(nlay,ncol), YAKL_LAMBDA(int ilay, int icol) {
             tmp2d(icol,ilay) = gas_vmr(igas,icol,ilay);
@@ -459,80 +626,46 @@ extern "C" void rrtmgp_run_lw (
     }
 
     //  Boundary conditions
-    SourceFuncLW lw_sources;
-    lw_sources.alloc(ncol, nlay, k_dist_lw);
-
-    // Weights and angle secants for first order (k=1) Gaussian quadrature.
-    //   Values from Table 2, Clough et al, 1992, doi:10.1029/92JD01419
-    //   after Abramowitz & Stegun 1972, page 921
-    int constexpr max_gauss_pts = 4;
-    realHost2d gauss_Ds_host ("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
-    gauss_Ds_host(1,1) = 1.66_wp      ; gauss_Ds_host(2,1) =         0._wp; gauss_Ds_host(3,1) =         0._wp; gauss_Ds_host(4,1) =         0._wp;
-    gauss_Ds_host(1,2) = 1.18350343_wp; gauss_Ds_host(2,2) = 2.81649655_wp; gauss_Ds_host(3,2) =         0._wp; gauss_Ds_host(4,2) =         0._wp;
-    gauss_Ds_host(1,3) = 1.09719858_wp; gauss_Ds_host(2,3) = 1.69338507_wp; gauss_Ds_host(3,3) = 4.70941630_wp; gauss_Ds_host(4,3) =         0._wp;
-    gauss_Ds_host(1,4) = 1.06056257_wp; gauss_Ds_host(2,4) = 1.38282560_wp; gauss_Ds_host(3,4) = 2.40148179_wp; gauss_Ds_host(4,4) = 7.15513024_wp;
-
-    realHost2d gauss_wts_host("gauss_wts",max_gauss_pts,max_gauss_pts);
-    gauss_wts_host(1,1) = 0.5_wp         ; gauss_wts_host(2,1) = 0._wp          ; gauss_wts_host(3,1) = 0._wp          ; gauss_wts_host(4,1) = 0._wp          ;
-    gauss_wts_host(1,2) = 0.3180413817_wp; gauss_wts_host(2,2) = 0.1819586183_wp; gauss_wts_host(3,2) = 0._wp          ; gauss_wts_host(4,2) = 0._wp          ;
-    gauss_wts_host(1,3) = 0.2009319137_wp; gauss_wts_host(2,3) = 0.2292411064_wp; gauss_wts_host(3,3) = 0.0698269799_wp; gauss_wts_host(4,3) = 0._wp          ;
-    gauss_wts_host(1,4) = 0.1355069134_wp; gauss_wts_host(2,4) = 0.2034645680_wp; gauss_wts_host(3,4) = 0.1298475476_wp; gauss_wts_host(4,4) = 0.0311809710_wp;
-
-    real2d gauss_Ds ("gauss_Ds" ,max_gauss_pts,max_gauss_pts);
-    real2d gauss_wts("gauss_wts",max_gauss_pts,max_gauss_pts);
-    gauss_Ds_host .deep_copy_to(gauss_Ds );
-    gauss_wts_host.deep_copy_to(gauss_wts);
+    auto &lw_sources = ws.get_lw_sources(ncol, nlay);
 
     // Populate optical property objects
-    OpticalProps1scl combined_optics;
-    combined_optics.alloc_1scl(ncol, nlay, k_dist_lw);
-    bool top_at_1 = pmid_host(1, 1) < pmid_host (1, 2);
-    real1d t_sfc("t_sfc", ncol);
+    auto &combined_optics = ws.lw_combined_optics;
+    combined_optics.tau = ws.get("combined_tau", ncol, nlay, nlwgpts);
+    auto t_sfc = ws.get("t_sfc", ncol);
     parallel_for(Bounds<1>(ncol), YAKL_LAMBDA (int icol) {
         t_sfc(icol) = tint(icol,nlay+1);
     });
     k_dist_lw.gas_optics(ncol, nlay, top_at_1, pmid, pint, tmid, t_sfc, gas_concs, combined_optics, lw_sources, real2d(), tint);
 
-    // Add in aerosol; we can define this by bands or gpoints. If we define by
-    // bands, then internally when increment() is called it will map these to
-    // gpoints. Not sure if there is a beneift one way or another.
-    OpticalProps1scl aerosol_optics;
+    // Add in aerosol; we define this by bands, and internally when
+    // increment() is called it will map these to gpoints.
+    auto &aerosol_optics = ws.lw_aerosol_optics;
+    aerosol_optics.tau = ws.get("aerosol_tau", ncol, nlay, nlwbands);
     auto &aerosol_optics_tau = aerosol_optics.tau;
-    if (false) {
-        aerosol_optics.alloc_1scl(ncol, nlay, k_dist_lw);
-        auto gpt_bnd = aerosol_optics.get_gpoint_bands();
-        parallel_for(Bounds<3>(nlwgpts,nlay,ncol) , YAKL_LAMBDA (int igpt, int ilay, int icol) {
-            aerosol_optics_tau(icol,ilay,igpt) = aer_tau_bnd(icol,ilay,gpt_bnd(igpt));
-        });
-    } else {
-        aerosol_optics.alloc_1scl(ncol, nlay, k_dist_lw.get_band_lims_wavenumber());
-        parallel_for(Bounds<3>(nlwbands,nlay,ncol), YAKL_LAMBDA (int ibnd, int ilay, int icol) {
-            aerosol_optics_tau(icol,ilay,ibnd) = aer_tau_bnd(icol,ilay,ibnd);
-        });
-    }
+    parallel_for(Bounds<3>(nlwbands,nlay,ncol), YAKL_LAMBDA (int ibnd, int ilay, int icol) {
+        aerosol_optics_tau(icol,ilay,ibnd) = aer_tau_bnd(icol,ilay,ibnd);
+    });
     aerosol_optics.increment(combined_optics);
 
-    // Do the clearsky calculation before adding in clouds
-    FluxesByband fluxes_clrsky;
-    fluxes_clrsky.flux_up = real2d("clrsky_flux_up", ncol, nlay+1); // clrsky_flux_up;
-    fluxes_clrsky.flux_dn = real2d("clrsky_flux_up", ncol, nlay+1); //clrsky_flux_dn;
-    fluxes_clrsky.flux_net = real2d("clrsky_flux_up", ncol, nlay+1); //clrsky_flux_net;
-    fluxes_clrsky.bnd_flux_up = real3d("clrsky_flux_up", ncol, nlay+1, nlwbands); //clrsky_bnd_flux_up;
-    fluxes_clrsky.bnd_flux_dn = real3d("clrsky_flux_up", ncol, nlay+1, nlwbands); //clrsky_bnd_flux_dn;
-    fluxes_clrsky.bnd_flux_net = real3d("clrsky_flux_up", ncol, nlay+1, nlwbands); //clrsky_bnd_flux_net;
-    rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, combined_optics, top_at_1, lw_sources, emis_sfc, fluxes_clrsky);
-
-    // Copy fluxes back out of FluxesByband object
-    fluxes_clrsky.flux_up.deep_copy_to(clrsky_flux_up);
-    fluxes_clrsky.flux_dn.deep_copy_to(clrsky_flux_dn);
-    fluxes_clrsky.flux_net.deep_copy_to(clrsky_flux_net);
-    fluxes_clrsky.bnd_flux_up.deep_copy_to(clrsky_bnd_flux_up);
-    fluxes_clrsky.bnd_flux_dn.deep_copy_to(clrsky_bnd_flux_dn);
-    fluxes_clrsky.bnd_flux_net.deep_copy_to(clrsky_bnd_flux_net);
+    // Do the clearsky calculation, if requested, before adding in clouds;
+    // clouds are added to the same optics, so gas and aerosol optics are
+    // shared by both passes. Fluxes are computed directly into the workspace
+    // output arrays.
+    int constexpr max_gauss_pts = RadiationWorkspace::max_gauss_pts;
+    if (output_mask & OUTPUT_CLRSKY) {
+        FluxesByband fluxes_clrsky;
+        fluxes_clrsky.flux_up = clrsky_flux_up;
+        fluxes_clrsky.flux_dn = clrsky_flux_dn;
+        fluxes_clrsky.flux_net = clrsky_flux_net;
+        fluxes_clrsky.bnd_flux_up = clrsky_bnd_flux_up;
+        fluxes_clrsky.bnd_flux_dn = clrsky_bnd_flux_dn;
+        fluxes_clrsky.bnd_flux_net = clrsky_bnd_flux_net;
+        rte_lw(max_gauss_pts, ws.gauss_Ds, ws.gauss_wts, combined_optics, top_at_1, lw_sources, emis_sfc, fluxes_clrsky);
+    }
 
     // Add in clouds
-    OpticalProps1scl cloud_optics;
-    cloud_optics.alloc_1scl(ncol, nlay, k_dist_lw);
+    auto &cloud_optics = ws.lw_cloud_optics;
+    cloud_optics.tau = ws.get("cloud_tau", ncol, nlay, nlwgpts);
     auto &cloud_optics_tau = cloud_optics.tau;
     parallel_for(Bounds<3>(nlwgpts,nlay,ncol) , YAKL_LAMBDA (int igpt, int ilay, int icol) {
         cloud_optics_tau(icol,ilay,igpt) = cld_tau_gpt(icol,ilay,igpt);
@@ -541,43 +674,71 @@ extern "C" void rrtmgp_run_lw (
 
     // Call LW flux driver
     FluxesByband fluxes_allsky;
-    fluxes_allsky.flux_up = real2d("flux_up", ncol, nlay+1); //allsky_flux_up;
-    fluxes_allsky.flux_dn = real2d("flux_dn", ncol, nlay+1); //allsky_flux_dn;
-    fluxes_allsky.flux_net = real2d("flux_net", ncol, nlay+1); //allsky_flux_net;
-    fluxes_allsky.bnd_flux_up = real3d("flux_up", ncol, nlay+1, nlwbands); //allsky_bnd_flux_up;
-    fluxes_allsky.bnd_flux_dn = real3d("flux_dn", ncol, nlay+1, nlwbands); //allsky_bnd_flux_dn;
-    fluxes_allsky.bnd_flux_net = real3d("flux_net", ncol, nlay+1, nlwbands); //allsky_bnd_flux_net;
-    rte_lw(max_gauss_pts, gauss_Ds, gauss_wts, combined_optics, top_at_1, lw_sources, emis_sfc, fluxes_allsky);
-
-    // Copy fluxes back out of FluxesByband object
-    fluxes_allsky.flux_up.deep_copy_to(allsky_flux_up);
-    fluxes_allsky.flux_dn.deep_copy_to(allsky_flux_dn);
-    fluxes_allsky.flux_net.deep_copy_to(allsky_flux_net);
-    fluxes_allsky.bnd_flux_up.deep_copy_to(allsky_bnd_flux_up);
-    fluxes_allsky.bnd_flux_dn.deep_copy_to(allsky_bnd_flux_dn);
-    fluxes_allsky.bnd_flux_net.deep_copy_to(allsky_bnd_flux_net);
-
-    // TODO: Only copy out the outputs
-    gas_vmr            .deep_copy_to(gas_vmr_host            );
-    pmid               .deep_copy_to(pmid_host               );
-    tmid               .deep_copy_to(tmid_host               );
-    pint               .deep_copy_to(pint_host               );
-    tint               .deep_copy_to(tint_host               );
-    emis_sfc           .deep_copy_to(emis_sfc_host           );
-    cld_tau_gpt        .deep_copy_to(cld_tau_gpt_host        );
-    aer_tau_bnd        .deep_copy_to(aer_tau_bnd_host        );
-    allsky_flux_up     .deep_copy_to(allsky_flux_up_host     );
-    allsky_flux_dn     .deep_copy_to(allsky_flux_dn_host     );
-    allsky_flux_net    .deep_copy_to(allsky_flux_net_host    );
-    clrsky_flux_up     .deep_copy_to(clrsky_flux_up_host     );
-    clrsky_flux_dn     .deep_copy_to(clrsky_flux_dn_host     );
-    clrsky_flux_net    .deep_copy_to(clrsky_flux_net_host    );
-    allsky_bnd_flux_up .deep_copy_to(allsky_bnd_flux_up_host );
-    allsky_bnd_flux_dn .deep_copy_to(allsky_bnd_flux_dn_host );
-    allsky_bnd_flux_net.deep_copy_to(allsky_bnd_flux_net_host);
-    clrsky_bnd_flux_up .deep_copy_to(clrsky_bnd_flux_up_host );
-    clrsky_bnd_flux_dn .deep_copy_to(clrsky_bnd_flux_dn_host );
-    clrsky_bnd_flux_net.deep_copy_to(clrsky_bnd_flux_net_host);
-    yakl::fence();
+    fluxes_allsky.flux_up = allsky_flux_up;
+    fluxes_allsky.flux_dn = allsky_flux_dn;
+    fluxes_allsky.flux_net = allsky_flux_net;
+    fluxes_allsky.bnd_flux_up = allsky_bnd_flux_up;
+    fluxes_allsky.bnd_flux_dn = allsky_bnd_flux_dn;
+    fluxes_allsky.bnd_flux_net = allsky_bnd_flux_net;
+    rte_lw(max_gauss_pts, ws.gauss_Ds, ws.gauss_wts, combined_optics, top_at_1, lw_sources, emis_sfc, fluxes_allsky);
+}
+
+extern "C" void rrtmgp_run_lw (
+        int ngas, int ncol, int nlay,
+        double *gas_vmr_p           , 
+        double *pmid_p              , double *tmid_p              , double *pint_p               , double *tint_p,
+        double *emis_sfc_p          ,
+        double *cld_tau_gpt_p       , double *aer_tau_bnd_p       ,
+        double *allsky_flux_up_p    , double *allsky_flux_dn_p    , double *allsky_flux_net_p    ,
+        double *allsky_bnd_flux_up_p, double *allsky_bnd_flux_dn_p, double *allsky_bnd_flux_net_p,
+        double *clrsky_flux_up_p    , double *clrsky_flux_dn_p    , double *clrsky_flux_net_p    ,
+        double *clrsky_bnd_flux_up_p, double *clrsky_bnd_flux_dn_p, double *clrsky_bnd_flux_net_p,
+        int output_mask
+        ) {
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Describe the host arrays by the dimensions around the column index
+    int nlwbands = k_dist_lw.get_nband();
+    int nlwgpts  = k_dist_lw.get_ngpt();
+    std::vector<ColumnArray> inputs = {
+        {"gas_vmr"    , gas_vmr_p    , ngas    , nlay         },
+        {"pmid"       , pmid_p       , 1       , nlay         },
+        {"tmid"       , tmid_p       , 1       , nlay         },
+        {"pint"       , pint_p       , 1       , nlay+1       },
+        {"tint"       , tint_p       , 1       , nlay+1       },
+        {"emis_sfc"   , emis_sfc_p   , nlwbands, 1            },
+        {"cld_tau_gpt", cld_tau_gpt_p, 1       , nlay*nlwgpts },
+        {"aer_tau_bnd", aer_tau_bnd_p, 1       , nlay*nlwbands},
+    };
+    // Outputs that were not selected get a null pointer, so that they are
+    // neither computed nor copied back
+    bool const clrsky     = (output_mask & OUTPUT_CLRSKY) != 0;
+    bool const allsky_bnd = (output_mask & OUTPUT_ALLSKY_BND) != 0;
+    bool const clrsky_bnd = clrsky && (output_mask & OUTPUT_CLRSKY_BND) != 0;
+    auto select = [] (bool selected, double *p) { return selected ? p : nullptr; };
+    std::vector<ColumnArray> outputs = {
+        {"allsky_flux_up"     , allsky_flux_up_p                         , 1, nlay+1           },
+        {"allsky_flux_dn"     , allsky_flux_dn_p                         , 1, nlay+1           },
+        {"allsky_flux_net"    , allsky_flux_net_p                        , 1, nlay+1           },
+        {"allsky_bnd_flux_up" , select(allsky_bnd, allsky_bnd_flux_up_p) , 1, (nlay+1)*nlwbands},
+        {"allsky_bnd_flux_dn" , select(allsky_bnd, allsky_bnd_flux_dn_p) , 1, (nlay+1)*nlwbands},
+        {"allsky_bnd_flux_net", select(allsky_bnd, allsky_bnd_flux_net_p), 1, (nlay+1)*nlwbands},
+        {"clrsky_flux_up"     , select(clrsky, clrsky_flux_up_p)         , 1, nlay+1           },
+        {"clrsky_flux_dn"     , select(clrsky, clrsky_flux_dn_p)         , 1, nlay+1           },
+        {"clrsky_flux_net"    , select(clrsky, clrsky_flux_net_p)        , 1, nlay+1           },
+        {"clrsky_bnd_flux_up" , select(clrsky_bnd, clrsky_bnd_flux_up_p) , 1, (nlay+1)*nlwbands},
+        {"clrsky_bnd_flux_dn" , select(clrsky_bnd, clrsky_bnd_flux_dn_p) , 1, (nlay+1)*nlwbands},
+        {"clrsky_bnd_flux_net", select(clrsky_bnd, clrsky_bnd_flux_net_p), 1, (nlay+1)*nlwbands},
+    };
+
+    // Vertical ordering is the same for all columns: pmid(1,1) < pmid(1,2)
+    bool top_at_1 = pmid_p[0] < pmid_p[ncol];
+
+    run_column_blocks(ncol, inputs, outputs, [&] (int nc, std::vector<real*> const &in, std::vector<real*> const &out) {
+        run_lw_block(ngas, nc, nlay, top_at_1, output_mask, in, out);
+    });
 
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    workspace->lw_stats[output_mask].add(ncol, elapsed.count());
 }
@@ -81,6 +81,9 @@ struct CaarFunctorImpl {
 
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
+  ProfilingTimer m_compute_timer {"caar compute"};
+  ProfilingTimer m_bexch_timer   {"caar_bexchV"};
+
   CaarFunctorImpl(const int num_elems, const SimulationParams& params)
     : m_num_elems(num_elems)
     , m_rsplit(params.rsplit)
@@ -212,14 +215,16 @@ struct CaarFunctorImpl {
     }
 
     profiling_resume();
-    GPTLstart("caar compute");
-    Kokkos::parallel_for("caar loop pre-boundary exchange", m_policy, *this);
-    ExecSpace::impl_static_fence();
-    GPTLstop("caar compute");
-
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    GPTLstop("caar_bexchV");
+    {
+      ScopedTimer timer(m_compute_timer);
+      Kokkos::parallel_for("caar loop pre-boundary exchange", m_policy, *this);
+      ExecSpace::impl_static_fence();
+    }
+
+    {
+      ScopedTimer timer(m_bexch_timer);
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+    }
 
     profiling_pause();
   }
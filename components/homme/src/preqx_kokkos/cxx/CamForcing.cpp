@@ -53,8 +53,7 @@ void tracer_forcing(
     const HybridVCoord &hvcoord, const TimeLevel &tl, const int &num_q,
     const MoistDry &moisture, const double &dt,
     const ExecViewManaged<Real * [NUM_TIME_LEVELS][NP][NP]> &ps_v,
-    const ExecViewManaged<
-        Scalar * [Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> &qdp,
+    const ExecViewManaged<Scalar ***[NP][NP][NUM_LEV]> &qdp,
     const ExecViewManaged<Scalar **[NP][NP][NUM_LEV]> &Q) {
 
   const int num_e = ps_v.extent_int(0);
@@ -147,7 +146,7 @@ void tracer_forcing(
 }
 
 void apply_cam_forcing(const Real &dt) {
-  GPTLstart("ApplyCAMForcing");
+  ScopedTimer timer("ApplyCAMForcing");
   const Elements &elems = Context::singleton().get<Elements>();
   const TimeLevel &tl = Context::singleton().get<TimeLevel>();
 
@@ -162,15 +161,13 @@ void apply_cam_forcing(const Real &dt) {
   }
   tracer_forcing(tracers.fq, hvcoord, tl, tracers.num_tracers(),
                  sim_params.moisture, dt, elems.m_state.m_ps_v, tracers.qdp, tracers.Q);
-  GPTLstop("ApplyCAMForcing");
 }
 
 void apply_cam_forcing_dynamics(const Real &dt) {
-  GPTLstart("ApplyCAMForcing_dynamics");
+  ScopedTimer timer("ApplyCAMForcing_dynamics");
   const Elements &elems = Context::singleton().get<Elements>();
   const TimeLevel &tl = Context::singleton().get<TimeLevel>();
   state_forcing(elems.m_forcing.m_ft, elems.m_forcing.m_fm, tl.n0, dt, elems.m_state.m_t, elems.m_state.m_v);
-  GPTLstop("ApplyCAMForcing_dynamics");
 }
 
 } // namespace Homme
@@ -128,18 +128,20 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   m_data.eta_ave_w = eta_ave_w;
 
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
-    GPTLstart("hvf-bhwk");
-    biharmonic_wk_dp3d ();
-    GPTLstop("hvf-bhwk");
+    {
+      ScopedTimer timer(m_bhwk_timer);
+      biharmonic_wk_dp3d ();
+    }
     // dispatch parallel_for for first kernel
     Kokkos::parallel_for(m_policy_pre_exchange, *this);
     Kokkos::fence();
 
     // Exchange
     assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    {
+      ScopedTimer timer(m_bexch_timer);
+      m_be->exchange();
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -157,9 +159,10 @@ void HyperviscosityFunctorImpl::biharmonic_wk_dp3d() const
 
   // Exchange
   assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  {
+    ScopedTimer timer(m_bexch_timer);
+    m_be->exchange(m_geometry.m_rspheremp);
+  }
 
   // TODO: update m_data.nu_ratio if nu_div!=nu
   // Compute second laplacian, tensor or const hv
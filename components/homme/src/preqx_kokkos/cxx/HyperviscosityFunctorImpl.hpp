@@ -14,6 +14,8 @@
 
 #include <memory>
 
+#include "profiling.hpp"
+
 namespace Homme
 {
 
@@ -309,6 +311,10 @@ private:
 
   std::shared_ptr<BoundaryExchange> m_be;
 
+  // Mutable, since biharmonic_wk_dp3d is const
+  mutable ProfilingTimer m_bhwk_timer  {"hvf-bhwk"};
+  mutable ProfilingTimer m_bexch_timer {"hvf-bexch"};
+
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
 };
 
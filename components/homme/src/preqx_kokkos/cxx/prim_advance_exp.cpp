@@ -24,7 +24,7 @@ void u3_5stage_timestep(const TimeLevel& tl, const Real dt, const Real eta_ave_w
 
 void prim_advance_exp (TimeLevel& tl, const Real dt, const bool compute_diagnostics)
 {
-  GPTLstart("tl-ae prim_advance_exp");
+  ScopedTimer timer("tl-ae prim_advance_exp");
   // Get simulation params
   SimulationParams& params = Context::singleton().get<SimulationParams>();
 
@@ -74,9 +74,8 @@ void prim_advance_exp (TimeLevel& tl, const Real dt, const bool compute_diagnost
   if (!is_implicit(params.time_step_type)) {
     // Get and run the HVF
     HyperviscosityFunctor& functor = Context::singleton().get<HyperviscosityFunctor>();
-    GPTLstart("tl-ae advance_hypervis_dp");
+    ScopedTimer timer_hv("tl-ae advance_hypervis_dp");
     functor.run(tl.np1,dt,eta_ave_w);
-    GPTLstop("tl-ae advance_hypervis_dp");
   }
 
 #ifdef ENERGY_DIAGNOSTICS
@@ -87,12 +86,11 @@ void prim_advance_exp (TimeLevel& tl, const Real dt, const bool compute_diagnost
 #else
   (void) compute_diagnostics;
 #endif
-  GPTLstop("tl-ae prim_advance_exp");
 }
 
 void u3_5stage_timestep(const TimeLevel& tl, const Real dt, const Real eta_ave_w)
 {
-  GPTLstart("tl-ae U3-5stage_timestep");
+  ScopedTimer timer("tl-ae U3-5stage_timestep");
   // Get elements structure
   Elements& elements = Context::singleton().get<Elements>();
 
@@ -137,7 +135,6 @@ void u3_5stage_timestep(const TimeLevel& tl, const Real dt, const Real eta_ave_w
 
   // Stage 5: u5 = (5u1-u0)/4 + 3dt/4 RHS(u4), t_rhs = t + dt/5 + dt/5 + dt/3 + 2dt/3
   functor.run(RKStageData(tl.nm1,tl.np1,tl.np1,tl.n0_qdp,3.0*dt/4.0,3.0*eta_ave_w/4.0));
-  GPTLstop("tl-ae U3-5stage_timestep");
 }
 
 } // namespace Homme
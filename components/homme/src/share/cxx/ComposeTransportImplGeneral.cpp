@@ -69,9 +69,9 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
                                 s.m_dp3d.data()),
         nel, (independent_time_steps ? 1 : NUM_TIME_LEVELS), np, np, nlev),
       homme::compose::SetView<Real******>(reinterpret_cast<Real*>(t.qdp.data()),
-                                          nel, Q_NUM_TIME_LEVELS, QSIZE_D, np, np, nlev),
+                                          nel, Q_NUM_TIME_LEVELS, t.qdp.extent_int(2), np, np, nlev),
       homme::compose::SetView<Real*****> (reinterpret_cast<Real*>(t.Q.data()),
-                                          nel, QSIZE_D, np, np, nlev),
+                                          nel, t.Q.extent_int(1), np, np, nlev),
       m_data.dep_pts);
   }
   m_data.independent_time_steps = independent_time_steps;
@@ -168,34 +168,37 @@ void ComposeTransportImpl::init_boundary_exchanges () {
 }
 
 void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
-  GPTLstart("compose_transport");
+  ScopedTimer timer("compose_transport");
 
   calc_trajectory(tl.np1, dt);
   
-  GPTLstart("compose_isl");
-  homme::compose::advect(tl.np1, tl.n0_qdp, tl.np1_qdp);
-  GPTLstop("compose_isl");
+  {
+    ScopedTimer timer_isl("compose_isl");
+    homme::compose::advect(tl.np1, tl.n0_qdp, tl.np1_qdp);
+  }
   
   if (m_data.hv_q > 0 && m_data.nu_q > 0) {
-    GPTLstart("compose_hypervis_scalar");
+    ScopedTimer timer_hv("compose_hypervis_scalar");
     advance_hypervis_scalar(dt);
     Kokkos::fence();
-    GPTLstop("compose_hypervis_scalar");
   }
   
-  GPTLstart("compose_cedr_global");
-  homme::compose::set_dp3d_np1(m_data.independent_time_steps ?
-                               0 : // dp3d is actually divdp
-                               tl.np1);
-  const auto run_cedr = homme::compose::property_preserve_global();
-  if (run_cedr) Kokkos::fence();
-  GPTLstop("compose_cedr_global");
-  GPTLstart("compose_cedr_local");
-  if (run_cedr) {
-    homme::compose::property_preserve_local(m_data.limiter_option);
-    Kokkos::fence();
+  bool run_cedr;
+  {
+    ScopedTimer timer_global("compose_cedr_global");
+    homme::compose::set_dp3d_np1(m_data.independent_time_steps ?
+                                 0 : // dp3d is actually divdp
+                                 tl.np1);
+    run_cedr = homme::compose::property_preserve_global();
+    if (run_cedr) Kokkos::fence();
+  }
+  {
+    ScopedTimer timer_local("compose_cedr_local");
+    if (run_cedr) {
+      homme::compose::property_preserve_local(m_data.limiter_option);
+      Kokkos::fence();
+    }
   }
-  GPTLstop("compose_cedr_local");    
 
   const auto np1 = tl.np1;
   const auto np1_qdp = tl.np1_qdp;
@@ -217,7 +220,7 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   }
   
   { // DSS qdp and omega
-    GPTLstart("compose_dss_q");
+    ScopedTimer timer_dss("compose_dss_q");
     const auto qdp = m_tracers.qdp;
     const auto spheremp = m_geometry.m_spheremp;
     const auto f1 = KOKKOS_LAMBDA (const int idx) {
@@ -235,17 +238,13 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
     launch_ie_ij_nlev<num_lev_pack>(f2);
     m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
     Kokkos::fence();
-    GPTLstop("compose_dss_q");
   }
   
   if (m_data.cdr_check) {
-    GPTLstart("compose_cedr_check");
+    ScopedTimer timer_check("compose_cedr_check");
     homme::compose::property_preserve_check();
     Kokkos::fence();
-    GPTLstop("compose_cedr_check");
   }
-  
-  GPTLstop("compose_transport");
 }
 
 } // namespace Homme
@@ -158,24 +158,25 @@ void ComposeTransportImpl::test_2d (const bool bfb, const int nstep, std::vector
 
   fill_ics(*this, tl.n0_qdp, tl.np1);
 
-  GPTLstart("compose_stt_step");
-  for (int i = 0; i < nstep; ++i) {
-    const auto tprev = dt*i;
-    const auto t = dt*(i+1);
-    if (i == 0) {
-      fill_v(*this, tprev, tl.np1, bfb);
+  {
+    ScopedTimer timer("compose_stt_step");
+    for (int i = 0; i < nstep; ++i) {
+      const auto tprev = dt*i;
+      const auto t = dt*(i+1);
+      if (i == 0) {
+        fill_v(*this, tprev, tl.np1, bfb);
+        Kokkos::fence();
+      }
+      cp_v_to_vstar(*this, tl.np1);
+      Kokkos::fence();
+      fill_v(*this, t, tl.np1, bfb);
+      Kokkos::fence();
+      run(tl, dt);
       Kokkos::fence();
+      tl.nstep += params.qsplit;
+      tl.update_tracers_levels(params.qsplit);
     }
-    cp_v_to_vstar(*this, tl.np1);
-    Kokkos::fence();
-    fill_v(*this, t, tl.np1, bfb);
-    Kokkos::fence();
-    run(tl, dt);
-    Kokkos::fence();
-    tl.nstep += params.qsplit;
-    tl.update_tracers_levels(params.qsplit);
   }
-  GPTLstop("compose_stt_step");
 
   finish(*this, Context::singleton().get<Comm>(), tl.n0_qdp, tl.np1, eval);
 }
@@ -38,7 +38,7 @@ void ComposeTransportImpl
 }
 
 void ComposeTransportImpl::remap_q (const TimeLevel& tl) {
-  GPTLstart("compose_vertical_remap");
+  ScopedTimer timer("compose_vertical_remap");
   const auto np1 = tl.np1;
   const auto np1_qdp = tl.np1_qdp;
   const auto dp = m_derived.m_divdp;
@@ -58,7 +58,6 @@ void ComposeTransportImpl::remap_q (const TimeLevel& tl) {
   Kokkos::fence();
   Kokkos::parallel_for(policy, post);
   Kokkos::fence();
-  GPTLstop("compose_vertical_remap");
 }
 
 } // namespace Homme
@@ -18,6 +18,7 @@
 #include "HybridVCoord.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "Tracers.hpp"
 #include "profiling.hpp"
 #include "mpi/BoundaryExchange.hpp"
@@ -112,6 +113,8 @@ class EulerStepFunctorImpl {
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, 3*Q_NUM_TIME_LEVELS> m_bes;
 
+  ProfilingTimer m_bexch_timer {"eus_bexch"};
+
   enum { m_mem_per_team = 2 * NP * NP * sizeof(Real) };
 
 public:
@@ -300,13 +303,15 @@ public:
     m_data.rhs_viss = 3.0;
 
     if(m_data.nu_p > 0){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    tuned_parallel_for("euler biharmonic pre nup",
+                       Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
+                         m_geometry.num_elems() * m_data.qsize, m_tpref),
+                       *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    tuned_parallel_for("euler biharmonic pre",
+                       Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
+                         m_geometry.num_elems() * m_data.qsize, m_tpref),
+                       *this);
 
     }
 
@@ -319,13 +324,15 @@ public:
     assert(m_data.rhs_multiplier == 2.0);
 
     if(m_data.consthv){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    tuned_parallel_for("euler biharmonic post const",
+                       Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
+                         m_geometry.num_elems() * m_data.qsize, m_tpref),
+                       *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    tuned_parallel_for("euler biharmonic post tensor",
+                       Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
+                         m_geometry.num_elems() * m_data.qsize, m_tpref),
+                       *this);
     }
     ExecSpace::impl_static_fence();
     profiling_pause();
@@ -416,13 +423,15 @@ public:
 
   void advect_and_limit() {
     profiling_resume();
-    Kokkos::parallel_for(
+    tuned_parallel_for(
+      "euler advect setup",
       Homme::get_default_team_policy<ExecSpace, AALSetupPhase>(
         m_geometry.num_elems(), m_tpref),
       *this);
     ExecSpace::impl_static_fence();
     m_kernel_will_run_limiters = true;
-    Kokkos::parallel_for(
+    tuned_parallel_for(
+      "euler advect and limit",
       Homme::get_default_team_policy<ExecSpace, AALTracerPhase>(
         m_geometry.num_elems() * m_data.qsize, m_tpref),
       *this);
@@ -598,10 +607,9 @@ public:
   }
 
   void exchange_qdp_dss_var () {
-    GPTLstart("eus_bexch");
+    ScopedTimer timer(m_bexch_timer);
     const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
     m_bes[idx]->exchange(m_geometry.m_rspheremp);
-    GPTLstop("eus_bexch");
   }
 
   void euler_step(const int np1_qdp, const int n0_qdp, const Real dt,
@@ -23,6 +23,7 @@
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/SyncUtils.hpp"
 #include "RemapStateProvider.hpp"
+#include "TeamPolicyTuner.hpp"
 
 #include "profiling.hpp"
 
@@ -283,7 +284,7 @@ struct RemapFunctor : public Remapper {
 
   const ElementsState m_state;
   const HybridVCoord m_hvcoord;
-  ExecViewManaged<Scalar*[Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> m_qdp;
+  ExecViewManaged<Scalar***[NP][NP][NUM_LEV]> m_qdp;
 
   ExecViewManaged<bool *> valid_layer_thickness;
   typename decltype(valid_layer_thickness)::HostMirror host_valid_input;
@@ -554,12 +555,11 @@ private:
   void run_functor(const std::string functor_name, int num_exec) {
     const auto policy = remap_team_policy<FunctorTag>(num_exec);
     // Timers don't work on CUDA, so place them here
-    GPTLstart(functor_name.c_str());
+    ScopedTimer timer(functor_name.c_str());
     profiling_resume();
-    Kokkos::parallel_for("vertical remap", policy, *this);
+    tuned_parallel_for(functor_name, policy, *this);
     ExecSpace::impl_static_fence();
     profiling_pause();
-    GPTLstop(functor_name.c_str());
   }
 
   KOKKOS_INLINE_FUNCTION
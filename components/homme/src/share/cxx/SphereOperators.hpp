@@ -127,6 +127,9 @@ public:
                       const ExecViewUnmanaged<const Real    [NP][NP]>& scalar,
                       const ExecViewUnmanaged<      Real [2][NP][NP]>& grad_s) const
   {
+#ifdef HOMMEXX_FUSED_SPHERE_OPS
+    gradient_sphere_sl_fused(kv,scalar,grad_s);
+#else
     // Make sure the buffers have been created
     assert (vector_buf_sl.size()>0);
 
@@ -158,6 +161,7 @@ public:
                         D_inv(h, 1, j, i) * temp_v_buf(1, j, i);
     });
     kv.team_barrier();
+#endif
   }
 
   KOKKOS_INLINE_FUNCTION void
@@ -378,6 +382,9 @@ public:
     static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
 
+#ifdef HOMMEXX_FUSED_SPHERE_OPS
+    gradient_sphere_fused<NUM_LEV_OUT,InputProvider,NUM_LEV_REQUEST>(kv,scalar,grad_s);
+#else
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
@@ -401,6 +408,7 @@ public:
       });
     });
     kv.team_barrier();
+#endif
   }
 
   template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
@@ -462,6 +470,9 @@ public:
     static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
 
+#ifdef HOMMEXX_FUSED_SPHERE_OPS
+    divergence_sphere_cm_fused<CM,InputProvider,NUM_LEV_OUT,NUM_LEV_REQUEST>(kv,v,div_v,alpha,beta);
+#else
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
@@ -499,6 +510,7 @@ public:
       });
     });
     kv.team_barrier();
+#endif
   }
 
   template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
@@ -567,6 +579,9 @@ public:
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
 
+#ifdef HOMMEXX_FUSED_SPHERE_OPS
+    vorticity_sphere_fused<NUM_LEV_OUT,NUM_LEV_IN,NUM_LEV_REQUEST>(kv,u,v,vort);
+#else
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
@@ -603,6 +618,7 @@ public:
       });
     });
     kv.team_barrier();
+#endif
   }
 
   //Why does the prev version take u and v separately?
@@ -617,6 +633,9 @@ public:
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
 
+#ifdef HOMMEXX_FUSED_SPHERE_OPS
+    vorticity_sphere_fused<NUM_LEV_OUT,NUM_LEV_IN,NUM_LEV_REQUEST>(kv,v,vort);
+#else
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
@@ -653,6 +672,7 @@ public:
       });
     });
     kv.team_barrier();
+#endif
   }
 
   template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
@@ -667,6 +687,9 @@ public:
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
     static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
 
+#ifdef HOMMEXX_FUSED_SPHERE_OPS
+    divergence_sphere_wk_fused<NUM_LEV_OUT,NUM_LEV_IN,NUM_LEV_REQUEST>(kv,v,div_v);
+#else
     // Make sure the buffers have been created
     assert (vector_buf_ml.size()>0);
 
@@ -707,6 +730,7 @@ public:
     });
     kv.team_barrier();
 
+#endif
   }//end of divergence_sphere_wk
 
   template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
@@ -1010,6 +1034,238 @@ public:
      kv.team_barrier();
   }//end of vlaplace_sphere_wk_contra
 
+  // ================ FUSED IMPLEMENTATION =========================== //
+
+  // Alternative implementations of the most used operators. Rather than
+  // staging the metric-transformed fields in the buffers (with a barrier
+  // between the metric term and the dvv contraction), each vector lane owns
+  // one level pack of the whole NP x NP tile, and keeps dvv and the tile in
+  // registers, so the metric term and the contraction are done in one pass,
+  // with no buffer and a single barrier at the end. The arithmetic is done in
+  // the same order as in the staged versions.
+  // Parallelism is over levels only, which suits CPU builds (one pack per
+  // lane, long vectors), but may leave lanes idle on GPU if the team has more
+  // lanes than NUM_LEV_REQUEST. Define HOMMEXX_FUSED_SPHERE_OPS to have the
+  // operators above dispatch to these.
+
+  KOKKOS_INLINE_FUNCTION void
+  gradient_sphere_sl_fused (const KernelVariables &kv,
+                            const ExecViewUnmanaged<const Real    [NP][NP]>& scalar,
+                            const ExecViewUnmanaged<      Real [2][NP][NP]>& grad_s) const
+  {
+    const auto& D_inv = Homme::subview(m_dinv,kv.ie);
+    constexpr int np_squared = NP * NP;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, np_squared),
+                         [&](const int loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
+      Real dsdx(0), dsdy(0);
+      for (int kgp = 0; kgp < NP; ++kgp) {
+        dsdx += dvv(jgp, kgp) * scalar(igp, kgp);
+        dsdy += dvv(igp, kgp) * scalar(kgp, jgp);
+      }
+      dsdx *= PhysicalConstants::rrearth;
+      dsdy *= PhysicalConstants::rrearth;
+      grad_s(0,igp,jgp) = D_inv(0,0,igp,jgp) * dsdx + D_inv(0,1,igp,jgp) * dsdy;
+      grad_s(1,igp,jgp) = D_inv(1,0,igp,jgp) * dsdx + D_inv(1,1,igp,jgp) * dsdy;
+    });
+    kv.team_barrier();
+  }
+
+  template<int NUM_LEV_OUT, typename InputProvider, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  gradient_sphere_fused (const KernelVariables &kv,
+                         const InputProvider& scalar,
+                         const ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_OUT]>& grad_s) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    Real dvv_r[NP][NP];
+    load_dvv(dvv_r);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(kv.team, NUM_LEV_REQUEST),
+                         [&](const int ilev) {
+      Scalar s[NP][NP];
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          s[igp][jgp] = scalar(igp, jgp, ilev);
+        }
+      }
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          Scalar v0, v1;
+          for (int kgp = 0; kgp < NP; ++kgp) {
+            v0 += dvv_r[jgp][kgp] * s[igp][kgp];
+            v1 += dvv_r[igp][kgp] * s[kgp][jgp];
+          }
+          v0 *= PhysicalConstants::rrearth;
+          v1 *= PhysicalConstants::rrearth;
+          grad_s(0,igp,jgp,ilev) = D_inv(0,0,igp,jgp) * v0 + D_inv(0,1,igp,jgp) * v1;
+          grad_s(1,igp,jgp,ilev) = D_inv(1,0,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1;
+        }
+      }
+    });
+    kv.team_barrier();
+  }
+
+  template<CombineMode CM, typename InputProvider,
+           int NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  divergence_sphere_cm_fused (const KernelVariables &kv,
+                              const InputProvider& v,
+                              const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& div_v,
+                              const Real alpha = 1.0, const Real beta = 0.0) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& metdet = Homme::subview(m_metdet, kv.ie);
+    Real dvv_r[NP][NP];
+    load_dvv(dvv_r);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(kv.team, NUM_LEV_REQUEST),
+                         [&](const int ilev) {
+      Scalar gv[2][NP][NP];
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          const auto& v0 = v(0, igp, jgp, ilev);
+          const auto& v1 = v(1, igp, jgp, ilev);
+          gv[0][igp][jgp] = (D_inv(0,0,igp,jgp) * v0 + D_inv(1,0,igp,jgp) * v1) * metdet(igp,jgp);
+          gv[1][igp][jgp] = (D_inv(0,1,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1) * metdet(igp,jgp);
+        }
+      }
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          Scalar dudx, dvdy;
+          for (int kgp = 0; kgp < NP; ++kgp) {
+            dudx += dvv_r[jgp][kgp] * gv[0][igp][kgp];
+            dvdy += dvv_r[igp][kgp] * gv[1][kgp][jgp];
+          }
+          combine<CM>((dudx + dvdy) * (1.0 / metdet(igp, jgp) * PhysicalConstants::rrearth),
+                       div_v(igp, jgp, ilev), alpha, beta);
+        }
+      }
+    });
+    kv.team_barrier();
+  }
+
+  // Takes the covariant components of the vector, already rotated by D^T
+  // (i.e., vcov(0) = D(0,0)u+D(0,1)v, vcov(1) = D(1,0)u+D(1,1)v) through
+  // CovariantProvider, which is called as cov(comp,igp,jgp,ilev).
+  template<int NUM_LEV_OUT, int NUM_LEV_REQUEST, typename CovariantProvider>
+  KOKKOS_INLINE_FUNCTION void
+  vorticity_sphere_fused_impl (const KernelVariables &kv,
+                               const CovariantProvider& cov,
+                               const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& vort) const
+  {
+    const auto& metdet = Homme::subview(m_metdet, kv.ie);
+    Real dvv_r[NP][NP];
+    load_dvv(dvv_r);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(kv.team, NUM_LEV_REQUEST),
+                         [&](const int ilev) {
+      Scalar vcov[2][NP][NP];
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          vcov[0][igp][jgp] = cov(0, igp, jgp, ilev);
+          vcov[1][igp][jgp] = cov(1, igp, jgp, ilev);
+        }
+      }
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          Scalar dudy, dvdx;
+          for (int kgp = 0; kgp < NP; ++kgp) {
+            dvdx += dvv_r[jgp][kgp] * vcov[1][igp][kgp];
+            dudy += dvv_r[igp][kgp] * vcov[0][kgp][jgp];
+          }
+          vort(igp, jgp, ilev) = (dvdx - dudy) * (1.0 / metdet(igp, jgp) *
+                                                  PhysicalConstants::rrearth);
+        }
+      }
+    });
+    kv.team_barrier();
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  vorticity_sphere_fused (const KernelVariables &kv,
+                          const typename ViewConst<ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_IN]>>::type& u,
+                          const typename ViewConst<ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_IN]>>::type& v,
+                          const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& vort) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    const auto& D = Homme::subview(m_d, kv.ie);
+    vorticity_sphere_fused_impl<NUM_LEV_OUT,NUM_LEV_REQUEST>(kv,
+        [&](const int comp, const int igp, const int jgp, const int ilev) -> Scalar {
+          const auto& u_ijk = u(igp, jgp, ilev);
+          const auto& v_ijk = v(igp, jgp, ilev);
+          return D(comp,0,igp,jgp) * u_ijk + D(comp,1,igp,jgp) * v_ijk;
+        }, vort);
+  }
+
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  vorticity_sphere_fused (const KernelVariables &kv,
+                          const typename ViewConst<ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>>::type& v,
+                          const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& vort) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    const auto& D = Homme::subview(m_d, kv.ie);
+    vorticity_sphere_fused_impl<NUM_LEV_OUT,NUM_LEV_REQUEST>(kv,
+        [&](const int comp, const int igp, const int jgp, const int ilev) -> Scalar {
+          const auto& v0 = v(0,igp,jgp,ilev);
+          const auto& v1 = v(1,igp,jgp,ilev);
+          return D(comp,0,igp,jgp) * v0 + D(comp,1,igp,jgp) * v1;
+        }, vort);
+  }
+
+  // Unlike divergence_sphere_wk, this does not overwrite the input view.
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  KOKKOS_INLINE_FUNCTION void
+  divergence_sphere_wk_fused (const KernelVariables &kv,
+                              const ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>& v,
+                              const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& div_v) const
+  {
+    static_assert(NUM_LEV_REQUEST>=0, "Error! Invalid value for NUM_LEV_REQUEST.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_IN, "Error! Input view does not have enough levels.\n");
+    static_assert(NUM_LEV_REQUEST<=NUM_LEV_OUT, "Error! Output view does not have enough levels.\n");
+
+    const auto& D_inv = Homme::subview(m_dinv, kv.ie);
+    const auto& spheremp = Homme::subview(m_spheremp, kv.ie);
+    Real dvv_r[NP][NP];
+    load_dvv(dvv_r);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(kv.team, NUM_LEV_REQUEST),
+                         [&](const int ilev) {
+      Scalar vc[2][NP][NP];
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          const auto v0 = v(0,igp,jgp,ilev);
+          const auto v1 = v(1,igp,jgp,ilev);
+          vc[0][igp][jgp] = D_inv(0, 0, igp, jgp) * v0 + D_inv(1, 0, igp, jgp) * v1;
+          vc[1][igp][jgp] = D_inv(0, 1, igp, jgp) * v0 + D_inv(1, 1, igp, jgp) * v1;
+        }
+      }
+      for (int ngp = 0; ngp < NP; ++ngp) {
+        for (int mgp = 0; mgp < NP; ++mgp) {
+          Scalar dd;
+          for (int jgp = 0; jgp < NP; ++jgp) {
+            dd -= (spheremp(ngp, jgp) * vc[0][ngp][jgp] * dvv_r[jgp][mgp] +
+                   spheremp(jgp, mgp) * vc[1][jgp][mgp] * dvv_r[jgp][ngp]) *
+                  PhysicalConstants::rrearth;
+          }
+          div_v(ngp, mgp, ilev) = dd;
+        }
+      }
+    });
+    kv.team_barrier();
+  }
+
   // The buffers should be enough to handle any single call to any
   // single sphere operator.
   // One might prefer them to be private, but they are handy for
@@ -1031,6 +1287,17 @@ public:
   ExecViewManaged<const Real * [NP][NP]>        m_metdet;
   ExecViewManaged<const Real * [2][2][NP][NP]>  m_d;
   ExecViewManaged<const Real * [2][2][NP][NP]>  m_dinv;
+
+private:
+
+  // Each thread of the team gets its own copy of dvv.
+  KOKKOS_INLINE_FUNCTION void load_dvv (Real (&dvv_r)[NP][NP]) const {
+    for (int igp = 0; igp < NP; ++igp) {
+      for (int jgp = 0; jgp < NP; ++jgp) {
+        dvv_r[igp][jgp] = dvv(igp, jgp);
+      }
+    }
+  }
 };
 
 } // namespace Homme
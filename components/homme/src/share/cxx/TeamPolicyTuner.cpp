@@ -0,0 +1,179 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "TeamPolicyTuner.hpp"
+
+#include "ErrorDefs.hpp"
+#include "mpi/Comm.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace Homme {
+
+TeamPolicyTuner::TeamPolicyTuner ()
+ : m_enabled (false)
+{
+  const char* fname = std::getenv("HOMMEXX_TUNE_POLICIES");
+  if (fname==nullptr || fname[0]=='\0') {
+    return;
+  }
+
+  m_enabled = true;
+  m_cache_file = fname;
+  read_cache();
+}
+
+TeamPolicyTuner::TeamPolicyTuner (const std::string& cache_file)
+ : m_enabled (true)
+ , m_cache_file (cache_file)
+{
+  read_cache();
+}
+
+void TeamPolicyTuner::read_cache ()
+{
+  // A missing cache file simply means nothing was tuned yet.
+  std::ifstream ifs(m_cache_file);
+  std::string line;
+  while (std::getline(ifs,line)) {
+    if (line.empty() || line[0]=='#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string key;
+    shape_type shape;
+    if (iss >> key >> shape.first >> shape.second) {
+      m_cache[key] = shape;
+    }
+  }
+}
+
+std::string TeamPolicyTuner::
+make_key (const std::string& name) const
+{
+  // The key is the first token of a line in the cache file.
+  std::string kernel = name;
+  std::replace(kernel.begin(),kernel.end(),' ','_');
+
+  std::stringstream ss;
+  ss << kernel << ":" << ExecSpace::concurrency() << ":"
+     << ExecSpace::name() << "-np" << NP << "-nlev" << NUM_PHYSICAL_LEV
+     << "-vec" << VECTOR_SIZE;
+#ifdef HOMMEXX_SHA1
+  ss << "-" << HOMMEXX_SHA1;
+#endif
+  return ss.str();
+}
+
+std::vector<TeamPolicyTuner::shape_type> TeamPolicyTuner::
+gpu_candidates () const
+{
+  // Same bounds as DefaultThreadsDistribution<Hommexx_Cuda>: whole warps, with
+  // the number of warps per team in [min,max], and the vector length dividing
+  // the warp size. The default shape is not added on purpose: it depends on
+  // the league size, and hence on the rank.
+  const int warp_size = 32;
+  std::vector<shape_type> candidates;
+  for (int num_warps=HOMMEXX_CUDA_MIN_WARP_PER_TEAM;
+       num_warps<=HOMMEXX_CUDA_MAX_WARP_PER_TEAM; num_warps*=2) {
+    for (int num_vectors=4; num_vectors<=warp_size; num_vectors*=2) {
+      candidates.emplace_back(num_warps*warp_size/num_vectors,num_vectors);
+    }
+  }
+  return candidates;
+}
+
+void TeamPolicyTuner::
+add_entry (const std::string& name, std::vector<shape_type>&& candidates)
+{
+  auto& e = m_entries[name];
+  e.candidates = std::move(candidates);
+  e.times.assign(e.candidates.size(),0.0);
+
+  const auto it = m_cache.find(make_key(name));
+  const bool hit = it!=m_cache.end() &&
+      std::find(e.candidates.begin(),e.candidates.end(),it->second)!=e.candidates.end();
+
+  // The timings are reduced over ranks in record, so either all ranks tune
+  // this kernel, or none does. If some rank misses the cache (e.g., with a
+  // cache file on a node-local file system), all ranks tune again. The min
+  // and max number of candidates are used to check that the ranks agree.
+  int flags[3] = { hit ? 1 : 0,
+                   static_cast<int>(e.candidates.size()),
+                  -static_cast<int>(e.candidates.size()) };
+  shape_type choice = hit ? it->second : shape_type();
+  if (Context::singleton().has<Comm>()) {
+    const auto& comm = Context::singleton().get<Comm>();
+    MPI_Allreduce(MPI_IN_PLACE,flags,3,MPI_INT,MPI_MIN,comm.mpi_comm());
+    if (flags[0]==1) {
+      // Use root's choice, in case the ranks read different cache files.
+      int root_choice[2] = { choice.first, choice.second };
+      MPI_Bcast(root_choice,2,MPI_INT,0,comm.mpi_comm());
+      choice = shape_type(root_choice[0],root_choice[1]);
+    }
+  }
+  Errors::runtime_check(flags[1]==-flags[2],
+      "Error! Ranks disagree on the candidate team shapes for tuned kernel '" + name + "'.\n");
+
+  if (flags[0]==1 &&
+      std::find(e.candidates.begin(),e.candidates.end(),choice)!=e.candidates.end()) {
+    e.choice = choice;
+    e.decided = true;
+  } else if (e.candidates.size()<=1) {
+    // Nothing to tune. With no candidates, parallel_for uses the input policy.
+    if (!e.candidates.empty()) {
+      e.choice = e.candidates[0];
+    }
+    e.decided = true;
+  }
+}
+
+void TeamPolicyTuner::
+record (const std::string& name, const double time)
+{
+  auto& e = m_entries.at(name);
+  e.times[e.num_calls / num_trials] += time;
+  ++e.num_calls;
+  if (e.num_calls < num_trials*static_cast<int>(e.candidates.size())) {
+    return;
+  }
+
+  // All ranks run the same kernels the same number of times, so this is a
+  // safe place for a collective. Picking the min of the max over ranks gives
+  // all ranks the same choice.
+  const bool has_comm = Context::singleton().has<Comm>();
+  if (has_comm) {
+    const auto& comm = Context::singleton().get<Comm>();
+    MPI_Allreduce(MPI_IN_PLACE,e.times.data(),e.times.size(),
+                  MPI_DOUBLE,MPI_MAX,comm.mpi_comm());
+  }
+  const auto imin = std::min_element(e.times.begin(),e.times.end()) - e.times.begin();
+  e.choice = e.candidates[imin];
+  e.decided = true;
+  m_cache[make_key(name)] = e.choice;
+
+  if (!has_comm || Context::singleton().get<Comm>().root()) {
+    write_cache();
+  }
+}
+
+void TeamPolicyTuner::write_cache () const
+{
+  std::ofstream ofs(m_cache_file);
+  if (!ofs.good()) {
+    // Not being able to save the choices is not a reason to stop the run.
+    return;
+  }
+  ofs << "# HOMMEXX team policy tuning cache: <kernel:concurrency:build> <threads> <vectors>\n";
+  for (const auto& it : m_cache) {
+    ofs << it.first << " " << it.second.first << " " << it.second.second << "\n";
+  }
+}
+
+} // namespace Homme
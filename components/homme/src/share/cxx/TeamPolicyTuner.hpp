@@ -0,0 +1,183 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_TEAM_POLICY_TUNER_HPP
+#define HOMMEXX_TEAM_POLICY_TUNER_HPP
+
+#include "Context.hpp"
+#include "ExecSpaceDefs.hpp"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Homme {
+
+// Opt-in autotuning of the (#threads, #vectors) shape of named team policies.
+//
+// The shapes returned by get_default_team_policy come from fixed heuristics
+// (see ThreadPreferences), which are the same for every kernel. If the
+// environment variable HOMMEXX_TUNE_POLICIES is set to a file name, kernels
+// launched via tuned_parallel_for are timed over a set of candidate shapes
+// during their first calls, and the fastest candidate (max time over ranks)
+// is used from then on. Choices are saved in that file, keyed by kernel name,
+// execution space concurrency, and build configuration, so that later runs
+// start directly from the tuned shapes. The league size is not part of the
+// key, since it differs between ranks, while all ranks must agree on whether
+// a kernel is still being tuned (the timings are reduced over ranks).
+//
+// The candidates are a fixed set of shapes, filtered only by what the functor
+// can be launched with, so they do not depend on the rank either. This
+// assumes all ranks run on the same kind of device.
+//
+// Only shapes that do not change which workspace slot a team gets are tried.
+// On GPU, TeamUtils hands out slots by league rank (or atomically, with
+// HOMMEXX_CUDA_SHARE_BUFFER), so any shape is safe. On host, the slot is
+// computed from the team size the functor's TeamUtils was built with, and
+// vector length is ignored by Kokkos, so host policies are left untouched.
+// Policies requesting team scratch memory are also left untouched, since
+// their scratch request depends on the team shape.
+//
+// Note: reductions across vector lanes may be reordered by a different
+// shape, so tuning should not be used in BFB testing.
+class TeamPolicyTuner {
+public:
+  using shape_type = std::pair<int,int>;
+
+  // Reads HOMMEXX_TUNE_POLICIES and, if set, loads the cache file (if any).
+  TeamPolicyTuner ();
+
+  // Enables tuning with the given cache file, loading it if it exists.
+  explicit TeamPolicyTuner (const std::string& cache_file);
+
+  bool enabled () const { return m_enabled; }
+
+  template<typename FunctorType, typename ExecSpaceType, typename... Tags>
+  void parallel_for (const std::string& name,
+                     const Kokkos::TeamPolicy<ExecSpaceType,Tags...>& policy,
+                     const FunctorType& functor);
+
+  // Number of timed calls per candidate shape.
+  static constexpr int num_trials = 3;
+
+  // The methods below are the building blocks of parallel_for, exposed for
+  // unit testing. Kernels are identified by name.
+
+  bool has_entry (const std::string& name) const {
+    return m_entries.find(name)!=m_entries.end();
+  }
+
+  // Sets up the entry for a kernel, picking up the cached choice, if any.
+  // If the candidates list is empty, the kernel is not tuned. This is a
+  // collective call: the cached choice is used only if all ranks have it.
+  void add_entry (const std::string& name, std::vector<shape_type>&& candidates);
+
+  // Whether the kernel is done with tuning. An untuned kernel is always done.
+  bool decided (const std::string& name) const { return m_entries.at(name).decided; }
+
+  // The shape to use in the next call of the kernel.
+  const shape_type& shape (const std::string& name) const { return m_entries.at(name).current(); }
+
+  // Accumulate the timing of the current candidate, and make the final
+  // choice once all candidates have been timed. The last call is collective.
+  void record (const std::string& name, const double time);
+
+private:
+
+  struct Entry {
+    std::vector<shape_type> candidates;
+    std::vector<double>     times;
+    int                     num_calls = 0;
+    bool                    decided   = false;
+    shape_type              choice;
+
+    const shape_type& current () const {
+      return decided ? choice : candidates[num_calls / num_trials];
+    }
+  };
+
+  std::string make_key (const std::string& name) const;
+
+  // Candidate shapes for a GPU.
+  std::vector<shape_type> gpu_candidates () const;
+
+  void read_cache ();
+  void write_cache () const;
+
+  bool                              m_enabled;
+  std::string                       m_cache_file;
+  // Keyed by make_key(name) and by name, respectively.
+  std::map<std::string,shape_type>  m_cache;
+  std::map<std::string,Entry>       m_entries;
+};
+
+// ==================== IMPLEMENTATION =================== //
+
+template<typename FunctorType, typename ExecSpaceType, typename... Tags>
+void TeamPolicyTuner::
+parallel_for (const std::string& name,
+              const Kokkos::TeamPolicy<ExecSpaceType,Tags...>& policy,
+              const FunctorType& functor)
+{
+  using policy_type = Kokkos::TeamPolicy<ExecSpaceType,Tags...>;
+
+  if (!m_enabled || !OnGpu<ExecSpaceType>::value ||
+      policy.scratch_size(0)>0 || policy.scratch_size(1)>0) {
+    Kokkos::parallel_for(name, policy, functor);
+    return;
+  }
+
+  const int league_size = policy.league_size();
+  if (!has_entry(name)) {
+    // Discard candidates that the functor cannot be launched with.
+    std::vector<shape_type> candidates;
+    for (const auto& s : gpu_candidates()) {
+      const policy_type p(league_size,1,s.second);
+      if (s.first<=p.team_size_max(functor,Kokkos::ParallelForTag())) {
+        candidates.push_back(s);
+      }
+    }
+    add_entry(name,std::move(candidates));
+  }
+
+  const auto& e = m_entries.at(name);
+  if (e.candidates.empty()) {
+    Kokkos::parallel_for(name, policy, functor);
+    return;
+  }
+
+  const auto& s = e.current();
+  policy_type p(league_size,s.first,s.second);
+  p.set_chunk_size(policy.chunk_size());
+
+  if (e.decided) {
+    Kokkos::parallel_for(name, p, functor);
+    return;
+  }
+
+  Kokkos::fence();
+  Kokkos::Timer timer;
+  Kokkos::parallel_for(name, p, functor);
+  Kokkos::fence();
+  record(name,timer.seconds());
+}
+
+// Drop-in replacement for Kokkos::parallel_for(name,policy,functor) for
+// kernels that take part in team policy tuning. The name identifies the
+// kernel in the tuning cache, so it must differ between kernels.
+template<typename FunctorType, typename ExecSpaceType, typename... Tags>
+void tuned_parallel_for (const std::string& name,
+                         const Kokkos::TeamPolicy<ExecSpaceType,Tags...>& policy,
+                         const FunctorType& functor)
+{
+  auto& tuner = Context::singleton().create_if_not_there<TeamPolicyTuner>();
+  tuner.parallel_for(name,policy,functor);
+}
+
+} // namespace Homme
+
+#endif // HOMMEXX_TEAM_POLICY_TUNER_HPP
@@ -31,9 +31,9 @@ void Tracers::init(const int num_elems, const int num_tracers)
   ne = num_elems;
   nt = num_tracers;
 
-  qdp = decltype(qdp)("tracers mass", num_elems);
-  qtens_biharmonic = decltype(qtens_biharmonic)("qtens(_biharmonic)", num_elems);
-  qlim = decltype(qlim)("qlim", num_elems);
+  qdp = decltype(qdp)("tracers mass", num_elems,Q_NUM_TIME_LEVELS,num_tracers);
+  qtens_biharmonic = decltype(qtens_biharmonic)("qtens(_biharmonic)", num_elems,num_tracers);
+  qlim = decltype(qlim)("qlim", num_elems,num_tracers);
 
   Q = decltype(Q)("tracers concentration", num_elems,num_tracers);
   fq = decltype(fq)("fq",num_elems,num_tracers);
@@ -33,11 +33,13 @@ struct Tracers {
 
   bool inited () const { return m_inited; }
 
-  ExecViewManaged<Scalar*[Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> qdp;
-  ExecViewManaged<Scalar*[QSIZE_D][NP][NP][NUM_LEV]>                    qtens_biharmonic; // Also doubles as just qtens.
-  ExecViewManaged<Scalar*[QSIZE_D][2][NUM_LEV]>                         qlim;
-  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>                    Q;
-  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>                    fq;
+  // Note: all tracers views are sized with the runtime number of tracers (qsize),
+  //       rather than the compile-time upper bound QSIZE_D.
+  ExecViewManaged<Scalar***[NP][NP][NUM_LEV]>   qdp;              // (ie,Q_NUM_TIME_LEVELS,qsize)
+  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>    qtens_biharmonic; // Also doubles as just qtens.
+  ExecViewManaged<Scalar**[2][NUM_LEV]>         qlim;
+  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>    Q;
+  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>    fq;
 
 private:
   int nt;
@@ -35,6 +35,10 @@ BoundaryExchange::BoundaryExchange()
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
 
+  // By default, exchange all the levels of 3d fields
+  m_3d_lev_beg = 0;
+  m_3d_lev_end = NUM_LEV;
+
   m_connectivity    = std::shared_ptr<Connectivity>();
   m_buffers_manager = std::shared_ptr<MpiBuffersManager>();
 
@@ -160,6 +164,19 @@ void BoundaryExchange::set_num_fields (const int num_1d_fields, const int num_2d
   m_cleaned_up = false;
 }
 
+void BoundaryExchange::set_3d_level_range (const int lev_beg, const int lev_end)
+{
+  // The range must be set after set_num_fields, and before registration is completed,
+  // since it affects the buffers sizes requested to the MpiBuffersManager
+  assert (m_registration_started && !m_registration_completed);
+
+  // Must be a non-empty range of level packs
+  assert (lev_beg>=0 && lev_beg<lev_end && lev_end<=NUM_LEV);
+
+  m_3d_lev_beg = lev_beg;
+  m_3d_lev_end = lev_end;
+}
+
 void BoundaryExchange::clean_up()
 {
   if (m_cleaned_up) {
@@ -180,6 +197,9 @@ void BoundaryExchange::clean_up()
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
 
+  m_3d_lev_beg = 0;
+  m_3d_lev_end = NUM_LEV;
+
   // If we clean up, we need to reset the number of fields
   m_registration_started   = false;
   m_registration_completed = false;
@@ -211,7 +231,7 @@ void BoundaryExchange::registration_completed()
   // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
   //       we have 2 Real per level (max and min over element).
 
-  const int single_ptr_buf_size = m_num_2d_fields + m_num_3d_fields*NUM_LEV*VECTOR_SIZE + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE;
+  const int single_ptr_buf_size = m_num_2d_fields + m_num_3d_fields*get_num_3d_levels()*VECTOR_SIZE + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE;
   m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
   m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP;
 
@@ -356,15 +376,17 @@ void BoundaryExchange::pack_and_send ()
     auto fields_3d = m_3d_fields;
     auto send_3d_buffers = m_send_3d_buffers;
     const auto num_3d_fields = m_num_3d_fields;
+    const int lev_beg = m_3d_lev_beg;
+    const int num_lev = get_num_3d_levels();
     if (OnGpu<ExecSpace>::value) {
       const ConnectionHelpers helpers;
       Kokkos::parallel_for(
-        Kokkos::RangePolicy<ExecSpace>(0, m_num_elems*m_num_3d_fields*NUM_CONNECTIONS*NUM_LEV),
+        Kokkos::RangePolicy<ExecSpace>(0, m_num_elems*m_num_3d_fields*NUM_CONNECTIONS*num_lev),
         KOKKOS_LAMBDA(const int it) {
-          const int ie = it / (num_3d_fields*NUM_CONNECTIONS*NUM_LEV);
-          const int ifield = (it / (NUM_CONNECTIONS*NUM_LEV)) % num_3d_fields;
-          const int iconn = (it / NUM_LEV) % NUM_CONNECTIONS;
-          const int ilev = it % NUM_LEV;
+          const int ie = it / (num_3d_fields*NUM_CONNECTIONS*num_lev);
+          const int ifield = (it / (NUM_CONNECTIONS*num_lev)) % num_3d_fields;
+          const int iconn = (it / num_lev) % NUM_CONNECTIONS;
+          const int ilev = it % num_lev;
           const ConnectionInfo& info = connections(ie, iconn);
           const LidGidPos& field_lidpos = info.local;
           // For the buffer, in case of local connection, use remote info. In fact, while with shared connections the
@@ -377,14 +399,14 @@ void BoundaryExchange::pack_and_send ()
           const auto& sb = send_3d_buffers(buffer_lidpos.lid, ifield, buffer_lidpos.pos);
           const auto& f3 = fields_3d(field_lidpos.lid, ifield);
           for (int k=0; k<helpers.CONNECTION_SIZE[info.kind]; ++k) {
-            sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
+            sb(k, ilev) = f3(pts[k].ip, pts[k].jp, lev_beg+ilev);
           }
         });
     } else {
       const auto num_parallel_iterations = m_num_elems*m_num_3d_fields;
       ThreadPreferences tp;
       tp.max_threads_usable = NUM_CONNECTIONS;
-      tp.max_vectors_usable = NUM_LEV;
+      tp.max_vectors_usable = num_lev;
       const auto threads_vectors =
         DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(
           num_parallel_iterations, tp);
@@ -413,9 +435,9 @@ void BoundaryExchange::pack_and_send ()
                 const auto& ip = pts[k].ip;
                 const auto& jp = pts[k].jp;
                 auto* const sbp = &sb(k, 0);
-                const auto* const f3p = &f3(ip, jp, 0);
+                const auto* const f3p = &f3(ip, jp, lev_beg);
                 Kokkos::parallel_for(
-                  Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
+                  Kokkos::ThreadVectorRange(kv.team, num_lev),
                   [&] (const int& ilev) {
                     sbp[ilev] = f3p[ilev];
                   });
@@ -591,46 +613,48 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
     auto fields_3d = m_3d_fields;
     auto recv_3d_buffers = m_recv_3d_buffers;
     const auto num_3d_fields = m_num_3d_fields;
+    const int lev_beg = m_3d_lev_beg;
+    const int num_lev = get_num_3d_levels();
     if (OnGpu<ExecSpace>::value) {
       const ConnectionHelpers helpers;
       Kokkos::parallel_for(
-        Kokkos::RangePolicy<ExecSpace>(0, m_num_elems*m_num_3d_fields*NUM_LEV),
+        Kokkos::RangePolicy<ExecSpace>(0, m_num_elems*m_num_3d_fields*num_lev),
         KOKKOS_LAMBDA(const int it) {
-          const int ie = it / (num_3d_fields*NUM_LEV);
-          const int ifield = (it / NUM_LEV) % num_3d_fields;
-          const int ilev = it % NUM_LEV;
+          const int ie = it / (num_3d_fields*num_lev);
+          const int ifield = (it / num_lev) % num_3d_fields;
+          const int ilev = it % num_lev;
           const auto& f3 = fields_3d(ie, ifield);
           for (int k=0; k<NP; ++k) {
             for (int iedge : helpers.UNPACK_EDGES_ORDER) {
               f3(helpers.CONNECTION_PTS_FWD[iedge][k].ip,
-                 helpers.CONNECTION_PTS_FWD[iedge][k].jp, ilev)
+                 helpers.CONNECTION_PTS_FWD[iedge][k].jp, lev_beg+ilev)
                 += recv_3d_buffers(ie, ifield, iedge)(k, ilev);
             }
           }
           for (int icorner : helpers.UNPACK_CORNERS_ORDER) {
             if (recv_3d_buffers(ie, ifield, icorner).size() > 0)
               f3(helpers.CONNECTION_PTS_FWD[icorner][0].ip,
-                 helpers.CONNECTION_PTS_FWD[icorner][0].jp, ilev)
+                 helpers.CONNECTION_PTS_FWD[icorner][0].jp, lev_beg+ilev)
                 += recv_3d_buffers(ie, ifield, icorner)(0, ilev);
           }
         });
       if (rspheremp) {
         const auto rsmp = *rspheremp;
         Kokkos::parallel_for(
-          Kokkos::RangePolicy<ExecSpace>(0, m_num_elems*m_num_3d_fields*NP*NP*NUM_LEV),
+          Kokkos::RangePolicy<ExecSpace>(0, m_num_elems*m_num_3d_fields*NP*NP*num_lev),
           KOKKOS_LAMBDA(const int it) {
-            const int ie = it / (num_3d_fields*NUM_LEV*NP*NP);
-            const int ifield = (it / (NP*NP*NUM_LEV)) % num_3d_fields;
-            const int i = (it / (NP*NUM_LEV)) % NP;
-            const int j = (it / NUM_LEV) % NP;
-            const int ilev = it % NUM_LEV;
-            fields_3d(ie, ifield)(i, j, ilev) *= rsmp(ie, i, j);
+            const int ie = it / (num_3d_fields*num_lev*NP*NP);
+            const int ifield = (it / (NP*NP*num_lev)) % num_3d_fields;
+            const int i = (it / (NP*num_lev)) % NP;
+            const int j = (it / num_lev) % NP;
+            const int ilev = it % num_lev;
+            fields_3d(ie, ifield)(i, j, lev_beg+ilev) *= rsmp(ie, i, j);
           });
       }
     } else {
       const auto num_parallel_iterations = m_num_elems*m_num_3d_fields;
       Kokkos::parallel_for(
-        Kokkos::TeamPolicy<ExecSpace>(num_parallel_iterations, 1, NUM_LEV),
+        Kokkos::TeamPolicy<ExecSpace>(num_parallel_iterations, 1, num_lev),
         KOKKOS_LAMBDA(const TeamMember& team) {
           Homme::KernelVariables kv(team, num_3d_fields);
           const int ie = kv.ie;
@@ -640,10 +664,10 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
             const auto& r3 = recv_3d_buffers(ie, ifield, iedge);
             // Using pointers here is a little bit of speedup that
             // can't be ignored in a kernel as important as un/pack.
-            auto* const f3p = &f3(ip, jp, 0);
+            auto* const f3p = &f3(ip, jp, lev_beg);
             const auto* const r3p = &r3(k, 0);
             Kokkos::parallel_for(
-              Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
+              Kokkos::ThreadVectorRange(kv.team, num_lev),
               [&] (const int& ilev) {
                 f3p[ilev] += r3p[ilev];
               });
@@ -658,10 +682,10 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
             const auto& r3 = recv_3d_buffers(ie, ifield, icorner);
             if (r3.size() == 0)
               return;
-            auto* const f3p = &f3(ip, jp, 0);
+            auto* const f3p = &f3(ip, jp, lev_beg);
             const auto* const r3p = &r3(0, 0);
             Kokkos::parallel_for(
-              Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
+              Kokkos::ThreadVectorRange(kv.team, num_lev),
               [&] (const int& ilev) {
                 f3p[ilev] += r3p[ilev];
               });
@@ -673,10 +697,10 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
           if (rspheremp) {
             for (int i = 0; i < NP; ++i)
               for (int j = 0; j < NP; ++j) {
-                auto* const f3p = &f3(i, j, 0);
+                auto* const f3p = &f3(i, j, lev_beg);
                 const auto& rsmp = (*rspheremp)(ie, i, j);
                 Kokkos::parallel_for(
-                  Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
+                  Kokkos::ThreadVectorRange(kv.team, num_lev),
                   [&] (const int& ilev) {
                     f3p[ilev] *= rsmp;
                   });
@@ -1061,8 +1085,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   //         - a portion of local_buffer if info.sharing=LOCAL
   //         - the blackhole_send/recv if info.sharing=MISSING
   //       After reserving the buffer portion, update the offset by a given increment, depending on info.kind:
-  //         - increment[CORNER]  = m_elem_buf_size[CORNER)] = 1  * (m_num_2d_fields + NUM_LEV*VECTOR_SIZE m_num_3d_fields)
-  //         - increment[EDGE]    = m_elem_buf_size[EDGE)]   = NP * (m_num_2d_fields + NUM_LEV*VECTOR_SIZE m_num_3d_fields)
+  //         - increment[CORNER]  = m_elem_buf_size[CORNER)] = 1  * (m_num_2d_fields + num_3d_levels*VECTOR_SIZE m_num_3d_fields)
+  //         - increment[EDGE]    = m_elem_buf_size[EDGE)]   = NP * (m_num_2d_fields + num_3d_levels*VECTOR_SIZE m_num_3d_fields)
   //         - increment[MISSING] = 0 (point to the same blackhole)
   // Note: m_blackhole_send will be written many times, but will never be read from.
   //       Kind of like streaming to /dev/null. blackhole_recv will be read from sometimes
@@ -1130,6 +1154,7 @@ void BoundaryExchange::build_buffer_views_and_requests()
   auto h_send_3d_int_buffers = Kokkos::create_mirror_view(m_send_3d_int_buffers);
   auto h_recv_3d_int_buffers = Kokkos::create_mirror_view(m_recv_3d_int_buffers);
   auto h_connections = m_connectivity->get_connections<HostMemSpace>();
+  const int num_3d_levels = get_num_3d_levels();
   for (int k = 0; k < m_num_elems*NUM_CONNECTIONS; ++k) {
     const int ie = slot_idx_to_elem_conn_pair[k] / NUM_CONNECTIONS;
     const int iconn = slot_idx_to_elem_conn_pair[k] % NUM_CONNECTIONS;
@@ -1156,13 +1181,13 @@ void BoundaryExchange::build_buffer_views_and_requests()
         h_buf_offset[info.sharing] += h_increment_2d[info.kind];
       }
       for (int ifield=0; ifield<m_num_3d_fields; ++ifield) {
-        h_send_3d_buffers(local.lid, ifield, local.pos) = ExecViewUnmanaged<Scalar*[NUM_LEV]>(
+        h_send_3d_buffers(local.lid, ifield, local.pos) = ExecViewUnmanaged<Scalar**>(
           reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
-          helpers.CONNECTION_SIZE[info.kind]);
-        h_recv_3d_buffers(local.lid, ifield, local.pos) = ExecViewUnmanaged<Scalar*[NUM_LEV]>(
+          helpers.CONNECTION_SIZE[info.kind], num_3d_levels);
+        h_recv_3d_buffers(local.lid, ifield, local.pos) = ExecViewUnmanaged<Scalar**>(
           reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
-          helpers.CONNECTION_SIZE[info.kind]);
-        h_buf_offset[info.sharing] += h_increment_3d[info.kind]*NUM_LEV*VECTOR_SIZE;
+          helpers.CONNECTION_SIZE[info.kind], num_3d_levels);
+        h_buf_offset[info.sharing] += h_increment_3d[info.kind]*num_3d_levels*VECTOR_SIZE;
       }
       for (int ifield=0; ifield<m_num_3d_int_fields; ++ifield) {
         h_send_3d_int_buffers(local.lid, ifield, local.pos) = ExecViewUnmanaged<Scalar*[NUM_LEV_P]>(
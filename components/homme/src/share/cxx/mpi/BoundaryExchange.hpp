@@ -64,6 +64,13 @@ class MpiBuffersManager;
  *    and sets up all the internal structure to prepare for calls to
  *    exchange(). This method MUST be called BEFORE any call to exchange.
  *
+ * Optionally, between set_num_fields and registration_completed, one can call
+ * set_3d_level_range, to restrict the exchange of the 3d fields to a contiguous
+ * range of level packs. Only those packs are packed, sent and unpacked (and
+ * scaled by rspheremp, if requested); the other packs keep their local values.
+ * This is useful when only a few levels are non-zero (e.g., the sponge layer),
+ * since buffers sizes and MPI volume scale with the number of exchanged packs.
+ *
  * This class relies on the MpiBuffersManager (BM) class for the handling of the buffers.
  * See MpiBuffersManager header for more info on that. As explained above,
  * you may have different BE objects, which are however never used at the
@@ -182,6 +189,8 @@ public:
   // This registration method should be used for the exchange of min/max fields
   template<int DIM, typename... Properties>
   void register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
+  template<typename... Properties>
+  void register_min_max_fields (ExecView<Scalar**[2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
 
   // Size the buffers, and initialize the MPI types
   void registration_completed();
@@ -193,12 +202,18 @@ public:
   // Exchange all registered 1d fields, performing min/max operations with neighbors
   void exchange_min_max ();
 
+  // Restrict the exchange of 3d fields to the level packs [lev_beg, lev_end)
+  void set_3d_level_range (const int lev_beg, const int lev_end);
+
   // Get the number of 2d/3d fields that this object handles
   int get_num_1d_fields () const { return m_num_1d_fields; }
   int get_num_2d_fields () const { return m_num_2d_fields; }
   int get_num_3d_fields () const { return m_num_3d_fields; }
   int get_num_3d_int_fields () const { return m_num_3d_int_fields; }
 
+  // Get the number of level packs exchanged for each 3d field
+  int get_num_3d_levels () const { return m_3d_lev_end-m_3d_lev_beg; }
+
   template<typename ptr_type, typename raw_type>
   struct Pointer {
 
@@ -264,8 +279,9 @@ private:
   ExecViewManaged<ExecViewUnmanaged<Real*>**[NUM_CONNECTIONS]>               m_send_2d_buffers;
   ExecViewManaged<ExecViewUnmanaged<Real*>**[NUM_CONNECTIONS]>               m_recv_2d_buffers;
 
-  ExecViewManaged<ExecViewUnmanaged<Scalar*[NUM_LEV]>**[NUM_CONNECTIONS]>    m_send_3d_buffers;
-  ExecViewManaged<ExecViewUnmanaged<Scalar*[NUM_LEV]>**[NUM_CONNECTIONS]>    m_recv_3d_buffers;
+  // Note: the level extent is a runtime one, since only the packs in [m_3d_lev_beg,m_3d_lev_end) are exchanged
+  ExecViewManaged<ExecViewUnmanaged<Scalar**>**[NUM_CONNECTIONS]>           m_send_3d_buffers;
+  ExecViewManaged<ExecViewUnmanaged<Scalar**>**[NUM_CONNECTIONS]>           m_recv_3d_buffers;
 
   // TODO: optimize: you only need to pack/unpack the first entry of the NUM_LEV_P-th pack.
   //       This is because, if NUM_LEV!=NUM_LEV_P, then the NUM_LEV_P-th pack contains
@@ -279,6 +295,10 @@ private:
   int         m_num_3d_fields;
   int         m_num_3d_int_fields;
 
+  // The range of level packs exchanged for 3d fields (defaults to [0,NUM_LEV))
+  int         m_3d_lev_beg;
+  int         m_3d_lev_end;
+
   // The following flags are used to ensure that a bad user does not call setup/cleanup/registration
   // methods of this class in an order that generate errors. And if he/she does, we try to avoid errors.
   bool        m_registration_started;
@@ -602,6 +622,28 @@ void BoundaryExchange::register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV
   m_num_1d_fields += num_dims;
 }
 
+template<typename... Properties>
+void BoundaryExchange::register_min_max_fields (ExecView<Scalar**[2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim)
+{
+  using Kokkos::ALL;
+
+  // Sanity checks
+  assert(m_registration_started && !m_registration_completed);
+  assert(m_num_2d_fields == 0 && m_num_3d_fields == 0);
+  assert(start_dim+num_dims<=field_min_max.extent_int(1));
+
+  {
+    auto l_num_1d_fields = m_num_1d_fields;
+    auto l_1d_fields     = m_1d_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int idim){
+      l_1d_fields(ie, l_num_1d_fields+idim) = Kokkos::subview(field_min_max, ie, start_dim+idim, ALL, ALL);
+    });
+  }
+
+  m_num_1d_fields += num_dims;
+}
+
 } // namespace Homme
 
 #endif // HOMMEXX_BOUNDARY_EXCHANGE_HPP
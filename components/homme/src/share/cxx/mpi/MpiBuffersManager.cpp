@@ -58,10 +58,11 @@ void MpiBuffersManager::set_connectivity (std::shared_ptr<Connectivity> connecti
   m_connectivity = connectivity;
 }
 
-bool MpiBuffersManager::check_views_capacity (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_interface_fields) const
+bool MpiBuffersManager::check_views_capacity (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_interface_fields,
+                                              const int num_3d_levels) const
 {
   size_t mpi_buffer_size, local_buffer_size;
-  required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_interface_fields, mpi_buffer_size, local_buffer_size);
+  required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_interface_fields, num_3d_levels, mpi_buffer_size, local_buffer_size);
 
   return (mpi_buffer_size<=m_mpi_buffer_size) &&
          (local_buffer_size<=m_local_buffer_size);
@@ -163,8 +164,12 @@ void MpiBuffersManager::update_requested_sizes (typename std::map<BoundaryExchan
   const int num_3d_fields = customer.first->get_num_3d_fields();
   const int num_3d_int_fields = customer.first->get_num_3d_int_fields();
 
+  // Get the number of level packs exchanged for each 3d field (may be less than NUM_LEV)
+  const int num_3d_levels = customer.first->get_num_3d_levels();
+
   // Compute the requested buffers sizes and compare with stored ones
-  required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_int_fields, customer.second.mpi_buffer_size, customer.second.local_buffer_size);
+  required_buffer_sizes (num_1d_fields, num_2d_fields, num_3d_fields, num_3d_int_fields, num_3d_levels,
+                         customer.second.mpi_buffer_size, customer.second.local_buffer_size);
   if (customer.second.mpi_buffer_size>m_mpi_buffer_size) {
     // Update the total
     m_mpi_buffer_size = customer.second.mpi_buffer_size;
@@ -184,6 +189,7 @@ void MpiBuffersManager::update_requested_sizes (typename std::map<BoundaryExchan
 
 void MpiBuffersManager::required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                                                const int num_3d_fields, const int num_3d_interface_fields,
+                                               const int num_3d_levels,
                                                size_t& mpi_buffer_size, size_t& local_buffer_size) const
 {
   mpi_buffer_size = local_buffer_size = 0;
@@ -192,7 +198,7 @@ void MpiBuffersManager::required_buffer_sizes (const int num_1d_fields, const in
   // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
   //       we have 2 Real per level (max and min over element).
   int elem_buf_size[2];
-  const int pt_buf_size = num_2d_fields + num_3d_fields*NUM_LEV*VECTOR_SIZE + num_3d_interface_fields*NUM_LEV_P*VECTOR_SIZE;
+  const int pt_buf_size = num_2d_fields + num_3d_fields*num_3d_levels*VECTOR_SIZE + num_3d_interface_fields*NUM_LEV_P*VECTOR_SIZE;
   elem_buf_size[etoi(ConnectionKind::CORNER)] = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * 1;
   elem_buf_size[etoi(ConnectionKind::EDGE)]   = num_1d_fields*2*NUM_LEV*VECTOR_SIZE + pt_buf_size * NP;
 
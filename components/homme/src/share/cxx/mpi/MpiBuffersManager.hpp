@@ -94,7 +94,9 @@ public:
   void check_for_reallocation ();
 
   // Check that the allocated views can handle the requested number of 2d/3d fields
-  bool check_views_capacity (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_interface_fields) const;
+  // (with num_3d_levels level packs exchanged for each 3d field)
+  bool check_views_capacity (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_interface_fields,
+                             const int num_3d_levels = NUM_LEV) const;
 
   // Allocate the buffers (overwriting possibly already allocated ones if needed)
   void allocate_buffers ();
@@ -148,6 +150,7 @@ private:
   // Computes the required storages
   void required_buffer_sizes (const int num_1d_fields, const int num_2d_fields,
                               const int num_3d_fields, const int num_3d_interface_fields,
+                              const int num_3d_levels,
                               size_t& mpi_buffer_size, size_t& local_buffer_size) const;
 
   // The number of customers
@@ -38,7 +38,7 @@ void prim_advec_tracers_remap (const Real dt) {
 
 static void prim_advec_tracers_remap_RK2 (const Real dt)
 {
-  GPTLstart("tl-at prim_advec_tracers_remap_RK2");
+  ScopedTimer timer("tl-at prim_advec_tracers_remap_RK2");
   // Get control and simulation params
   SimulationParams& params = Context::singleton().get<SimulationParams>();
   assert(params.params_set);
@@ -52,53 +52,57 @@ static void prim_advec_tracers_remap_RK2 (const Real dt)
   esf.reset(params);
 
   // Precompute divdp
-  GPTLstart("tl-at precompute_divdp");
-  esf.precompute_divdp();
-  ExecSpace::impl_static_fence();
-  GPTLstop("tl-at precompute_divdp");
+  {
+    ScopedTimer timer_divdp("tl-at precompute_divdp");
+    esf.precompute_divdp();
+    ExecSpace::impl_static_fence();
+  }
 
   // Euler steps
   DSSOption DSSopt;
   Real rhs_multiplier;
 
   // Euler step 1
-  GPTLstart("tl-at esf-0");
-  rhs_multiplier = 0.0;
-  DSSopt = DSSOption::DIV_VDP_AVE;
-  esf.euler_step(tl.np1_qdp,tl.n0_qdp,dt/2.0,rhs_multiplier,DSSopt);
-  GPTLstop("tl-at esf-0");
+  {
+    ScopedTimer timer_esf("tl-at esf-0");
+    rhs_multiplier = 0.0;
+    DSSopt = DSSOption::DIV_VDP_AVE;
+    esf.euler_step(tl.np1_qdp,tl.n0_qdp,dt/2.0,rhs_multiplier,DSSopt);
+  }
 
   // Euler step 2
-  GPTLstart("tl-at esf-1");
-  rhs_multiplier = 1.0;
-  DSSopt = DSSOption::ETA;
-  esf.euler_step(tl.np1_qdp,tl.np1_qdp,dt/2.0,rhs_multiplier,DSSopt);
-  GPTLstop("tl-at esf-1");
+  {
+    ScopedTimer timer_esf("tl-at esf-1");
+    rhs_multiplier = 1.0;
+    DSSopt = DSSOption::ETA;
+    esf.euler_step(tl.np1_qdp,tl.np1_qdp,dt/2.0,rhs_multiplier,DSSopt);
+  }
 
   // Euler step 3
-  GPTLstart("tl-at esf-2");
-  rhs_multiplier = 2.0;
-  DSSopt = DSSOption::OMEGA;
-  esf.euler_step(tl.np1_qdp,tl.np1_qdp,dt/2.0,rhs_multiplier,DSSopt);
-  GPTLstop("tl-at esf-2");
+  {
+    ScopedTimer timer_esf("tl-at esf-2");
+    rhs_multiplier = 2.0;
+    DSSopt = DSSOption::OMEGA;
+    esf.euler_step(tl.np1_qdp,tl.np1_qdp,dt/2.0,rhs_multiplier,DSSopt);
+  }
 
   // to finish the 2D advection step, we need to average the t and t+2 results to get a second order estimate for t+1.
-  GPTLstart("tl-at qdp_time_avg");
-  esf.qdp_time_avg(tl.n0_qdp,tl.np1_qdp);
-  ExecSpace::impl_static_fence();
-  GPTLstop("tl-at qdp_time_avg");
+  {
+    ScopedTimer timer_avg("tl-at qdp_time_avg");
+    esf.qdp_time_avg(tl.n0_qdp,tl.np1_qdp);
+    ExecSpace::impl_static_fence();
+  }
 
   if ( ! EulerStepFunctor::is_quasi_monotone(params.limiter_option)) {
     Errors::option_error("prim_advec_tracers_remap_RK2","limiter_option",
                           params.limiter_option);
     // call advance_hypervis_scalar(edgeadv,elem,hvcoord,hybrid,deriv,tl%np1,np1_qdp,nets,nete,dt)
   }
-  GPTLstop("tl-at prim_advec_tracers_remap_RK2");
 }
 
 #ifdef MODEL_THETA_L
 static void prim_advec_tracers_remap_compose (const Real dt) {
-  GPTLstart("tl-at prim_advec_tracers_compose");
+  ScopedTimer timer("tl-at prim_advec_tracers_compose");
   const auto& params = Context::singleton().get<SimulationParams>();
   assert(params.params_set);
   auto& tl = Context::singleton().get<TimeLevel>();
@@ -106,7 +110,6 @@ static void prim_advec_tracers_remap_compose (const Real dt) {
   auto& ct = Context::singleton().get<ComposeTransport>();
   ct.reset(params);
   ct.run(tl, dt);
-  GPTLstop("tl-at prim_advec_tracers_compose");
 }
 #endif
 
@@ -29,7 +29,7 @@ extern "C" {
 
 void initialize_dp3d_from_ps_c () {
   // Initialize dp3d from ps
-  GPTLstart("tl-sc dp3d-from-ps");
+  ScopedTimer timer("tl-sc dp3d-from-ps");
 
   auto& context = Context::singleton();
   auto& tl = context.get<TimeLevel>();
@@ -55,12 +55,11 @@ void initialize_dp3d_from_ps_c () {
     });
   }
   ExecSpace::impl_static_fence();
-  GPTLstop("tl-sc dp3d-from-ps");
 }
 
 void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np1, const int& next_output_step)
 {
-  GPTLstart("tl-sc prim_run_subcycle_c");
+  ScopedTimer timer("tl-sc prim_run_subcycle_c");
 
   auto& context = Context::singleton();
 
@@ -125,13 +124,14 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
     }
 
     // Loop over rsplit vertically lagrangian timesteps
-    GPTLstart("tl-sc prim_step-loop");
-    prim_step(dt,compute_diagnostics);
-    for (int r=1; r<params.rsplit; ++r) {
-      tl.update_dynamics_levels(UpdateType::LEAPFROG);
-      prim_step(dt,false);
+    {
+      ScopedTimer timer_step("tl-sc prim_step-loop");
+      prim_step(dt,compute_diagnostics);
+      for (int r=1; r<params.rsplit; ++r) {
+        tl.update_dynamics_levels(UpdateType::LEAPFROG);
+        prim_step(dt,false);
+      }
     }
-    GPTLstop("tl-sc prim_step-loop");
 
     tl.update_tracers_levels(params.dt_tracer_factor);
 
@@ -145,9 +145,10 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
     // always for tracers
     // if rsplit>0:  also remap dynamics and compute reference level ps_v
     ////////////////////////////////////////////////////////////////////////
-    GPTLstart("tl-sc vertical_remap");
-    vertical_remap(dt_remap);
-    GPTLstop("tl-sc vertical_remap");
+    {
+      ScopedTimer timer_remap("tl-sc vertical_remap");
+      vertical_remap(dt_remap);
+    }
 
     ////////////////////////////////////////////////////////////////////////
     // time step is complete.  update some diagnostic variables:
@@ -171,8 +172,6 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
   nm1   = tl.nm1;
   n0    = tl.n0;
   np1   = tl.np1;
-
-  GPTLstop("tl-sc prim_run_subcycle_c");
 }
 
 } // extern "C"
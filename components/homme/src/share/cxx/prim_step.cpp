@@ -28,7 +28,7 @@ static void set_tracer_transport_derived_values (
   // initialize mean flux accumulation variables and save some variables at n0
   // for use by advection
   // ===============
-  GPTLstart("tl-s deep_copy+derived_dp");
+  ScopedTimer timer("tl-s deep_copy+derived_dp");
   {
     const auto eta_dot_dpdn = elements.m_derived.m_eta_dot_dpdn;
     const auto derived_vn0 = elements.m_derived.m_vn0;
@@ -62,12 +62,11 @@ static void set_tracer_transport_derived_values (
     });
   }
   ExecSpace::impl_static_fence();
-  GPTLstop("tl-s deep_copy+derived_dp");  
 }
 
 void prim_step (const Real dt, const bool compute_diagnostics)
 {
-  GPTLstart("tl-s prim_step");
+  ScopedTimer timer("tl-s prim_step");
   // Get control and simulation params
   SimulationParams& params = Context::singleton().get<SimulationParams>();
   assert(params.params_set);
@@ -83,15 +82,16 @@ void prim_step (const Real dt, const bool compute_diagnostics)
   // ===============
   // Dynamical Step
   // ===============
-  GPTLstart("tl-s prim_advance_exp-loop");
-  prim_advance_exp(tl,dt,compute_diagnostics);
-  tl.tevolve += dt;
-  for (int n=1; n<params.dt_tracer_factor; ++n) {
-    tl.update_dynamics_levels(UpdateType::LEAPFROG);
-    prim_advance_exp(tl,dt,false);
+  {
+    ScopedTimer timer_dyn("tl-s prim_advance_exp-loop");
+    prim_advance_exp(tl,dt,compute_diagnostics);
     tl.tevolve += dt;
+    for (int n=1; n<params.dt_tracer_factor; ++n) {
+      tl.update_dynamics_levels(UpdateType::LEAPFROG);
+      prim_advance_exp(tl,dt,false);
+      tl.tevolve += dt;
+    }
   }
-  GPTLstop("tl-s prim_advance_exp-loop");
 
   // ===============
   // Tracer Advection.
@@ -106,17 +106,17 @@ void prim_step (const Real dt, const bool compute_diagnostics)
   // Advect tracers if their count is > 0.
   // not be advected.  This will be cleaned up when the physgrid is merged into CAM trunk
   // Currently advecting all species
-  GPTLstart("tl-s prim_advec_tracers_remap");
-  if (params.qsize>0) {
-    prim_advec_tracers_remap(dt*params.dt_tracer_factor);
+  {
+    ScopedTimer timer_tracers("tl-s prim_advec_tracers_remap");
+    if (params.qsize>0) {
+      prim_advec_tracers_remap(dt*params.dt_tracer_factor);
+    }
   }
-  GPTLstop("tl-s prim_advec_tracers_remap");
-  GPTLstop("tl-s prim_step");
 }
 
 void prim_step_flexible (const Real dt, const bool compute_diagnostics) {
 #ifdef MODEL_THETA_L
-  GPTLstart("tl-s prim_step_flexible");
+  ScopedTimer timer("tl-s prim_step_flexible");
   const auto& context = Context::singleton();
   const SimulationParams& params = context.get<SimulationParams>();
   assert(params.params_set);
@@ -192,8 +192,6 @@ void prim_step_flexible (const Real dt, const bool compute_diagnostics) {
   // Remap tracers.
   if (params.qsize > 0)
     Context::singleton().get<ComposeTransport>().remap_q(tl);
-  
-  GPTLstop("tl-s prim_step_flexible");
 #else
   Errors::runtime_abort("prim_step_flexible not supported in non-theta-l builds.");
 #endif
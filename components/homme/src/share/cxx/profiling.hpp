@@ -50,4 +50,65 @@ extern "C" void moncontrol(int);
 
 #endif
 
+namespace Homme {
+
+// A GPTL timer that keeps the handle GPTL returns on the first start, so that
+// later start/stop calls do not need to hash the timer name. Each start/stop
+// pair also opens/closes a Kokkos profiling region with the same name (if a
+// Kokkos tool is loaded), so the same sections show up in Kokkos tools.
+//
+// GPTL handles are per thread, and are invalidated by GPTLfinalize. Hence, a
+// ProfilingTimer must only be used from one thread (as all HOMMEXX timers are,
+// since they are outside parallel regions), and should be a member of an
+// object that does not outlive GPTL (e.g., a functor), rather than a static.
+// The name is not copied, so it must outlive the timer (e.g., a literal).
+// The class is trivially copyable, so it can be a member of a Kokkos functor.
+class ProfilingTimer {
+public:
+  explicit ProfilingTimer (const char* name) : m_name(name), m_handle(nullptr) {}
+
+  void start () {
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::pushRegion(m_name);
+    }
+    GPTLstart_handle(m_name,&m_handle);
+  }
+
+  void stop () {
+    GPTLstop_handle(m_name,&m_handle);
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::popRegion();
+    }
+  }
+
+  const char* name () const { return m_name; }
+
+private:
+  const char* m_name;
+  void*       m_handle;
+};
+
+// Starts a timer on construction, and stops it on destruction. For sections
+// that run once per time step, the cost of looking up the timer by name is
+// negligible, so a name can be used in place of a ProfilingTimer.
+class ScopedTimer {
+public:
+  explicit ScopedTimer (ProfilingTimer& timer) : m_timer(timer), m_uncached(nullptr) {
+    m_timer.start();
+  }
+  explicit ScopedTimer (const char* name) : m_timer(m_uncached), m_uncached(name) {
+    m_timer.start();
+  }
+  ~ScopedTimer () { m_timer.stop(); }
+
+  ScopedTimer (const ScopedTimer&) = delete;
+  ScopedTimer& operator= (const ScopedTimer&) = delete;
+
+private:
+  ProfilingTimer& m_timer;
+  ProfilingTimer  m_uncached;
+};
+
+} // namespace Homme
+
 #endif // _PROFILING_HPP_
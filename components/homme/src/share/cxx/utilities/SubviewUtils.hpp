@@ -352,6 +352,61 @@ subview(ViewType<ScalarType ** [DIM1][DIM2][DIM3][DIM4], MemSpace,
     &v_in.impl_map().reference(ie, remap_idx, idim1, idim2, 0, 0));
 }
 
+template <typename ScalarType, int DIM1, int DIM2,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType[DIM1][DIM2], MemSpace>
+subview(ViewType<ScalarType ** [DIM1][DIM2], MemSpace,
+                 Properties...> v_in,
+        int ie, int idx) {
+  assert(v_in.data() != nullptr);
+  assert(ie < v_in.extent_int(0));
+  assert(ie >= 0);
+  assert(idx < v_in.extent_int(1));
+  assert(idx >= 0);
+  return ViewUnmanaged<ScalarType[DIM1][DIM2], MemSpace>(
+    &v_in.impl_map().reference(ie, idx, 0, 0));
+}
+
+// Views with three runtime dimensions (e.g., tracers qdp: elem, time level, tracer)
+
+template <typename ScalarType, int DIM1, int DIM2, int DIM3,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType[DIM1][DIM2][DIM3], MemSpace>
+subview(ViewType<ScalarType *** [DIM1][DIM2][DIM3], MemSpace,
+                 Properties...> v_in,
+        int ie, int idx1, int idx2) {
+  assert(v_in.data() != nullptr);
+  assert(ie < v_in.extent_int(0));
+  assert(ie >= 0);
+  assert(idx1 < v_in.extent_int(1));
+  assert(idx1 >= 0);
+  assert(idx2 < v_in.extent_int(2));
+  assert(idx2 >= 0);
+  return ViewUnmanaged<ScalarType[DIM1][DIM2][DIM3], MemSpace>(
+    &v_in.impl_map().reference(ie, idx1, idx2, 0, 0, 0));
+}
+
+template <typename ScalarType, int DIM1, int DIM2, int DIM3,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType[DIM3], MemSpace>
+subview(ViewType<ScalarType *** [DIM1][DIM2][DIM3], MemSpace,
+                 Properties...> v_in,
+        int ie, int idx1, int idx2, int idim1, int idim2) {
+  assert(v_in.data() != nullptr);
+  assert(ie < v_in.extent_int(0));
+  assert(ie >= 0);
+  assert(idx1 < v_in.extent_int(1));
+  assert(idx1 >= 0);
+  assert(idx2 < v_in.extent_int(2));
+  assert(idx2 >= 0);
+  assert(idim1 < v_in.extent_int(3));
+  assert(idim1 >= 0);
+  assert(idim2 < v_in.extent_int(4));
+  assert(idim2 >= 0);
+  return ViewUnmanaged<ScalarType[DIM3], MemSpace>(
+    &v_in.impl_map().reference(ie, idx1, idx2, idim1, idim2, 0));
+}
+
 // Force a subview to be const
 template<typename View, typename... Ints>
 KOKKOS_INLINE_FUNCTION
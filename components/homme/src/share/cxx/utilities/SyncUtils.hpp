@@ -248,7 +248,7 @@ sync_to_host(Source_T source, Dest_T dest)
 template <typename Source_T, typename Dest_T>
 typename std::enable_if
   <
-    (exec_view_mappable<Source_T, Scalar * [Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]>::value &&
+    (exec_view_mappable<Source_T, Scalar *** [NP][NP][NUM_LEV]>::value &&
      host_view_mappable<Dest_T, Real * [Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>::value),
     void
   >::type
@@ -257,8 +257,8 @@ sync_to_host(Source_T source, Dest_T dest)
   typename Source_T::HostMirror source_mirror = Kokkos::create_mirror_view(source);
   Kokkos::deep_copy(source_mirror, source);
   for (int ie = 0; ie < source.extent_int(0); ++ie) {
-    for (int time = 0; time < Q_NUM_TIME_LEVELS; ++time) {
-      for (int tracer = 0; tracer < QSIZE_D; ++tracer) {
+    for (int time = 0; time < source.extent_int(1); ++time) {
+      for (int tracer = 0; tracer < source.extent_int(2); ++tracer) {
         for (int level = 0; level < NUM_PHYSICAL_LEV; ++level) {
           const int ilev = level / VECTOR_SIZE;
           const int ivec = level % VECTOR_SIZE;
@@ -515,15 +515,15 @@ template <typename Source_T, typename Dest_T>
 typename std::enable_if
   <
     (host_view_mappable<Source_T,Real * [Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>::value &&
-     exec_view_mappable<Dest_T,Scalar * [Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]>::value),
+     exec_view_mappable<Dest_T,Scalar *** [NP][NP][NUM_LEV]>::value),
     void
   >::type
 sync_to_device(Source_T source, Dest_T dest)
 {
   typename Dest_T::HostMirror dest_mirror = Kokkos::create_mirror_view(dest);
   for (int ie = 0; ie < source.extent_int(0); ++ie) {
-    for (int q_tl = 0; q_tl < Q_NUM_TIME_LEVELS; ++q_tl) {
-      for (int q = 0; q < QSIZE_D; ++q) {
+    for (int q_tl = 0; q_tl < dest.extent_int(1); ++q_tl) {
+      for (int q = 0; q < dest.extent_int(2); ++q) {
         for (int level = 0; level < NUM_PHYSICAL_LEV; ++level) {
           const int ilev = level / VECTOR_SIZE;
           const int ivec = level % VECTOR_SIZE;
@@ -18,6 +18,7 @@
 #include "RKStageData.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "kokkos_utils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -120,6 +121,10 @@ struct CaarFunctorImpl {
 
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
+  ProfilingTimer m_compute_timer {"caar compute"};
+  ProfilingTimer m_bexch_timer   {"caar_bexchV"};
+  ProfilingTimer m_dp3d_timer    {"caar dp3d"};
+
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
                   const ReferenceElement &ref_FE, const HybridVCoord &hvcoord,
                   const SphereOperators &sphere_ops, const SimulationParams& params)
@@ -334,27 +339,29 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    Kokkos::parallel_for("caar loop pre-boundary exchange", m_policy_pre, *this);
-    ExecSpace::impl_static_fence();
-    GPTLstop("caar compute");
+    {
+      ScopedTimer timer(m_compute_timer);
+      tuned_parallel_for("caar loop pre-boundary exchange", m_policy_pre, *this);
+      ExecSpace::impl_static_fence();
+    }
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    ExecSpace::impl_static_fence();
-    GPTLstop("caar_bexchV");
+    {
+      ScopedTimer timer(m_bexch_timer);
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      ExecSpace::impl_static_fence();
+    }
 
     if (!m_theta_hydrostatic_mode) {
-      GPTLstart("caar compute");
+      ScopedTimer timer(m_compute_timer);
       Kokkos::parallel_for("caar loop post-boundary exchange", m_policy_post, *this);
       ExecSpace::impl_static_fence();
-      GPTLstop("caar compute");
     }
 
-    GPTLstart("caar dp3d");
-    Kokkos::parallel_for("caar loop dp3d limiter", m_policy_dp3d_lim, *this);
-    ExecSpace::impl_static_fence();
-    GPTLstop("caar dp3d");
+    {
+      ScopedTimer timer(m_dp3d_timer);
+      tuned_parallel_for("caar loop dp3d limiter", m_policy_dp3d_lim, *this);
+      ExecSpace::impl_static_fence();
+    }
 
     profiling_pause();
   }
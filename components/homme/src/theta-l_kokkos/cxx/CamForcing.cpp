@@ -18,16 +18,14 @@ namespace Homme {
 static void apply_cam_forcing_tracers(const Real dt, ForcingFunctor& ff,
                                       const TimeLevel& tl,
                                       const SimulationParams& p) {
-  GPTLstart("ApplyCAMForcing_tracers");
+  ScopedTimer timer("ApplyCAMForcing_tracers");
   ff.tracers_forcing(dt, tl.n0, tl.n0_qdp, false, p.moisture);
-  GPTLstop("ApplyCAMForcing_tracers"); 
 }
 
 static void apply_cam_forcing_dynamics(const Real dt, ForcingFunctor& ff,
                                        const TimeLevel& tl) {
-  GPTLstart("ApplyCAMForcing_dynamics");
+  ScopedTimer timer("ApplyCAMForcing_dynamics");
   ff.states_forcing(dt, tl.n0);
-  GPTLstop("ApplyCAMForcing_dynamics");
 }
 
 void apply_cam_forcing(const Real dt) {
@@ -49,6 +49,11 @@ void Diagnostics::init (const ElementsState& state, const ElementsGeometry& geom
   m_IEner  = decltype(m_IEner)("Internal  Energy", m_num_elems);
   m_KEner  = decltype(m_KEner)("Kinetic   Energy", m_num_elems);
   m_PEner  = decltype(m_PEner)("Potential Energy", m_num_elems);
+
+  m_Qvar    = decltype(m_Qvar)("Tracers qdp*Q", m_num_elems);
+  m_Qmass   = decltype(m_Qmass)("Tracers mass", m_num_elems);
+  m_Qvar_h  = Kokkos::create_mirror_view(m_Qvar);
+  m_Qmass_h = Kokkos::create_mirror_view(m_Qmass);
 }
 
 int Diagnostics::requested_buffer_size () const {
@@ -98,53 +103,33 @@ void Diagnostics::sync_diags_to_host () {
 
 void Diagnostics::run_diagnostics (const bool before_advance, const int ivar)
 {
-  prim_diag_scalars(before_advance, ivar);
+  // The tracers integrals are computed in the same kernel as the energies,
+  // so prim_energy_halftimes must run first
   prim_energy_halftimes(before_advance, ivar);
+  prim_diag_scalars(before_advance, ivar);
 }
 
-void Diagnostics::prim_diag_scalars (const bool before_advance, const int ivar)
+void Diagnostics::prim_diag_scalars (const bool /* before_advance */, const int ivar)
 {
-  // Get simulation params
-  SimulationParams& params = Context::singleton().get<SimulationParams>();
-  assert(params.params_set);
-
-  // Get time info
-  TimeLevel& tl = Context::singleton().get<TimeLevel>();
-
-  // Make sure tracers timelevels are updated
-  tl.update_tracers_levels(params.dt_tracer_factor);
-
-  // Pick tracers time-level, depending on when this routine was called
-  int t2_qdp;
-  if (before_advance) {
-    t2_qdp = tl.n0_qdp;
-  } else {
-    t2_qdp = tl.np1_qdp;
-  }
+  // Note: the tracers integrals were computed on device by prim_energy_halftimes,
+  //       at the same tracers time level and for the same ivar
+  assert (ivar==m_ivar);
 
   const Tracers& tracers = Context::singleton().get<Tracers>();
 
   sync_to_host(tracers.Q,h_Q);
 
-  // Copy back tracers concentration and mass
-  auto qdp_h = Kokkos::create_mirror_view(tracers.qdp);
-  Kokkos::deep_copy(qdp_h,tracers.qdp);
+  // Copy back only the (small) vertically integrated quantities
+  Kokkos::deep_copy(m_Qvar_h, m_Qvar);
+  Kokkos::deep_copy(m_Qmass_h, m_Qmass);
   for (int ie=0; ie<m_num_elems; ++ie) {
-    for (int iq=0; iq<params.qsize; ++iq) {
+    for (int iq=0; iq<m_qsize; ++iq) {
       for (int igp=0; igp<NP; ++igp) {
         for (int jgp=0; jgp<NP; ++jgp) {
-          Real accum_qdp_q = 0;
-          Real accum_qdp = 0;
-
-          HostViewUnmanaged<Real[NUM_PHYSICAL_LEV]> qdp(&qdp_h(ie, t2_qdp, iq, igp, jgp, 0)[0]);
-          for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
-            accum_qdp_q += qdp(level)*h_Q(ie, iq, level, igp, jgp);
-            accum_qdp   += qdp(level);
-          }
-          h_Qvar(ie, ivar, iq, igp, jgp) = accum_qdp_q;
-
-          h_Qmass(ie, ivar, iq, igp, jgp) = accum_qdp;
-          h_Q1mass(ie, iq, igp, jgp) = accum_qdp;
+          h_Qvar(ie, ivar, iq, igp, jgp) = m_Qvar_h(ie, iq, igp, jgp);
+
+          h_Qmass(ie, ivar, iq, igp, jgp) = m_Qmass_h(ie, iq, igp, jgp);
+          h_Q1mass(ie, iq, igp, jgp) = m_Qmass_h(ie, iq, igp, jgp);
         }
       }
     }
@@ -174,6 +159,12 @@ void Diagnostics::prim_energy_halftimes (const bool before_advance, const int iv
     t1_qdp = tl.np1_qdp;
   }
 
+  // Tracers integrals are computed in the same pass (see prim_diag_scalars)
+  const Tracers& tracers = Context::singleton().get<Tracers>();
+  m_qsize = params.qsize;
+  m_qdp   = tracers.qdp;
+  m_Q     = tracers.Q;
+
   Kokkos::parallel_for(m_policy, *this);
 
   Kokkos::deep_copy(h_KEner, m_KEner);
@@ -40,6 +40,7 @@ public:
   Diagnostics (const int num_elems, const bool theta_hydrostatic_mode) :
     m_policy(Homme::get_default_team_policy<ExecSpace,EnergyHalfTimesTag>(num_elems)),
     m_tu(m_policy),
+    m_qsize(0),
     m_num_elems(num_elems),
     m_theta_hydrostatic_mode(theta_hydrostatic_mode)
   {}
@@ -169,6 +170,22 @@ public:
       },sum);
 
       IEner = sum.v[0] + sum.v[1] + pnh_real(0)*pnh_real(0);
+
+      // Compute the vertical integrals of qdp*Q and qdp for the active tracers,
+      // so that the whole qdp view never needs to be copied to host
+      for (int iq=0; iq<m_qsize; ++iq) {
+        auto qdp = viewAsReal(Homme::subview(m_qdp,kv.ie,t1_qdp,iq,igp,jgp));
+        auto q   = viewAsReal(Homme::subview(m_Q,kv.ie,iq,igp,jgp));
+        Kokkos::Real2 qsum;
+        Dispatch<>::parallel_reduce(kv.team,Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                                    [=](const int ilev, Kokkos::Real2& accumulator){
+          accumulator.v[0] += qdp(ilev)*q(ilev);
+          accumulator.v[1] += qdp(ilev);
+        },qsum);
+
+        m_Qvar(kv.ie,iq,igp,jgp)  = qsum.v[0];
+        m_Qmass(kv.ie,iq,igp,jgp) = qsum.v[1];
+      }
     });
   }
 
@@ -189,6 +206,15 @@ private:
   ExecViewManaged<Real*[NUM_DIAG_TIMES][NP][NP]>   m_KEner;
   ExecViewManaged<Real*[NUM_DIAG_TIMES][NP][NP]>   m_PEner;
 
+  // Tracers integrals at the time level being diagnosed (only the first m_qsize are computed)
+  ExecViewManaged<Real*[QSIZE_D][NP][NP]>          m_Qvar;
+  ExecViewManaged<Real*[QSIZE_D][NP][NP]>          m_Qmass;
+  ExecViewManaged<Real*[QSIZE_D][NP][NP]>::HostMirror  m_Qvar_h;
+  ExecViewManaged<Real*[QSIZE_D][NP][NP]>::HostMirror  m_Qmass_h;
+
+  ExecViewUnmanaged<Scalar***[NP][NP][NUM_LEV]>  m_qdp;
+  ExecViewUnmanaged<Scalar**[NP][NP][NUM_LEV]>   m_Q;
+
   HybridVCoord      m_hvcoord;
   EquationOfState   m_eos;
   ElementOps        m_elem_ops;
@@ -200,6 +226,7 @@ private:
   TeamUtils<ExecSpace> m_tu;
 
   int t1,t1_qdp;
+  int m_qsize;
 
   int m_ivar;
   int m_num_elems;
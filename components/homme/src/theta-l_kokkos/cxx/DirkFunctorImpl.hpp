@@ -15,6 +15,7 @@
 #include "KernelVariables.hpp"
 #include "PhysicalConstants.hpp"
 #include "ElementOps.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "profiling.hpp"
 #include "ErrorDefs.hpp"
 #include "utilities/scream_tridiag.hpp"
@@ -201,7 +202,7 @@ struct DirkFunctorImpl {
       };
       parallel_for(Kokkos::TeamThreadRange(kv.team, NP*NP), f);
     };
-    Kokkos::parallel_for(m_ig_policy, toplevel);
+    tuned_parallel_for("dirk initial guess", m_ig_policy, toplevel);
   }
 
   void run_newton (int nm1, Real alphadt_nm1, int n0, Real alphadt_n0, int np1, Real dt2,
@@ -395,7 +396,7 @@ struct DirkFunctorImpl {
       transpose(kv, nlev+1, w_np1,   subview(e_w_i    ,ie,np1,a,a,a));
     };
 
-    Kokkos::parallel_for(m_policy, toplevel);
+    tuned_parallel_for("dirk newton", m_policy, toplevel);
   }
 
   template <typename Fn>
@@ -8,6 +8,7 @@
 
 #include "Context.hpp"
 #include "FunctorsBuffersManager.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "profiling.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -67,6 +68,8 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
   // Sanity check
   assert(params.params_set);
 
+  // Number of level packs (from the top) where nu_scale_top is nonzero
+  m_num_tom_packs = 0;
   if (m_data.nu_top>0) {
 
     m_nu_scale_top = ExecViewManaged<Scalar[NUM_LEV]>("nu_scale_top");
@@ -102,8 +105,8 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
       if ( val < 0.15 ) val = 0.0;
       h_nu_scale_top(ilev)[ivec] = val;
 
-      //set nlev_tom here for the future
-      //if (val > 0.0) nlev_tom = phys_lev;
+      // The sponge layer is at the top, so the nonzero entries are contiguous from ilev=0
+      if (val > 0.0) m_num_tom_packs = ilev+1;
 
     }
     Kokkos::deep_copy(m_nu_scale_top, h_nu_scale_top);
@@ -215,6 +218,27 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
   }
   m_be->register_field(m_buffers.vtens, 2, 0);
   m_be->registration_completed();
+
+  // The tom subcycle only modifies the sponge layer levels (the tendencies are scaled
+  // by nu_scale_top, which is zero below), so only exchange those level packs
+  if (m_data.hypervis_subcycle_tom>0 && m_num_tom_packs>0) {
+    m_be_tom = std::make_shared<BoundaryExchange>();
+    m_be_tom->set_buffers_manager(bm_exchange);
+    if (m_process_nh_vars) {
+      m_be_tom->set_num_fields(0, 0, 6);
+    } else {
+      m_be_tom->set_num_fields(0, 0, 4);
+    }
+    m_be_tom->set_3d_level_range(0, m_num_tom_packs);
+    m_be_tom->register_field(m_buffers.dptens);
+    m_be_tom->register_field(m_buffers.ttens);
+    if (m_process_nh_vars) {
+      m_be_tom->register_field(m_buffers.wtens);
+      m_be_tom->register_field(m_buffers.phitens);
+    }
+    m_be_tom->register_field(m_buffers.vtens, 2, 0);
+    m_be_tom->registration_completed();
+  }
 }//initBE
 
 void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real eta_ave_w)
@@ -258,21 +282,23 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   Kokkos::fence();
 
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
-    GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
+    {
+      ScopedTimer timer(m_bhwk_timer);
+      biharmonic_wk_theta ();
+    }
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    tuned_parallel_for("hvf pre-exchange", m_policy_pre_exchange, *this);
     Kokkos::fence();
 
     // Exchange
     assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    {
+      ScopedTimer timer(m_bexch_timer);
+      m_be->exchange();
+    }
 
     // Update states
-    Kokkos::parallel_for(m_policy_update_states, *this);
+    tuned_parallel_for("hvf update states", m_policy_update_states, *this);
     Kokkos::fence();
   } //subcycle
 
@@ -331,13 +357,15 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     Kokkos::parallel_for(m_policy_nutop_laplace, *this);
     Kokkos::fence();
 
-    //exchange is done on ttens, dptens, vtens, etc.
+    //exchange is done on ttens, dptens, vtens, etc.,
+    //restricted to the sponge layer levels (if m_be_tom was set up)
     ///? do another timer or the same for all mpi in HV?
-    ///exchange on a subset of levels in future? 
-    assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    const auto& be_tom = m_be_tom ? m_be_tom : m_be;
+    assert (be_tom->is_registration_completed());
+    {
+      ScopedTimer timer(m_bexch_timer);
+      be_tom->exchange();
+    }
 
     Kokkos::parallel_for(m_policy_update_states2, *this);
     Kokkos::fence();
@@ -349,23 +377,24 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
+  tuned_parallel_for("hvf first laplace", m_policy_first_laplace, *this);
   Kokkos::fence();
 
   // Exchange
   assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  {
+    ScopedTimer timer(m_bexch_timer);
+    m_be->exchange(m_geometry.m_rspheremp);
+  }
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
   if ( m_data.consthv ) {
     auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHV>(ne);
-    Kokkos::parallel_for(policy, *this);
+    tuned_parallel_for("hvf second laplace const", policy, *this);
   }else{
     auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne);
-    Kokkos::parallel_for(policy, *this);
+    tuned_parallel_for("hvf second laplace tensor", policy, *this);
   }
   Kokkos::fence();
 } //biharmonic
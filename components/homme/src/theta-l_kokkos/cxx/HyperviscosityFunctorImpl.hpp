@@ -538,8 +538,15 @@ protected:
   TeamUtils<ExecSpace> m_tu; // If the policies only differ by tag, just need one tu
 
   std::shared_ptr<BoundaryExchange> m_be;
+  // Exchanges only the sponge layer level packs, for the tom subcycle
+  std::shared_ptr<BoundaryExchange> m_be_tom;
+
+  // Mutable, since biharmonic_wk_theta is const
+  mutable ProfilingTimer m_bhwk_timer  {"hvf-bhwk"};
+  mutable ProfilingTimer m_bexch_timer {"hvf-bexch"};
 
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
+  int m_num_tom_packs;
 }; //HVfunctorImpl
 
 } // namespace Homme
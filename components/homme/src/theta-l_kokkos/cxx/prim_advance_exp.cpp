@@ -31,7 +31,7 @@ void imex_KG255_timestep(const TimeLevel& tl, const Real dt, const Real eta_ave_
 
 void prim_advance_exp (TimeLevel& tl, const Real dt, const bool compute_diagnostics)
 {
-  GPTLstart("tl-ae prim_advance_exp");
+  ScopedTimer timer("tl-ae prim_advance_exp");
 
 #ifdef ARKODE
   Errors::runtime_abort("'ARKODE' support not yet available in C++ build.\n",
@@ -116,9 +116,8 @@ void prim_advance_exp (TimeLevel& tl, const Real dt, const bool compute_diagnost
 //// case nu=0 but nu_top>0?  
   if (params.hypervis_order==2 && params.nu>0) {
     HyperviscosityFunctor& functor = context.get<HyperviscosityFunctor>();
-    GPTLstart("tl-ae advance_hypervis_dp");
+    ScopedTimer timer_hv("tl-ae advance_hypervis_dp");
     functor.run(tl.np1,dt,eta_ave_w);
-    GPTLstop("tl-ae advance_hypervis_dp");
   }
 
   if (params.dcmip16_mu>0) {
@@ -130,8 +129,6 @@ void prim_advance_exp (TimeLevel& tl, const Real dt, const bool compute_diagnost
     auto& diags = context.get<Diagnostics>();
     diags.run_diagnostics(false,5);
   }
-
-  GPTLstop("tl-ae prim_advance_exp");
 }
 
 // Implementations of timestep schemes, in terms of CaarFunctor runs
@@ -154,7 +151,7 @@ void imex_KG254_explicit_timestep(const TimeLevel& /* tl */,
 
 void u3_5stage_timestep(const TimeLevel& tl, const Real dt, const Real eta_ave_w)
 {
-  GPTLstart("tl-ae U3-5stage_timestep");
+  ScopedTimer timer("tl-ae U3-5stage_timestep");
   // Get elements structure
   Elements& elements = Context::singleton().get<Elements>();
   SimulationParams& params = Context::singleton().get<SimulationParams>();
@@ -223,7 +220,6 @@ void u3_5stage_timestep(const TimeLevel& tl, const Real dt, const Real eta_ave_w
 
   // Stage 5: u5 = (5u1-u0)/4 + 3dt/4 RHS(u4), t_rhs = t + dt/5 + dt/5 + dt/3 + 2dt/3
   functor.run(RKStageData(nm1, np1, np1, qn0, 3.0*dt/4.0, 3.0*eta_ave_w/4.0));
-  GPTLstop("tl-ae U3-5stage_timestep");
 }
 
 void imex_KG243_timestep(const TimeLevel& /* tl */,
@@ -247,7 +243,7 @@ void imex_KG255_timestep(const TimeLevel& tl,
                          const Real dt_dyn,
                          const Real eta_ave_w)
 {
-  GPTLstart("IMEX_KG255");
+  ScopedTimer timer("IMEX_KG255");
 
   // The context
   const auto& c = Context::singleton();
@@ -303,8 +299,6 @@ void imex_KG255_timestep(const TimeLevel& tl,
 
   caar.run(RKStageData(n0, np1, np1, qn0, dt, eta_ave_w, 1.0, 0.0, 1.0));
   dirk.run(nm1, a2*dt, n0, a1*dt, np1, a3*dt, elements, hvcoord);
-
-  GPTLstop("IMEX_KG255");
 }
 
 } // namespace Homme
@@ -96,6 +96,13 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]>::HostMirror field_3d_cxx_host;
   field_3d_cxx_host = Kokkos::create_mirror_view(field_3d_cxx);
 
+  // A copy of the 3d field, exchanged only on the level packs [lev_beg,lev_end)
+  const int lev_beg = NUM_LEV>1 ? 1 : 0;
+  const int lev_end = NUM_LEV>2 ? NUM_LEV-1 : NUM_LEV;
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]> field_3d_lr_cxx ("", num_elements);
+  ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]>::HostMirror field_3d_lr_cxx_host;
+  field_3d_lr_cxx_host = Kokkos::create_mirror_view(field_3d_lr_cxx);
+
   HostViewManaged<Real*[NUM_TIME_LEVELS][DIM][NUM_PHYSICAL_LEV][NP][NP]> field_4d_f90 ("", num_elements);
   ExecViewManaged<Scalar*[NUM_TIME_LEVELS][DIM][NP][NP][NUM_LEV]> field_4d_cxx ("", num_elements);
   ExecViewManaged<Scalar*[NUM_TIME_LEVELS][DIM][NP][NP][NUM_LEV]>::HostMirror field_4d_cxx_host;
@@ -115,6 +122,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   std::shared_ptr<BoundaryExchange> be1 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be2 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
   std::shared_ptr<BoundaryExchange> be3 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager_min_max);
+  std::shared_ptr<BoundaryExchange> be4 = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
 
   // Setup the be objects
   be1->set_num_fields(0,num_scalar_fields_2d,DIM*num_vector_fields_3d);
@@ -131,6 +139,12 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
+  be4->set_num_fields(0,0,num_scalar_fields_3d);
+  be4->set_3d_level_range(lev_beg,lev_end);
+  be4->register_field(field_3d_lr_cxx,1,field_3d_idim);
+  be4->registration_completed();
+  REQUIRE(be4->get_num_3d_levels()==lev_end-lev_beg);
+
   for (int itest=0; itest<num_tests; ++itest)
   {
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
@@ -172,6 +186,7 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
               field_3d_cxx_host(ie,itl,igp,jgp,ilev)[ivec] = field_3d_f90(ie,itl,level,igp,jgp);
     }}}}}
     Kokkos::deep_copy(field_3d_cxx, field_3d_cxx_host);
+    Kokkos::deep_copy(field_3d_lr_cxx, field_3d_cxx_host);
 
     genRandArray(field_3d_int_f90,engine,dreal);
     for (int ie=0; ie<num_elements; ++ie) {
@@ -216,6 +231,23 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be2->recv_and_unpack();
       be3->recv_and_unpack_min_max();
     }
+    be4->exchange();
+
+    // Note: field_3d_cxx_host still stores the input values, which the levels outside the range must retain
+    Kokkos::deep_copy(field_3d_lr_cxx_host, field_3d_lr_cxx);
+    // The level-range exchange must match the full one inside the range, and leave the rest untouched
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+        for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
+          const int ilev = level / VECTOR_SIZE;
+          const int ivec = level % VECTOR_SIZE;
+          for (int igp=0; igp<NP; ++igp) {
+            for (int jgp=0; jgp<NP; ++jgp) {
+              const Real expected = (ilev>=lev_beg && ilev<lev_end) ? field_3d_f90(ie,itl,level,igp,jgp)
+                                                                    : field_3d_cxx_host(ie,itl,igp,jgp,ilev)[ivec];
+              REQUIRE(compare_answers(expected,field_3d_lr_cxx_host(ie,itl,igp,jgp,ilev)[ivec]) < test_tolerance);
+    }}}}}
+
     Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
     Kokkos::deep_copy(field_2d_cxx_host,     field_2d_cxx);
     Kokkos::deep_copy(field_3d_cxx_host,     field_3d_cxx);
@@ -306,4 +338,5 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be1->clean_up();
   be2->clean_up();
   be3->clean_up();
+  be4->clean_up();
 }
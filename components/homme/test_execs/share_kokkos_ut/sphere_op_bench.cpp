@@ -0,0 +1,393 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+// Standalone microbenchmark of the multi-level SphereOperators.
+//
+// Each operator is timed over all elements for a list of nelemd values and
+// team shapes, and the achieved memory bandwidth and flop rate are reported
+// next to the bandwidth of a STREAM-like triad measured on the same execution
+// space. The byte and flop counts are those of an ideal implementation: each
+// input/output field is moved to/from memory exactly once per call, and the
+// per-element geometry is read once per element. Temporaries staged in the
+// SphereOperators buffers are assumed to stay in cache. Hence, %STREAM is an
+// estimate of how close an operator is to the memory roofline.
+//
+// Usage:
+//   sphere_op_bench [-ne <nelemd>[,<nelemd>...]] [-nr <nrep>]
+//                   [-ts <threads>x<vectors>[,...]] [-sn <stream length>]
+// If -ts is not given, only the default team policy is timed. On host, the
+// number of vectors is ignored by Kokkos.
+
+#include "Context.hpp"
+#include "Dimensions.hpp"
+#include "ExecSpaceDefs.hpp"
+#include "Hommexx_Session.hpp"
+#include "KernelVariables.hpp"
+#include "SphereOperators.hpp"
+#include "Types.hpp"
+#include "mpi/Comm.hpp"
+#include "utilities/SubviewUtils.hpp"
+#include "utilities/TestUtils.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Homme;
+
+namespace {
+
+using rngAlg = std::mt19937_64;
+
+// Ideal traffic and work of an operator. Field words are counted per level
+// point, geometry words per gauss point, and flops per level point are
+// flops_np*NP + flops_fixed (dvv contractions are NP-long dot products).
+struct OpModel {
+  const char* name;
+  int field_words;
+  int geo_words;
+  int flops_np;
+  int flops_fixed;
+};
+
+class SphereOpBench {
+public:
+
+  struct TagGradient {};
+  struct TagDivergence {};
+  struct TagDivergenceWk {};
+  struct TagVorticity {};
+  struct TagLaplaceSimple {};
+  struct TagLaplaceTensor {};
+
+  SphereOpBench (const int num_elems, rngAlg& engine)
+   : m_num_elems (num_elems)
+   , scalar_in  ("scalar in",  num_elems)
+   , scalar_out ("scalar out", num_elems)
+   , u_in       ("u in",       num_elems)
+   , v_in       ("v in",       num_elems)
+   , vector_in  ("vector in",  num_elems)
+   , vector_out ("vector out", num_elems)
+   , tensor     ("tensor",     num_elems)
+  {
+    std::uniform_real_distribution<Real> field_pdf(-1.0,1.0);
+    std::uniform_real_distribution<Real> pos_pdf(0.5,2.0);
+    std::uniform_real_distribution<Real> angle_pdf(0.0,2*M_PI);
+
+    fill(scalar_in,engine,field_pdf);
+    fill(u_in,engine,field_pdf);
+    fill(v_in,engine,field_pdf);
+    fill(vector_in,engine,field_pdf);
+    fill(tensor,engine,field_pdf);
+
+    // divergence_sphere_wk overwrites its input with D^{-T}v, so we use
+    // rotations for D and D^{-1}: repeated calls then preserve the magnitude
+    // of the data, and the timings are not polluted by overflow or denormals.
+    ExecViewManaged<Real * [2][2][NP][NP]> d      ("D",      num_elems);
+    ExecViewManaged<Real * [2][2][NP][NP]> dinv   ("Dinv",   num_elems);
+    ExecViewManaged<Real * [2][2][NP][NP]> metinv ("metinv", num_elems);
+    ExecViewManaged<Real *       [NP][NP]> metdet ("metdet", num_elems);
+    ExecViewManaged<Real *       [NP][NP]> spheremp ("spheremp", num_elems);
+    ExecViewManaged<Real             [NP][NP]> mp  ("mp");
+    ExecViewManaged<Real             [NP][NP]> dvv ("dvv");
+    auto d_h      = Kokkos::create_mirror_view(d);
+    auto dinv_h   = Kokkos::create_mirror_view(dinv);
+    auto metinv_h = Kokkos::create_mirror_view(metinv);
+    for (int ie=0; ie<num_elems; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          const Real a = angle_pdf(engine);
+          const Real c = std::cos(a), s = std::sin(a);
+          d_h(ie,0,0,igp,jgp) =  c; d_h(ie,0,1,igp,jgp) = -s;
+          d_h(ie,1,0,igp,jgp) =  s; d_h(ie,1,1,igp,jgp) =  c;
+          dinv_h(ie,0,0,igp,jgp) =  c; dinv_h(ie,0,1,igp,jgp) = s;
+          dinv_h(ie,1,0,igp,jgp) = -s; dinv_h(ie,1,1,igp,jgp) = c;
+          metinv_h(ie,0,0,igp,jgp) = metinv_h(ie,1,1,igp,jgp) = 1.0;
+          metinv_h(ie,0,1,igp,jgp) = metinv_h(ie,1,0,igp,jgp) = 0.0;
+        }
+      }
+    }
+    Kokkos::deep_copy(d,d_h);
+    Kokkos::deep_copy(dinv,dinv_h);
+    Kokkos::deep_copy(metinv,metinv_h);
+    fill(metdet,engine,pos_pdf);
+    fill(spheremp,engine,pos_pdf);
+    fill(mp,engine,pos_pdf);
+    fill(dvv,engine,field_pdf);
+
+    sphere_ops.set_views(dvv,d,dinv,metinv,metdet,spheremp,mp);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagGradient&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.gradient_sphere(kv,
+                               Homme::subview(scalar_in,kv.ie),
+                               Homme::subview(vector_out,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagDivergence&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.divergence_sphere(kv,
+                                 Homme::subview(vector_in,kv.ie),
+                                 Homme::subview(scalar_out,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagDivergenceWk&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.divergence_sphere_wk(kv,
+                                    Homme::subview(vector_in,kv.ie),
+                                    Homme::subview(scalar_out,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagVorticity&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.vorticity_sphere(kv,
+                                Homme::subview(u_in,kv.ie),
+                                Homme::subview(v_in,kv.ie),
+                                Homme::subview(scalar_out,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagLaplaceSimple&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.laplace_simple(kv,
+                              Homme::subview(scalar_in,kv.ie),
+                              Homme::subview(scalar_out,kv.ie));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagLaplaceTensor&, const TeamMember& team) const {
+    KernelVariables kv(team);
+    sphere_ops.laplace_tensor(kv,
+                              Homme::subview(tensor,kv.ie),
+                              Homme::subview(scalar_in,kv.ie),
+                              Homme::subview(scalar_out,kv.ie));
+  }
+
+  // Average time (in seconds) of one call over all elements, or a negative
+  // number if the requested shape cannot be used for this kernel.
+  template<typename Tag>
+  double time_op (const std::pair<int,int>& shape, const int nrep) {
+    using policy_type = Kokkos::TeamPolicy<ExecSpace,Tag>;
+    policy_type policy = Homme::get_default_team_policy<ExecSpace,Tag>(m_num_elems);
+    if (shape.first>0) {
+      const policy_type p(m_num_elems,1,shape.second);
+      if (shape.first>p.team_size_max(*this,Kokkos::ParallelForTag())) {
+        return -1.0;
+      }
+      policy = policy_type(m_num_elems,shape.first,shape.second);
+    }
+    sphere_ops.allocate_buffers(policy);
+
+    // One untimed call, to take first-touch and launch overheads out.
+    Kokkos::parallel_for(policy,*this);
+    Kokkos::fence();
+
+    Kokkos::Timer timer;
+    for (int irep=0; irep<nrep; ++irep) {
+      Kokkos::parallel_for(policy,*this);
+    }
+    Kokkos::fence();
+    return timer.seconds()/nrep;
+  }
+
+  int m_num_elems;
+
+  ExecViewManaged<Scalar *    [NP][NP][NUM_LEV]>  scalar_in;
+  ExecViewManaged<Scalar *    [NP][NP][NUM_LEV]>  scalar_out;
+  ExecViewManaged<Scalar *    [NP][NP][NUM_LEV]>  u_in;
+  ExecViewManaged<Scalar *    [NP][NP][NUM_LEV]>  v_in;
+  ExecViewManaged<Scalar * [2][NP][NP][NUM_LEV]>  vector_in;
+  ExecViewManaged<Scalar * [2][NP][NP][NUM_LEV]>  vector_out;
+  ExecViewManaged<Real   * [2][2][NP][NP]>        tensor;
+
+  SphereOperators sphere_ops;
+
+private:
+
+  template<typename ViewType, typename PDF>
+  static void fill (const ViewType& v, rngAlg& engine, PDF&& pdf) {
+    auto v_h = Kokkos::create_mirror_view(v);
+    genRandArray(v_h.data(),v_h.size(),engine,pdf);
+    Kokkos::deep_copy(v,v_h);
+  }
+};
+
+// Best-of-nrep bandwidth (in GB/s) of a(i) = b(i) + s*c(i), counting
+// three words per entry (no write-allocate traffic), as STREAM does.
+double stream_triad_bandwidth (const int length, const int nrep) {
+  ExecViewManaged<Real*> a("a",length), b("b",length), c("c",length);
+  Kokkos::deep_copy(b,1.0);
+  Kokkos::deep_copy(c,2.0);
+  const Real s = 3.0;
+
+  double best = 0;
+  for (int irep=0; irep<=nrep; ++irep) {
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    Kokkos::parallel_for("stream triad",Kokkos::RangePolicy<ExecSpace>(0,length),
+                         KOKKOS_LAMBDA(const int i) {
+      a(i) = b(i) + s*c(i);
+    });
+    Kokkos::fence();
+    const double t = timer.seconds();
+    // The first iteration is a warm up.
+    if (irep>0 && (best==0 || t<best)) {
+      best = t;
+    }
+  }
+  return 3.0*sizeof(Real)*length/best*1e-9;
+}
+
+std::vector<int> parse_int_list (const std::string& s) {
+  std::vector<int> v;
+  std::stringstream ss(s);
+  std::string item;
+  while (std::getline(ss,item,',')) {
+    v.push_back(std::atoi(item.c_str()));
+  }
+  return v;
+}
+
+// Parses "16x8,4x32" into {(16,8),(4,32)}.
+std::vector<std::pair<int,int>> parse_shapes (const std::string& s) {
+  std::vector<std::pair<int,int>> shapes;
+  std::stringstream ss(s);
+  std::string item;
+  while (std::getline(ss,item,',')) {
+    const auto pos = item.find('x');
+    Errors::runtime_check(pos!=std::string::npos,
+        "Error! Invalid team shape '" + item + "'. Expected <threads>x<vectors>.\n");
+    shapes.emplace_back(std::atoi(item.substr(0,pos).c_str()),
+                        std::atoi(item.substr(pos+1).c_str()));
+  }
+  return shapes;
+}
+
+template<typename Tag>
+void bench_op (SphereOpBench& bench, const OpModel& model,
+               const std::pair<int,int>& shape, const int nrep,
+               const double stream_bw)
+{
+  const double t = bench.time_op<Tag>(shape,nrep);
+  if (!Context::singleton().get<Comm>().root()) {
+    return;
+  }
+
+  std::stringstream shape_str;
+  if (shape.first>0) {
+    shape_str << shape.first << "x" << shape.second;
+  } else {
+    shape_str << "default";
+  }
+
+  if (t<0) {
+    std::printf("%8d  %-9s  %-20s  %s\n",bench.m_num_elems,shape_str.str().c_str(),
+                model.name,"(team size too large, skipped)");
+    return;
+  }
+
+  // Packs may contain padding levels: those are computed anyway, so count them.
+  const double npts_lev = static_cast<double>(NP*NP*NUM_LEV*VECTOR_SIZE);
+  const double bytes = bench.m_num_elems*sizeof(Real)*
+                       (model.field_words*npts_lev + model.geo_words*NP*NP);
+  const double flops = bench.m_num_elems*npts_lev*
+                       (model.flops_np*NP + model.flops_fixed);
+  const double gbs = bytes/t*1e-9;
+  const double gflops = flops/t*1e-9;
+  const double ai = flops/bytes;
+
+  std::printf("%8d  %-9s  %-20s  %11.4f  %8.2f  %8.2f  %6.2f  %8.2f  %6.1f\n",
+              bench.m_num_elems,shape_str.str().c_str(),model.name,t*1e3,
+              gbs,gflops,ai,ai*stream_bw,100.0*gbs/stream_bw);
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  MPI_Init(&argc,&argv);
+  Context::singleton().create<Comm>().reset_mpi_comm(MPI_COMM_WORLD);
+  initialize_hommexx_session();
+
+  std::vector<int> nelemds = {96, 384, 1350};
+  std::vector<std::pair<int,int>> shapes = {{0,0}};
+  int nrep = 20;
+  int stream_length = 1<<25;
+  for (int i=1; i<argc; ++i) {
+    const std::string arg = argv[i];
+    Errors::runtime_check(i+1<argc, "Error! Missing value for option '" + arg + "'.\n");
+    const std::string val = argv[++i];
+    if (arg=="-ne") {
+      nelemds = parse_int_list(val);
+    } else if (arg=="-nr") {
+      nrep = std::atoi(val.c_str());
+    } else if (arg=="-ts") {
+      shapes = parse_shapes(val);
+    } else if (arg=="-sn") {
+      stream_length = std::atoi(val.c_str());
+    } else {
+      Errors::runtime_abort("Error! Unrecognized option '" + arg + "'.\n"
+                            "Usage: sphere_op_bench [-ne <nelemd>[,...]] [-nr <nrep>]"
+                            " [-ts <threads>x<vectors>[,...]] [-sn <stream length>]\n");
+    }
+  }
+  Errors::runtime_check(nrep>0 && stream_length>0,
+                        "Error! Number of repetitions and stream length must be positive.\n");
+
+  const bool root = Context::singleton().get<Comm>().root();
+
+  // 2*NP flops for each of the dvv dot products, plus the pointwise metric terms.
+  const OpModel gradient      {"gradient_sphere",      3, 4,  4,  8};
+  const OpModel divergence    {"divergence_sphere",    3, 5,  4, 12};
+  const OpModel divergence_wk {"divergence_sphere_wk", 5, 5,  7,  6};
+  const OpModel vorticity     {"vorticity_sphere",     3, 5,  4,  9};
+  const OpModel laplace       {"laplace_simple",       2, 5, 11, 14};
+  const OpModel laplace_tens  {"laplace_tensor",       2, 9, 11, 20};
+
+  const double stream_bw = stream_triad_bandwidth(stream_length,nrep);
+
+  if (root) {
+    std::printf("SphereOperators benchmark on %s (concurrency %d)\n",
+                ExecSpace::name(),ExecSpace::concurrency());
+    std::printf("NP = %d, NUM_PHYSICAL_LEV = %d, NUM_LEV = %d, VECTOR_SIZE = %d, nrep = %d\n",
+                NP,NUM_PHYSICAL_LEV,NUM_LEV,VECTOR_SIZE,nrep);
+    std::printf("STREAM triad (%d entries): %.2f GB/s\n\n",stream_length,stream_bw);
+    std::printf("%8s  %-9s  %-20s  %11s  %8s  %8s  %6s  %8s  %6s\n",
+                "nelemd","shape","operator","time [ms]","GB/s","GFlop/s",
+                "AI","roof GF","%STRM");
+  }
+
+  rngAlg engine(std::random_device{}());
+  for (const int nelemd : nelemds) {
+    SphereOpBench bench(nelemd,engine);
+    for (const auto& shape : shapes) {
+      bench_op<SphereOpBench::TagGradient>     (bench,gradient,     shape,nrep,stream_bw);
+      bench_op<SphereOpBench::TagDivergence>   (bench,divergence,   shape,nrep,stream_bw);
+      bench_op<SphereOpBench::TagDivergenceWk> (bench,divergence_wk,shape,nrep,stream_bw);
+      bench_op<SphereOpBench::TagVorticity>    (bench,vorticity,    shape,nrep,stream_bw);
+      bench_op<SphereOpBench::TagLaplaceSimple>(bench,laplace,      shape,nrep,stream_bw);
+      bench_op<SphereOpBench::TagLaplaceTensor>(bench,laplace_tens, shape,nrep,stream_bw);
+    }
+  }
+
+  finalize_hommexx_session();
+  MPI_Finalize();
+
+  return 0;
+}
@@ -1337,3 +1337,131 @@ TEST_CASE("vorticity_sphere_vector",
   std::cout << "test vorticity_sphere_vector multilevel finished. \n";
 
 }  // end of test div_sphere_wk_ml
+
+template<typename ViewT>
+void require_fused_matches (const ViewT& ref_d, const ViewT& fused_d, const Real tol) {
+  auto ref = Kokkos::create_mirror_view(ref_d);
+  auto fused = Kokkos::create_mirror_view(fused_d);
+  Kokkos::deep_copy(ref, ref_d);
+  Kokkos::deep_copy(fused, fused_d);
+
+  using value_type = typename ViewT::non_const_value_type;
+  const int n = ref.size()*sizeof(value_type)/sizeof(Real);
+  const Real* r = reinterpret_cast<const Real*>(ref.data());
+  const Real* f = reinterpret_cast<const Real*>(fused.data());
+  for (int i = 0; i < n; ++i) {
+    REQUIRE(!std::isnan(f[i]));
+    REQUIRE(compare_answers(r[i], f[i]) <= tol);
+  }
+}
+
+// The fused kernels do the same arithmetic as the staged ones, in the same
+// order, so they should be BFB, unless the compiler is allowed to contract
+// them differently into fma's. If HOMMEXX_FUSED_SPHERE_OPS is defined, the
+// operators already dispatch to the fused kernels, and the tests above check
+// them against Fortran.
+TEST_CASE("fused_sphere_ops", "fused_sphere_ops") {
+  constexpr const int elements = 10;
+#ifdef HOMMEXX_BFB_TESTING
+  constexpr Real tol = 0.0;
+#else
+  constexpr Real tol = 1e-13;
+#endif
+
+  compute_sphere_operator_test_ml testing_fused(elements);
+
+  auto policy = Homme::get_default_team_policy<ExecSpace>(elements);
+  SphereOperators sphere_ops = testing_fused.sphere_ops;
+  sphere_ops.allocate_buffers(policy);
+
+  // divergence_sphere_wk overwrites its input, so give it a copy.
+  const auto s = testing_fused.scalar_input_d;
+  const auto v = testing_fused.vector_input_d;
+  decltype(testing_fused.vector_input_d) v_copy("v copy", elements);
+  Kokkos::deep_copy(v_copy, v);
+
+  ExecViewManaged<Real * [NP][NP]> s_sl("s sl", elements);
+  rngAlg engine(Catch::rngSeed());
+  genRandArray(s_sl, engine, std::uniform_real_distribution<Real>(-1000.0, 1000.0));
+
+  ExecViewManaged<Real * [2][NP][NP]> grad_sl("", elements), grad_sl_fused("", elements);
+  ExecViewManaged<Scalar * [2][NP][NP][NUM_LEV]> grad("", elements), grad_fused("", elements);
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> div("", elements), div_fused("", elements);
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> vort("", elements), vort_fused("", elements);
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> div_wk("", elements), div_wk_fused("", elements);
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> vort_uv("", elements), vort_uv_fused("", elements);
+  ExecViewManaged<Scalar * [2][NP][NP][NUM_LEV]> grad_lambda("", elements), grad_lambda_fused("", elements);
+  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> div_lambda("", elements), div_lambda_fused("", elements);
+
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const TeamMember& team) {
+    KernelVariables kv(team);
+    const int ie = kv.ie;
+
+    sphere_ops.gradient_sphere_sl(kv, Homme::subview(s_sl, ie), Homme::subview(grad_sl, ie));
+    sphere_ops.gradient_sphere_sl_fused(kv, Homme::subview(s_sl, ie), Homme::subview(grad_sl_fused, ie));
+
+    sphere_ops.gradient_sphere(kv, Homme::subview(s, ie), Homme::subview(grad, ie));
+    sphere_ops.gradient_sphere_fused(kv, Homme::subview(s, ie), Homme::subview(grad_fused, ie));
+
+    sphere_ops.divergence_sphere(kv, Homme::subview(v, ie), Homme::subview(div, ie));
+    sphere_ops.divergence_sphere_cm_fused<CombineMode::Replace>(
+        kv, Homme::subview(v, ie), Homme::subview(div_fused, ie));
+
+    sphere_ops.vorticity_sphere(kv, Homme::subview(v, ie), Homme::subview(vort, ie));
+    sphere_ops.vorticity_sphere_fused(kv, Homme::subview(v, ie), Homme::subview(vort_fused, ie));
+
+    // The (u,v) overload, with the components as separate views.
+    sphere_ops.vorticity_sphere(kv, Homme::subview(v, ie, 0), Homme::subview(v, ie, 1),
+                                Homme::subview(vort_uv, ie));
+    sphere_ops.vorticity_sphere_fused(kv, Homme::subview(v, ie, 0), Homme::subview(v, ie, 1),
+                                      Homme::subview(vort_uv_fused, ie));
+
+    // Inputs given by lambdas rather than views. Scale them, so that the
+    // results differ from the ones computed from the views above.
+    const auto s_ie = Homme::subview(s, ie);
+    const auto v_ie = Homme::subview(v, ie);
+    const auto s_provider = [&](const int igp, const int jgp, const int ilev) -> Scalar {
+      return 2.0*s_ie(igp,jgp,ilev);
+    };
+    const auto v_provider = [&](const int comp, const int igp, const int jgp, const int ilev) -> Scalar {
+      return 2.0*v_ie(comp,igp,jgp,ilev);
+    };
+    sphere_ops.gradient_sphere(kv, s_provider, Homme::subview(grad_lambda, ie));
+    sphere_ops.gradient_sphere_fused(kv, s_provider, Homme::subview(grad_lambda_fused, ie));
+    sphere_ops.divergence_sphere(kv, v_provider, Homme::subview(div_lambda, ie));
+    sphere_ops.divergence_sphere_cm_fused<CombineMode::Replace>(
+        kv, v_provider, Homme::subview(div_lambda_fused, ie));
+
+    sphere_ops.divergence_sphere_wk_fused(kv, Homme::subview(v, ie), Homme::subview(div_wk_fused, ie));
+    sphere_ops.divergence_sphere_wk(kv, Homme::subview(v_copy, ie), Homme::subview(div_wk, ie));
+  });
+  Kokkos::fence();
+
+  require_fused_matches(grad_sl, grad_sl_fused, tol);
+  require_fused_matches(grad, grad_fused, tol);
+  require_fused_matches(div, div_fused, tol);
+  require_fused_matches(vort, vort_fused, tol);
+  require_fused_matches(div_wk, div_wk_fused, tol);
+  require_fused_matches(vort, vort_uv, tol);
+  require_fused_matches(vort_uv, vort_uv_fused, tol);
+  require_fused_matches(grad_lambda, grad_lambda_fused, tol);
+  require_fused_matches(div_lambda, div_lambda_fused, tol);
+
+  // Scaling the input by 2 is exact, and so is scaling the output.
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, elements), KOKKOS_LAMBDA(const int ie) {
+    for (int igp = 0; igp < NP; ++igp) {
+      for (int jgp = 0; jgp < NP; ++jgp) {
+        for (int ilev = 0; ilev < NUM_LEV; ++ilev) {
+          grad(ie,0,igp,jgp,ilev) *= 2.0;
+          grad(ie,1,igp,jgp,ilev) *= 2.0;
+          div(ie,igp,jgp,ilev) *= 2.0;
+        }
+      }
+    }
+  });
+  Kokkos::fence();
+  require_fused_matches(grad, grad_lambda, tol);
+  require_fused_matches(div, div_lambda, tol);
+
+  std::cout << "test fused sphere operators finished. \n";
+}
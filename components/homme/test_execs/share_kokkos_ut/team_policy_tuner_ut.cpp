@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include "TeamPolicyTuner.hpp"
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Homme;
+
+namespace {
+
+using shape_type = TeamPolicyTuner::shape_type;
+
+const std::vector<shape_type> candidates = { {4,32}, {8,16}, {16,8} };
+
+// Fake timing of candidate ic: the first candidate is the fastest on all
+// ranks but the last, where it is the slowest. Since the choice is based on
+// the max time over ranks, the second candidate must win.
+double fake_time (const int ic, const Comm& comm) {
+  if (ic==0) {
+    return comm.rank()==comm.size()-1 ? 10.0 : 1.0;
+  }
+  return 1.0 + ic;
+}
+
+// Goes through all the timed calls of the given kernel.
+void run_trials (TeamPolicyTuner& tuner, const std::string& name, const Comm& comm) {
+  const int num_calls = TeamPolicyTuner::num_trials*candidates.size();
+  for (int i=0; i<num_calls; ++i) {
+    REQUIRE (!tuner.decided(name));
+    REQUIRE (tuner.shape(name)==candidates[i/TeamPolicyTuner::num_trials]);
+    tuner.record(name,fake_time(i/TeamPolicyTuner::num_trials,comm));
+  }
+  REQUIRE (tuner.decided(name));
+}
+
+} // anonymous namespace
+
+TEST_CASE("team_policy_tuner_cache", "tuner") {
+  const auto& comm = Context::singleton().get<Comm>();
+  const std::string cache_file = "team_policy_tuner_ut.cache";
+  const std::string name = "tuner_ut kernel";
+
+  if (comm.root()) {
+    std::remove(cache_file.c_str());
+  }
+  MPI_Barrier(comm.mpi_comm());
+
+  // Tune from scratch. The choice must be the same on all ranks.
+  {
+    TeamPolicyTuner tuner(cache_file);
+    REQUIRE (tuner.enabled());
+    tuner.add_entry(name,std::vector<shape_type>(candidates));
+    run_trials(tuner,name,comm);
+    REQUIRE (tuner.shape(name)==candidates[1]);
+  }
+  // Root wrote the cache file while recording the last timing.
+  MPI_Barrier(comm.mpi_comm());
+
+  SECTION ("read back") {
+    // A new run picks up the cached choice right away, on all ranks.
+    TeamPolicyTuner tuner(cache_file);
+    tuner.add_entry(name,std::vector<shape_type>(candidates));
+    REQUIRE (tuner.decided(name));
+    REQUIRE (tuner.shape(name)==candidates[1]);
+  }
+
+  SECTION ("partial hit") {
+    // Only root has the cache file. With more than one rank, the hit must be
+    // discarded on all ranks, and all ranks must tune again (otherwise the
+    // reduction in record would hang).
+    const std::string rank_file = cache_file + "." + std::to_string(comm.rank());
+    {
+      std::ofstream ofs(rank_file);
+      if (comm.root()) {
+        std::ifstream ifs(cache_file);
+        ofs << ifs.rdbuf();
+      }
+    }
+    TeamPolicyTuner tuner(rank_file);
+    tuner.add_entry(name,std::vector<shape_type>(candidates));
+    if (comm.size()==1) {
+      REQUIRE (tuner.decided(name));
+    } else {
+      run_trials(tuner,name,comm);
+    }
+    REQUIRE (tuner.shape(name)==candidates[1]);
+
+    MPI_Barrier(comm.mpi_comm());
+    std::remove(rank_file.c_str());
+  }
+
+  SECTION ("nothing to tune") {
+    // A kernel with no valid candidate is never timed.
+    TeamPolicyTuner tuner(cache_file);
+    tuner.add_entry("tuner_ut untuned",std::vector<shape_type>());
+    REQUIRE (tuner.decided("tuner_ut untuned"));
+  }
+}
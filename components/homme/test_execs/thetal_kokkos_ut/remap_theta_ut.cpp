@@ -270,7 +270,6 @@ TEST_CASE("remap", "remap_testing") {
             auto w_i_cxx       = viewAsReal(Homme::subview(h_w_i,ie,np1));
             auto phinh_i_cxx   = viewAsReal(Homme::subview(h_phinh_i,ie,np1));
             auto v_cxx         = viewAsReal(Homme::subview(h_v,ie,np1));
-            auto qdp_cxx       = viewAsReal(Homme::subview(h_qdp,ie,np1_qdp));
 
             for (int igp=0; igp<NP; ++igp) {
               for (int jgp=0; jgp<NP; ++jgp) {
@@ -323,12 +322,13 @@ TEST_CASE("remap", "remap_testing") {
                   }
                   REQUIRE(v_cxx(1,igp,jgp,k)==v_f90(ie,np1,k,1,igp,jgp));
                   for (int iq=0; iq<params.qsize; ++iq) {
-                    if(qdp_cxx(iq,igp,jgp,k)!=qdp_f90(ie,np1_qdp,iq,k,igp,jgp)) {
+                    auto qdp_cxx = viewAsReal(Homme::subview(h_qdp,ie,np1_qdp,iq));
+                    if(qdp_cxx(igp,jgp,k)!=qdp_f90(ie,np1_qdp,iq,k,igp,jgp)) {
                       printf("ie,q,k,igp,jgp: %d, %d, %d, %d, %d\n",ie,iq,k,igp,jgp);
-                      printf("qdp cxx: %3.40f\n",qdp_cxx(iq,igp,jgp,k));
+                      printf("qdp cxx: %3.40f\n",qdp_cxx(igp,jgp,k));
                       printf("qdp f90: %3.40f\n",qdp_f90(ie,np1_qdp,iq,k,igp,jgp));
                     }
-                    REQUIRE(qdp_cxx(iq,igp,jgp,k)==qdp_f90(ie,np1_qdp,iq,k,igp,jgp));
+                    REQUIRE(qdp_cxx(igp,jgp,k)==qdp_f90(ie,np1_qdp,iq,k,igp,jgp));
                   }
                 }
 
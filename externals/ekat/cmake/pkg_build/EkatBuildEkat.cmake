@@ -114,6 +114,10 @@ macro (setVars PREFIX SET_DEFAULTS)
     set (EKAT_PACK_CHECK_BOUNDS ${${PREFIX}_PACK_CHECK_BOUNDS} CACHE BOOL "")
   endif()
 
+  if (DEFINED ${PREFIX}_VECTOR_MATH)
+    set (EKAT_VECTOR_MATH ${${PREFIX}_VECTOR_MATH} CACHE BOOL "")
+  endif()
+
   if (DEFINED ${PREFIX}_DISABLE_TPL_WARNINGS)
     set (EKAT_DISABLE_TPL_WARNINGS ${${PREFIX}_DISABLE_TPL_WARNINGS} CACHE BOOL "")
   elseif (SET_DEFAULTS)
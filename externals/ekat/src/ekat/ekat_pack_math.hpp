@@ -2,6 +2,17 @@
 #define EKAT_PACK_MATH_HPP
 
 #include "util/ekat_math_utils.hpp"
+#include "util/ekat_vector_math.hpp"
+
+#include <type_traits>
+
+// With EKAT_VECTOR_MATH, exp, log, log10, tanh and pow of packs of float or
+// double use the vectorizable, but not BFB with std::, implementations in
+// ekat_vector_math.hpp. These are not used on GPU, where the std:: functions
+// are already the vendor's SIMT math library.
+#if defined(EKAT_VECTOR_MATH) && !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP)
+#define EKAT_PACK_VMATH
+#endif
 
 namespace ekat {
 
@@ -31,15 +42,82 @@ namespace ekat {
   }
 #endif
 
-ekat_pack_gen_unary_stdfn(abs)
+#ifdef EKAT_PACK_VMATH
+namespace impl {
+
+template <typename S>
+struct IsVmathScalar {
+  static constexpr bool value = std::is_same<S,double>::value || std::is_same<S,float>::value;
+};
+
+// pack_fn<S>(x) is vmath::fn(x) if the pack scalar type S is float or double,
+// and std::fn(x) otherwise.
+#define ekat_pack_gen_vmath_dispatch(fn)                                     \
+  template <typename S, typename T> KOKKOS_FORCEINLINE_FUNCTION             \
+  typename std::enable_if<IsVmathScalar<S>::value, S>::type                 \
+  pack_##fn (const T& x) { return vmath::fn(static_cast<S>(x)); }           \
+  template <typename S, typename T> KOKKOS_FORCEINLINE_FUNCTION             \
+  typename std::enable_if<!IsVmathScalar<S>::value, decltype(std::fn(T()))>::type \
+  pack_##fn (const T& x) { return std::fn(x); }
+
+ekat_pack_gen_vmath_dispatch(exp)
+ekat_pack_gen_vmath_dispatch(log)
+ekat_pack_gen_vmath_dispatch(log10)
+ekat_pack_gen_vmath_dispatch(tanh)
+
+#undef ekat_pack_gen_vmath_dispatch
+
+template <typename S, typename A, typename B> KOKKOS_FORCEINLINE_FUNCTION
+typename std::enable_if<IsVmathScalar<S>::value, S>::type
+pack_pow (const A& a, const B& b) {
+  return vmath::pow(static_cast<S>(a), static_cast<S>(b));
+}
+
+template <typename S, typename A, typename B> KOKKOS_FORCEINLINE_FUNCTION
+typename std::enable_if<!IsVmathScalar<S>::value, decltype(std::pow(A(), B()))>::type
+pack_pow (const A& a, const B& b) {
+  return std::pow(a, b);
+}
+
+} // namespace impl
+
+#define ekat_pack_gen_unary_vmathfn(fn)             \
+  template <typename ScalarT, int N>                \
+  KOKKOS_INLINE_FUNCTION                            \
+  Pack<ScalarT,N> fn (const Pack<ScalarT,N>& p) {   \
+    Pack<ScalarT,N> s;                              \
+    vector_simd                                     \
+    for (int i = 0; i < N; ++i) {                   \
+      s[i] = impl::pack_##fn<ScalarT>(p[i]);        \
+    }                                               \
+    return s;                                       \
+  }
+
+ekat_pack_gen_unary_vmathfn(exp)
+ekat_pack_gen_unary_vmathfn(log)
+ekat_pack_gen_unary_vmathfn(log10)
+ekat_pack_gen_unary_vmathfn(tanh)
+#else
+namespace impl {
+
+template <typename S, typename A, typename B> KOKKOS_FORCEINLINE_FUNCTION
+auto pack_pow (const A& a, const B& b) -> decltype(std::pow(a, b)) {
+  return std::pow(a, b);
+}
+
+} // namespace impl
+
 ekat_pack_gen_unary_stdfn(exp)
-ekat_pack_gen_unary_stdfn(expm1)
 ekat_pack_gen_unary_stdfn(log)
 ekat_pack_gen_unary_stdfn(log10)
+ekat_pack_gen_unary_stdfn(tanh)
+#endif
+
+ekat_pack_gen_unary_stdfn(abs)
+ekat_pack_gen_unary_stdfn(expm1)
 ekat_pack_gen_unary_stdfn(tgamma)
 ekat_pack_gen_unary_stdfn(sqrt)
 ekat_pack_gen_unary_stdfn(cbrt)
-ekat_pack_gen_unary_stdfn(tanh)
 ekat_pack_gen_unary_stdfn(erf)
 
 template <typename PackType> KOKKOS_INLINE_FUNCTION
@@ -117,7 +195,7 @@ KOKKOS_INLINE_FUNCTION
 OnlyPack<PackType> pow (const PackType& a, const ScalarType/*&*/ b) {
   PackType s;
   vector_simd for (int i = 0; i < PackType::n; ++i)
-    s[i] = std::pow(a[i], b);
+    s[i] = impl::pack_pow<typename PackType::scalar>(a[i], b);
   return s;
 }
 
@@ -126,7 +204,7 @@ KOKKOS_INLINE_FUNCTION
 OnlyPack<PackType> pow (const ScalarType a, const PackType& b) {
   PackType s;
   vector_simd for (int i = 0; i < PackType::n; ++i)
-    s[i] = std::pow(a, b[i]);
+    s[i] = impl::pack_pow<typename PackType::scalar>(a, b[i]);
   return s;
 }
 
@@ -135,7 +213,7 @@ KOKKOS_INLINE_FUNCTION
 OnlyPack<PackType> pow (const PackType& a, const PackType& b) {
   PackType s;
   vector_simd for (int i = 0; i < PackType::n; ++i)
-    s[i] = std::pow(a[i], b[i]);
+    s[i] = impl::pack_pow<typename PackType::scalar>(a[i], b[i]);
   return s;
 }
 
@@ -162,5 +240,7 @@ OnlyPack<PackType> cube (const PackType& a) {
 // Cleanup the macros we used simply to generate code
 #undef ekat_pack_gen_unary_fn
 #undef ekat_pack_gen_unary_stdfn
+#undef ekat_pack_gen_unary_vmathfn
+#undef EKAT_PACK_VMATH
 
 #endif // EKAT_PACK_MATH_HPP
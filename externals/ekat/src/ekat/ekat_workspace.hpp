@@ -41,6 +41,24 @@ namespace ekat {
  * this value, running your kernel, and then calling report, which
  * will tell you the actual maximum number of sub-blocks that you
  * used. Note that all sub-blocks have a name.
+ *
+ * Alternatively, the WorkspaceManager can be built in stack mode (see
+ * the StackMode constructor). There, each team gets a single stack of
+ * T's, from which blocks of arbitrary size and type are taken with
+ * take_stack/take_stack_2d, and released in LIFO order with
+ * release_stack/release_stack_to (or a StackScope). Since blocks are
+ * only as large as requested, per-column scalars and short arrays do
+ * not cost a full sub-block each. get_stack_high_water returns the
+ * exact max number of T's that were used by any team, which is the
+ * smallest stack_size that would have worked.
+ *
+ * In either mode, the workspaces can be backed by Kokkos team scratch
+ * memory rather than by a global view (see the TeamScratch
+ * constructors). Each team then works on its own, contiguous block,
+ * which for small problems fits in L1/L2 on CPU, or in shared memory on
+ * GPU. If the block does not fit in the requested scratch level, global
+ * memory is used instead. Kernels must be launched with the policy
+ * returned by get_team_policy, which carries the scratch request.
  */
 
 template <typename T, typename DeviceT=DefaultDevice>
@@ -75,6 +93,13 @@ class WorkspaceManager
   // Default overprov factor for large GPU problems, testing has shown 1.25 is optimal
   static constexpr double GPU_DEFAULT_OVERPROVISION_FACTOR = 1.25;
 
+  // Tag to select the stack mode constructor
+  struct StackMode {};
+
+  // Tag to select the team scratch constructors. level is the Kokkos
+  // scratch level (0 or 1) the workspaces are taken from.
+  struct TeamScratch { int level; };
+
   //
   // ------- public API ---------
   //
@@ -97,6 +122,24 @@ class WorkspaceManager
   WorkspaceManager(T* data, int size, int max_used, TeamPolicy policy,
                    const double& overprov_factor=GPU_DEFAULT_OVERPROVISION_FACTOR);
 
+  // Constructor for stack mode, call from host
+  //   stack_size: The number of T's in the stack of each team. It may be
+  //               rounded up, so that all stacks start on a cache line.
+  //   policy: The team policy for Kokkos kernels using this WorkspaceManager
+  //   overprov_factor: How many workspace slots to overprovision (only applies to GPU for large problems)
+  WorkspaceManager(StackMode, int stack_size, TeamPolicy policy,
+                   const double& overprov_factor=GPU_DEFAULT_OVERPROVISION_FACTOR);
+
+  // Constructors for workspaces in team scratch memory, call from host
+  //   Same as above, but each team's workspace is taken from level
+  //   scratch.level team scratch memory, or from global memory if it
+  //   does not fit there (see uses_team_scratch).
+  WorkspaceManager(TeamScratch scratch, int size, int max_used, TeamPolicy policy,
+                   const double& overprov_factor=GPU_DEFAULT_OVERPROVISION_FACTOR);
+
+  WorkspaceManager(TeamScratch scratch, StackMode, int stack_size, TeamPolicy policy,
+                   const double& overprov_factor=GPU_DEFAULT_OVERPROVISION_FACTOR);
+
   // Helper functions which return the number of bytes that will be reserved for a given
   // set of constructor inputs. Note, this does not actually create an instance of the WSM,
   // but is useful for when memory needs to be reserved in a different scope than the
@@ -110,11 +153,34 @@ class WorkspaceManager
   // have much more detail for debug builds.
   void report() const;
 
+  // call from host.
+  //
+  // Stack mode only. Returns the max number of T's (alignment padding
+  // included) that were taken at once from the stack of any team.
+  int get_stack_high_water() const;
+
+  bool is_stack_mode() const { return m_stack_mode; }
+
+  // Whether the workspaces live in team scratch memory.
+  bool uses_team_scratch() const { return m_scratch_level >= 0; }
+
+  // Bytes of team scratch memory needed by each team (0 if the workspaces
+  // live in global memory). Kernels that also need their own team scratch
+  // at the same level must add this to their request.
+  int get_team_scratch_bytes() const { return m_scratch_bytes; }
+
+  // The policy passed at construction, with the team scratch request set if
+  // uses_team_scratch(). Kernels using this WorkspaceManager should be
+  // launched with it.
+  const TeamPolicy& get_team_policy() const { return m_policy; }
+
+
   class Workspace;
 
   // call from device
   //
-  // Returns a Workspace object which provides access to sub-blocks.
+  // Returns a Workspace object which provides access to sub-blocks. With
+  // team scratch memory, it must be called at most once per team per kernel.
   KOKKOS_INLINE_FUNCTION
   Workspace get_workspace(const MemberType& team, const char* name = "") const;
 
@@ -194,6 +260,54 @@ class WorkspaceManager
     { return get_name_impl<typename View::value_type>(space); }
 #endif
 
+    // Stack mode only. Take n S's from the top of the team's stack. The
+    // returned block starts on an alignment-byte boundary (alignment must
+    // be a power of 2), and occupies a whole number of T's.
+    template <typename S=T>
+    KOKKOS_INLINE_FUNCTION
+    Unmanaged<view_1d<S> > take_stack(const char* name, const int n,
+                                      const int alignment = alignof(S)) const;
+
+    // Stack mode only. Same as take_stack, but for a n0 x n1 block.
+    template <typename S=T>
+    KOKKOS_INLINE_FUNCTION
+    Unmanaged<view_2d<S> > take_stack_2d(const char* name, const int n0, const int n1,
+                                         const int alignment = alignof(S)) const;
+
+    // Stack mode only. Release a block taken from the stack, together with
+    // all the blocks that were taken after it.
+    template <typename View>
+    KOKKOS_INLINE_FUNCTION
+    void release_stack(const View& space) const;
+
+    // Stack mode only. Returns the current top of the stack. Passing it
+    // to release_stack_to releases all the blocks taken after this call.
+    KOKKOS_INLINE_FUNCTION
+    int get_stack_mark() const { return m_next_slot; }
+
+    KOKKOS_INLINE_FUNCTION
+    void release_stack_to(const int mark) const;
+
+    // Stack mode only. Releases all the blocks taken during its lifetime.
+    // Example:
+    //   {
+    //     typename WSM::Workspace::StackScope scope(workspace);
+    //     const auto tmp = workspace.take_stack("tmp", n);
+    //     ...
+    //   } // tmp is released here
+    class StackScope {
+     public:
+      KOKKOS_INLINE_FUNCTION
+      StackScope(const Workspace& ws) : m_ws(ws), m_mark(ws.get_stack_mark()) {}
+
+      KOKKOS_INLINE_FUNCTION
+      ~StackScope() { m_ws.release_stack_to(m_mark); }
+
+     private:
+      const Workspace& m_ws;
+      const int m_mark;
+    };
+
     // Reset back to initial state. All sub-blocks will be considered inactive.
     KOKKOS_INLINE_FUNCTION
     void reset() const;
@@ -251,7 +365,8 @@ class WorkspaceManager
 #endif
 
     KOKKOS_INLINE_FUNCTION
-    Workspace(const WorkspaceManager& parent, int ws_idx, const MemberType& team, const char* ws_name);
+    Workspace(const WorkspaceManager& parent, int ws_idx, const MemberType& team, const char* ws_name,
+              T* ws_data, int& next_slot);
 
     friend struct unit_test::UnitWrap;
     friend class WorkspaceManager;
@@ -259,7 +374,8 @@ class WorkspaceManager
     const WorkspaceManager& m_parent;
     const MemberType& m_team;
     const int m_ws_idx; // Workspace idx for m_team
-    int& m_next_slot; // the next free ws slot to allocate
+    T* const m_ws_data; // The memory of m_team's workspace
+    int& m_next_slot; // the next free ws slot to allocate (in stack mode, the top of the stack)
     const char* m_ws_name;
   }; // class Workspace
 
@@ -285,13 +401,24 @@ class WorkspaceManager
 
   template <typename S=T>
   KOKKOS_FORCEINLINE_FUNCTION
-  Unmanaged<view_1d<S> > get_space_in_slot(const int team_idx, const int slot) const;
+  Unmanaged<view_1d<S> > get_space_in_slot(T* const data, const int slot) const;
 
   KOKKOS_INLINE_FUNCTION
-  void init_slot_metadata(const int ws_idx, const int slot) const;
+  void init_slot_metadata(T* const data, const int slot) const;
+
+  // Offset (in T's) from the bottom of the stack at data of the first
+  // alignment-byte boundary at or above offset top.
+  KOKKOS_INLINE_FUNCTION
+  int align_stack_offset(const T* const data, const int top, const int alignment) const;
 
   void init_all_metadata(const int max_ws_idx, const int max_used);
 
+  // Use level team scratch memory if the workspace of a team fits in it.
+  // Returns whether it does.
+  bool setup_team_scratch(const int level);
+
+  void compute_stack_internals(int stack_size);
+
   void compute_internals(const int size, const int max_used);
 
   //
@@ -305,6 +432,9 @@ class WorkspaceManager
 
   TeamUtils<T,ExeSpace> m_tu;
   int m_max_ws_idx, m_reserve, m_size, m_total, m_max_used;
+  bool m_stack_mode;
+  int m_scratch_level, m_scratch_bytes;
+  TeamPolicy m_policy;
 #ifndef NDEBUG
   view_1d<int> m_num_used;
   view_1d<int> m_high_water;
@@ -314,6 +444,7 @@ class WorkspaceManager
   view_3d<int> m_counts;
 #endif
   view_1d<int> m_next_slot;
+  view_1d<int> m_stack_high_water;
   view_2d<T> m_data;
 
 // operator() needs to be public
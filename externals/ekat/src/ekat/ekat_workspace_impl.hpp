@@ -3,6 +3,8 @@
 
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
 
 namespace ekat {
@@ -15,7 +17,8 @@ namespace ekat {
 template <typename T, typename D>
 WorkspaceManager<T, D>::WorkspaceManager(int size, int max_used, TeamPolicy policy,
                                          const double& overprov_factor) :
-  m_tu(policy, overprov_factor)
+  m_tu(policy, overprov_factor),
+  m_policy(policy)
 {
   compute_internals(size, max_used);
   m_data = decltype(m_data) (Kokkos::ViewAllocateWithoutInitializing("Workspace.m_data"),
@@ -26,13 +29,93 @@ WorkspaceManager<T, D>::WorkspaceManager(int size, int max_used, TeamPolicy poli
 template <typename T, typename D>
 WorkspaceManager<T, D>::WorkspaceManager(T* data, int size, int max_used,
                                          TeamPolicy policy, const double& overprov_factor) :
-  m_tu(policy, overprov_factor)
+  m_tu(policy, overprov_factor),
+  m_policy(policy)
 {
   compute_internals(size, max_used);
   m_data = decltype(m_data) (data, m_max_ws_idx, m_total*m_max_used);
   init_all_metadata(m_max_ws_idx, m_max_used);
 }
 
+template <typename T, typename D>
+WorkspaceManager<T, D>::WorkspaceManager(StackMode, int stack_size, TeamPolicy policy,
+                                         const double& overprov_factor) :
+  m_tu(policy, overprov_factor),
+  m_policy(policy)
+{
+  compute_stack_internals(stack_size);
+  m_data = decltype(m_data) (Kokkos::ViewAllocateWithoutInitializing("Workspace.m_data"),
+                             m_max_ws_idx, m_total);
+}
+
+template <typename T, typename D>
+WorkspaceManager<T, D>::WorkspaceManager(TeamScratch scratch, int size, int max_used,
+                                         TeamPolicy policy, const double& overprov_factor) :
+  m_tu(policy, overprov_factor),
+  m_policy(policy)
+{
+  compute_internals(size, max_used);
+  if (!setup_team_scratch(scratch.level)) {
+    m_data = decltype(m_data) (Kokkos::ViewAllocateWithoutInitializing("Workspace.m_data"),
+                               m_max_ws_idx, m_total*m_max_used);
+    init_all_metadata(m_max_ws_idx, m_max_used);
+  }
+}
+
+template <typename T, typename D>
+WorkspaceManager<T, D>::WorkspaceManager(TeamScratch scratch, StackMode, int stack_size,
+                                         TeamPolicy policy, const double& overprov_factor) :
+  m_tu(policy, overprov_factor),
+  m_policy(policy)
+{
+  compute_stack_internals(stack_size);
+  if (!setup_team_scratch(scratch.level)) {
+    m_data = decltype(m_data) (Kokkos::ViewAllocateWithoutInitializing("Workspace.m_data"),
+                               m_max_ws_idx, m_total);
+  }
+}
+
+template <typename T, typename D>
+void WorkspaceManager<T, D>::compute_stack_internals(int stack_size)
+{
+  EKAT_REQUIRE_MSG(stack_size > 0, "Error! Invalid WorkspaceManager stack size.\n");
+
+  // Round the stack size up to a whole number of cache lines, so that
+  // every team's stack starts on a cache line.
+  constexpr int line = 64;
+  if (sizeof(T) < line && line % sizeof(T) == 0) {
+    constexpr int ts_per_line = line / sizeof(T);
+    stack_size = ((stack_size + ts_per_line - 1) / ts_per_line) * ts_per_line;
+  }
+
+  // The stack is a single slot with no metadata.
+  compute_internals(stack_size, 1);
+  m_reserve    = 0;
+  m_total      = m_size;
+  m_stack_mode = true;
+  m_stack_high_water = decltype(m_stack_high_water) ("Workspace.m_stack_high_water",
+                                                     m_max_ws_idx*m_pad_factor);
+}
+
+template <typename T, typename D>
+bool WorkspaceManager<T, D>::setup_team_scratch(const int level)
+{
+  EKAT_REQUIRE_MSG(level == 0 || level == 1, "Error! Invalid team scratch level.\n");
+
+  // A team's scratch holds its next slot (or top of the stack), followed
+  // by its workspace, aligned to a cache line (see get_workspace).
+  constexpr int alignment = 64;
+  const size_t bytes = 2*alignment + sizeof(T)*m_total*m_max_used;
+  if (bytes > static_cast<size_t>(TeamPolicy::scratch_size_max(level))) {
+    return false;
+  }
+
+  m_scratch_level = level;
+  m_scratch_bytes = bytes;
+  m_policy.set_scratch_size(level, Kokkos::PerTeam(m_scratch_bytes));
+  return true;
+}
+
 template <typename T, typename D>
 void WorkspaceManager<T, D>::compute_internals(const int size, const int max_used)
 {
@@ -42,6 +125,9 @@ void WorkspaceManager<T, D>::compute_internals(const int size, const int max_use
   m_size       = size;
   m_total      = m_size + m_reserve;
   m_max_used   = max_used;
+  m_stack_mode = false;
+  m_scratch_level = -1;
+  m_scratch_bytes = 0;
 #ifndef NDEBUG
   m_num_used   = decltype(m_num_used)   ("Workspace.m_num_used",   m_max_ws_idx);
   m_high_water = decltype(m_high_water) ("Workspace.m_high_water", m_max_ws_idx);
@@ -65,9 +151,30 @@ int WorkspaceManager<T, D>::get_total_bytes_needed(int size, int max_used, TeamP
   return tu.get_num_ws_slots()*total_slots*max_used*sizeof(T);
 }
 
+template <typename T, typename D>
+int WorkspaceManager<T, D>::get_stack_high_water() const
+{
+  EKAT_REQUIRE_MSG(m_stack_mode, "Error! get_stack_high_water requires a WorkspaceManager in stack mode.\n");
+
+  auto host_high_water = Kokkos::create_mirror_view(m_stack_high_water);
+  Kokkos::deep_copy(host_high_water, m_stack_high_water);
+
+  int high_water = 0;
+  for (int t = 0; t < m_max_ws_idx; ++t) {
+    high_water = std::max(high_water, host_high_water(m_pad_factor*t));
+  }
+  return high_water;
+}
+
 template <typename T, typename D>
 void WorkspaceManager<T, D>::report() const
 {
+  if (m_stack_mode) {
+    std::cout << "\nWS stack high-water: " << get_stack_high_water() << " of "
+              << m_size << " (" << sizeof(T) << " bytes each)" << std::endl;
+    return;
+  }
+
 #ifndef NDEBUG
   auto host_num_used   = Kokkos::create_mirror_view(m_num_used);
   auto host_high_water = Kokkos::create_mirror_view(m_high_water);
@@ -128,7 +235,34 @@ template <typename T, typename D>
 KOKKOS_INLINE_FUNCTION
 typename WorkspaceManager<T, D>::Workspace
 WorkspaceManager<T, D>::get_workspace(const MemberType& team, const char* ws_name) const
-{ return Workspace(*this, m_tu.get_workspace_idx(team), team, ws_name); }
+{
+  const int ws_idx = m_tu.get_workspace_idx(team);
+  if (m_scratch_level < 0) {
+    return Workspace(*this, ws_idx, team, ws_name,
+                     &m_data(ws_idx, 0), m_next_slot(m_pad_factor*ws_idx));
+  }
+
+  // Team scratch memory does not survive the kernel, so the metadata is
+  // set up anew for every team.
+  const auto& scratch = team.team_scratch(m_scratch_level);
+  int* const next_slot = static_cast<int*>(scratch.get_shmem(sizeof(int)));
+  T* const data = static_cast<T*>(scratch.get_shmem_aligned(sizeof(T)*m_total*m_max_used, 64));
+  EKAT_KERNEL_REQUIRE_MSG(data != nullptr,
+      "Error! Not enough team scratch memory for the workspace. Use WorkspaceManager::get_team_policy.\n");
+
+  if (!m_stack_mode) {
+    Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(team, m_max_used), [&] (int i) {
+        init_slot_metadata(data, i);
+    });
+  }
+  Kokkos::single(Kokkos::PerTeam(team), [&] () {
+    *next_slot = 0;
+  });
+  team.team_barrier();
+
+  return Workspace(*this, ws_idx, team, ws_name, data, *next_slot);
+}
 
 
 template <typename T, typename D>
@@ -153,7 +287,7 @@ void WorkspaceManager<T, D>::operator() (const MemberType& team) const
 {
   Kokkos::parallel_for(
     Kokkos::TeamThreadRange(team, m_max_used), [&] (int i) {
-      init_slot_metadata(team.league_rank(), i);
+      init_slot_metadata(&m_data(team.league_rank(), 0), i);
   });
 }
 
@@ -171,10 +305,10 @@ template <typename T, typename D>
 template <typename S>
 KOKKOS_FORCEINLINE_FUNCTION
 Unmanaged<typename WorkspaceManager<T, D>::template view_1d<S> >
-WorkspaceManager<T, D>::get_space_in_slot(const int team_idx, const int slot) const
+WorkspaceManager<T, D>::get_space_in_slot(T* const data, const int slot) const
 {
   Unmanaged<view_1d<S> > space(
-    reinterpret_cast<S*>(&m_data(team_idx, slot*m_total) + m_reserve),
+    reinterpret_cast<S*>(data + slot*m_total + m_reserve),
     sizeof(T) == sizeof(S) ?
     m_size :
     (m_size*sizeof(T))/sizeof(S));
@@ -188,19 +322,33 @@ WorkspaceManager<T, D>::get_space_in_slot(const int team_idx, const int slot) co
 
 template <typename T, typename D>
 KOKKOS_INLINE_FUNCTION
-void WorkspaceManager<T, D>::init_slot_metadata(const int ws_idx, const int slot) const
+void WorkspaceManager<T, D>::init_slot_metadata(T* const data, const int slot) const
 {
-  int* const metadata = reinterpret_cast<int*>(&m_data(ws_idx, slot*m_total));
+  int* const metadata = reinterpret_cast<int*>(data + slot*m_total);
   metadata[0] = slot;     // idx
   metadata[1] = slot + 1; // next
 }
 
+template <typename T, typename D>
+KOKKOS_INLINE_FUNCTION
+int WorkspaceManager<T, D>::align_stack_offset(const T* const data, const int top, const int alignment) const
+{
+  EKAT_KERNEL_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0,
+                         "Error! Stack alignment must be a power of 2.\n");
+
+  const auto base = reinterpret_cast<std::uintptr_t>(data);
+  const auto addr = base + top*sizeof(T);
+  const auto aligned = (addr + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+  return (aligned - base + sizeof(T) - 1)/sizeof(T);
+}
+
 template <typename T, typename D>
 KOKKOS_INLINE_FUNCTION
 WorkspaceManager<T, D>::Workspace::Workspace(
-  const WorkspaceManager& parent, int ws_idx, const MemberType& team, const char* ws_name) :
-  m_parent(parent), m_team(team), m_ws_idx(ws_idx),
-  m_next_slot(parent.m_next_slot(m_pad_factor*ws_idx)),
+  const WorkspaceManager& parent, int ws_idx, const MemberType& team, const char* ws_name,
+  T* ws_data, int& next_slot) :
+  m_parent(parent), m_team(team), m_ws_idx(ws_idx), m_ws_data(ws_data),
+  m_next_slot(next_slot),
   m_ws_name (ws_name)
 {}
 
@@ -221,7 +369,7 @@ Unmanaged<typename WorkspaceManager<T, D>::template view_1d<S> > WorkspaceManage
   change_num_used(1);
 #endif
 
-  const auto space = m_parent.get_space_in_slot<S>(m_ws_idx, m_next_slot);
+  const auto space = m_parent.get_space_in_slot<S>(m_ws_data, m_next_slot);
 
   // We need a barrier here so get_space_in_slot returns consistent results
   // w/in the team.
@@ -250,13 +398,13 @@ void WorkspaceManager<T, D>::Workspace::take_many_contiguous_unsafe(
   change_num_used(N);
   // Verify contiguous
   for (int n = 0; n < static_cast<int>(N) - 1; ++n) {
-    const auto space = m_parent.get_space_in_slot<S>(m_ws_idx, m_next_slot + n);
+    const auto space = m_parent.get_space_in_slot<S>(m_ws_data, m_next_slot + n);
     EKAT_KERNEL_ASSERT_MSG(m_parent.get_next<S>(space) == m_next_slot + n + 1,m_ws_name);
   }
 #endif
 
   for (int n = 0; n < static_cast<int>(N); ++n) {
-    const auto space = m_parent.get_space_in_slot<S>(m_ws_idx, m_next_slot+n);
+    const auto space = m_parent.get_space_in_slot<S>(m_ws_data, m_next_slot+n);
     *ptrs[n] = space;
   }
 
@@ -287,12 +435,12 @@ WorkspaceManager<T, D>::Workspace::take_macro_block(
   change_num_used(n_sub_blocks);
   // Verify contiguous
   for (int n = 0; n < n_sub_blocks - 1; ++n) {
-    const auto space = m_parent.get_space_in_slot<S>(m_ws_idx, m_next_slot + n);
+    const auto space = m_parent.get_space_in_slot<S>(m_ws_data, m_next_slot + n);
     EKAT_KERNEL_ASSERT_MSG(m_parent.get_next<S>(space) == m_next_slot + n + 1, m_ws_name);
   }
 #endif
 
-  const auto space = m_parent.get_space_in_slot<S>(m_ws_idx, m_next_slot);
+  const auto space = m_parent.get_space_in_slot<S>(m_ws_data, m_next_slot);
 
   // We need a barrier here so get_space_in_slot above returns consistent results
   // w/in the team.
@@ -326,7 +474,7 @@ void WorkspaceManager<T, D>::Workspace::take_many(
   int next_slot = m_next_slot;
   for (int n = 0; n < static_cast<int>(N); ++n) {
     auto& space = *ptrs[n];
-    space = m_parent.get_space_in_slot<S>(m_ws_idx, next_slot);
+    space = m_parent.get_space_in_slot<S>(m_ws_data, next_slot);
     next_slot = m_parent.get_next<S>(space);
   }
 
@@ -358,14 +506,14 @@ void WorkspaceManager<T, D>::Workspace::take_many_and_reset(
 #endif
 
   for (int n = 0; n < static_cast<int>(N); ++n) {
-    const auto space = m_parent.get_space_in_slot<S>(m_ws_idx, n);
+    const auto space = m_parent.get_space_in_slot<S>(m_ws_data, n);
     *ptrs[n] = space;
   }
 
   // We only need to reset the metadata for spaces that are being left free
   Kokkos::parallel_for(
     Kokkos::TeamThreadRange(m_team, m_parent.m_max_used - N), [&] (int i) {
-      m_parent.init_slot_metadata(m_ws_idx, i+N);
+      m_parent.init_slot_metadata(m_ws_data, i+N);
     });
 
   Kokkos::single(Kokkos::PerTeam(m_team), [&] () {
@@ -374,7 +522,7 @@ void WorkspaceManager<T, D>::Workspace::take_many_and_reset(
     // Mark all old spaces as released
     for (int a = 0; a < m_parent.m_max_used; ++a) {
       if (m_parent.m_active(m_ws_idx, a)) {
-        change_indv_meta<S>(m_parent.get_space_in_slot<S>(m_ws_idx, a), "", true);
+        change_indv_meta<S>(m_parent.get_space_in_slot<S>(m_ws_data, a), "", true);
       }
     }
 
@@ -400,7 +548,7 @@ void WorkspaceManager<T, D>::Workspace::reset() const
   m_next_slot = 0;
   Kokkos::parallel_for(
     Kokkos::TeamThreadRange(m_team, m_parent.m_max_used), [&] (int i) {
-      m_parent.init_slot_metadata(m_ws_idx, i);
+      m_parent.init_slot_metadata(m_ws_data, i);
     });
 
 #ifndef NDEBUG
@@ -408,7 +556,7 @@ void WorkspaceManager<T, D>::Workspace::reset() const
     // Mark all old spaces as released
     for (int a = 0; a < m_parent.m_max_used; ++a) {
       if (m_parent.m_active(m_ws_idx, a)) {
-        change_indv_meta<T>(m_parent.get_space_in_slot<T>(m_ws_idx, a), "", true);
+        change_indv_meta<T>(m_parent.get_space_in_slot<T>(m_ws_data, a), "", true);
       }
     }
   });
@@ -417,6 +565,84 @@ void WorkspaceManager<T, D>::Workspace::reset() const
   m_team.team_barrier();
 }
 
+template <typename T, typename D>
+template <typename S>
+KOKKOS_INLINE_FUNCTION
+Unmanaged<typename WorkspaceManager<T, D>::template view_1d<S> >
+WorkspaceManager<T, D>::Workspace::take_stack(
+  const char* name, const int n, const int alignment) const
+{
+  EKAT_KERNEL_ASSERT_MSG(m_parent.m_stack_mode, m_ws_name);
+
+  const int start = m_parent.align_stack_offset(m_ws_data, m_next_slot, alignment);
+  const int end   = start + (n*sizeof(S) + sizeof(T) - 1)/sizeof(T);
+  EKAT_KERNEL_REQUIRE_MSG(end <= m_parent.m_size, name);
+
+  const Unmanaged<view_1d<S> > space(reinterpret_cast<S*>(m_ws_data + start), n);
+#ifndef NDEBUG
+  for (size_t k=0; k<space.size(); ++k) {
+    space(k) = ekat::ScalarTraits<S>::invalid();
+  }
+#endif
+
+  // We need a barrier here so that all threads in the team computed start
+  // before the top of the stack moves.
+  m_team.team_barrier();
+  Kokkos::single(Kokkos::PerTeam(m_team), [&] () {
+    m_next_slot = end;
+    int& high_water = m_parent.m_stack_high_water(m_pad_factor*m_ws_idx);
+    if (end > high_water) {
+      high_water = end;
+    }
+  });
+  // We need a barrier here so that a subsequent call to take or release
+  // starts with the top of the stack in the correct state.
+  m_team.team_barrier();
+
+  return space;
+}
+
+template <typename T, typename D>
+template <typename S>
+KOKKOS_INLINE_FUNCTION
+Unmanaged<typename WorkspaceManager<T, D>::template view_2d<S> >
+WorkspaceManager<T, D>::Workspace::take_stack_2d(
+  const char* name, const int n0, const int n1, const int alignment) const
+{
+  const auto space = take_stack<S>(name, n0*n1, alignment);
+  return Unmanaged<view_2d<S> >(space.data(), n0, n1);
+}
+
+template <typename T, typename D>
+template <typename View>
+KOKKOS_INLINE_FUNCTION
+void WorkspaceManager<T, D>::Workspace::release_stack(const View& space) const
+{
+  const auto base = reinterpret_cast<std::uintptr_t>(m_ws_data);
+  const auto addr = reinterpret_cast<std::uintptr_t>(space.data());
+  EKAT_KERNEL_ASSERT_MSG(addr >= base && (addr - base) % sizeof(T) == 0, m_ws_name);
+
+  release_stack_to((addr - base)/sizeof(T));
+}
+
+template <typename T, typename D>
+KOKKOS_INLINE_FUNCTION
+void WorkspaceManager<T, D>::Workspace::release_stack_to(const int mark) const
+{
+  EKAT_KERNEL_ASSERT_MSG(m_parent.m_stack_mode, m_ws_name);
+  EKAT_KERNEL_ASSERT_MSG(mark >= 0 && mark <= m_next_slot, m_ws_name);
+
+  // We need a barrier here so that no thread in the team is still using the
+  // released blocks when a subsequent take_stack hands them out again.
+  m_team.team_barrier();
+  Kokkos::single(Kokkos::PerTeam(m_team), [&] () {
+    m_next_slot = mark;
+  });
+  // We need a barrier here so that a subsequent call to take or release
+  // starts with the top of the stack in the correct state.
+  m_team.team_barrier();
+}
+
 // Print the linked list. Obviously not a device function.
 template <typename T, typename D>
 void WorkspaceManager<T, D>::Workspace::print() const
@@ -426,13 +652,13 @@ void WorkspaceManager<T, D>::Workspace::print() const
     Kokkos::PerTeam(m_team), [&] () {
       std::stringstream ss;
       ss << m_ws_idx << ":";
-      auto space = m_parent.get_space_in_slot<T>(m_ws_idx, m_next_slot);
+      auto space = m_parent.get_space_in_slot<T>(m_ws_data, m_next_slot);
       for (int cnt = 0, nmax = m_parent.m_max_used;
            cnt < nmax;
            ++cnt) {
         ss << " (" << m_parent.get_index<T>(space) << ", "
            << m_parent.get_next<T>(space) << ")";
-        space = m_parent.get_space_in_slot<T>(m_ws_idx, m_parent.get_next<T>(space));
+        space = m_parent.get_space_in_slot<T>(m_ws_data, m_parent.get_next<T>(space));
       }
       ss << "\n";
       std::cout << ss.str();
@@ -579,7 +805,7 @@ void WorkspaceManager<T, D>::Workspace::release_macro_block(
   m_team.team_barrier();
   Kokkos::parallel_for(
     Kokkos::TeamThreadRange(m_team, n_sub_blocks), [&] (int i) {
-      m_parent.init_slot_metadata(m_ws_idx, i+m_next_slot);
+      m_parent.init_slot_metadata(m_ws_data, i+m_next_slot);
   });
 
   // We need a barrier here so that a subsequent call to take or release
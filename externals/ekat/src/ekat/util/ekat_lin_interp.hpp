@@ -5,6 +5,7 @@
 #include "ekat/ekat_assert.hpp"
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
 #include "ekat/kokkos/ekat_kokkos_types.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
 #include "ekat/ekat_pack.hpp"
 #include "ekat/ekat_pack_kokkos.hpp"
 
@@ -32,6 +33,13 @@ namespace ekat {
       li.lin_interp(team_member, x1col, x2col, subview(y1c, i), subview(y2c, i));
     });
 
+  If several fields share x1 and x2, lin_interp_batch interpolates all of them in
+  one pass. With y1 a (ncol, nfield, km1_pack) view and y2 (ncol, nfield, km2_pack):
+
+      li.setup(team_member, x1col, x2col);
+      team_member.team_barrier();
+      li.lin_interp_batch(team_member, x1col, x2col, subview(y1, i), subview(y2, i));
+
   Note: testing has shown that LinInterp runs better on SKX with pack_size=1.
 
  */
@@ -126,6 +134,49 @@ struct LinInterp
     const V4& y2,
     const Int col=-1) const;
 
+  // Linearly interpolate nfield fields y1(f,:) onto y2(f,:), f in [0,nfield),
+  // which all live on the coordinates x1 and x2 given to setup. y1 and y2 are
+  // 2D (field, level-pack) views, e.g. the column subviews of (col, field,
+  // level-pack) views. The index map entry, the x1 bracket and the x distances
+  // are fetched once per x2 pack and shared by all fields, instead of once per
+  // field and lin_interp call. Results are BFB with calling lin_interp on each
+  // field. By default, will launch a TeamThreadRange kernel, and the column idx
+  // will be team.league_rank(); this can be overridden by the col argument.
+  template <typename V1, typename V2, typename V3, typename V4>
+  KOKKOS_INLINE_FUNCTION
+  void lin_interp_batch(
+    const MemberType& team,
+    const V1& x1,
+    const V2& x2,
+    const V3& y1,
+    const V4& y2,
+    const Int col=-1) const;
+
+  // Same as above except the N fields are given as arrays of pointers to 1D
+  // views, e.g. as obtained from WorkspaceManager's take_many.
+  template <typename V1, typename V2, typename Y1, typename Y2, size_t N>
+  KOKKOS_INLINE_FUNCTION
+  void lin_interp_batch(
+    const MemberType& team,
+    const V1& x1,
+    const V2& x2,
+    const Kokkos::Array<Y1*, N>& y1,
+    const Kokkos::Array<Y2*, N>& y2,
+    const Int col=-1) const;
+
+  // Same as the first lin_interp_batch except uses a user-provided range boundary
+  // struct. This will likely be a ThreadVectorRange.
+  template <typename V1, typename V2, typename V3, typename V4, typename RangeBoundary>
+  KOKKOS_INLINE_FUNCTION
+  void lin_interp_batch(
+    const MemberType& team,
+    const RangeBoundary& range_boundary,
+    const V1& x1,
+    const V2& x2,
+    const V3& y1,
+    const V4& y2,
+    const Int col=-1) const;
+
   //
   // -------- Internal API, data ------
   //
@@ -149,6 +200,16 @@ struct LinInterp
     const view_1d<Pack>& y2,
     const Int col) const;
 
+  // y1f(f) and y2f(f) return the 1D views of field f
+  template <typename RangeBoundary, typename Y1F, typename Y2F>
+  KOKKOS_INLINE_FUNCTION
+  void lin_interp_batch_impl(
+    const MemberType& team,
+    const RangeBoundary& range_boundary,
+    const view_1d<const Pack>& x1, const view_1d<const Pack>& x2,
+    const int nfield, const Y1F& y1f, const Y2F& y2f,
+    const Int col) const;
+
   int m_km1;
   int m_km2;
   int m_km1_pack;
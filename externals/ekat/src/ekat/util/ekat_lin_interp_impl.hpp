@@ -85,6 +85,76 @@ void LinInterp<ScalarT, PackSize, DeviceT>::lin_interp(
                   col);
 }
 
+template <typename ScalarT, int PackSize, typename DeviceT>
+template <typename V1, typename V2, typename V3, typename V4>
+KOKKOS_INLINE_FUNCTION
+void LinInterp<ScalarT, PackSize, DeviceT>::lin_interp_batch(
+  const MemberType& team,
+  const V1& x1,
+  const V2& x2,
+  const V3& y1,
+  const V4& y2,
+  const Int col) const
+{
+  const view_2d<const Pack> y1p = ekat::repack<Pack::n>(y1);
+  const view_2d<Pack> y2p = ekat::repack<Pack::n>(y2);
+  EKAT_KERNEL_ASSERT(y1p.extent(0) == y2p.extent(0));
+  lin_interp_batch_impl(team,
+                        Kokkos::TeamThreadRange(team, m_km2_pack),
+                        ekat::repack<Pack::n>(x1),
+                        ekat::repack<Pack::n>(x2),
+                        y1p.extent_int(0),
+                        [&] (const int f) { return ekat::subview(y1p, f); },
+                        [&] (const int f) { return ekat::subview(y2p, f); },
+                        col);
+}
+
+template <typename ScalarT, int PackSize, typename DeviceT>
+template <typename V1, typename V2, typename Y1, typename Y2, size_t N>
+KOKKOS_INLINE_FUNCTION
+void LinInterp<ScalarT, PackSize, DeviceT>::lin_interp_batch(
+  const MemberType& team,
+  const V1& x1,
+  const V2& x2,
+  const Kokkos::Array<Y1*, N>& y1,
+  const Kokkos::Array<Y2*, N>& y2,
+  const Int col) const
+{
+  lin_interp_batch_impl(team,
+                        Kokkos::TeamThreadRange(team, m_km2_pack),
+                        ekat::repack<Pack::n>(x1),
+                        ekat::repack<Pack::n>(x2),
+                        N,
+                        [&] (const int f) { return ekat::repack<Pack::n>(*y1[f]); },
+                        [&] (const int f) { return ekat::repack<Pack::n>(*y2[f]); },
+                        col);
+}
+
+template <typename ScalarT, int PackSize, typename DeviceT>
+template <typename V1, typename V2, typename V3, typename V4, typename RangeBoundary>
+KOKKOS_INLINE_FUNCTION
+void LinInterp<ScalarT, PackSize, DeviceT>::lin_interp_batch(
+  const MemberType& team,
+  const RangeBoundary& range_boundary,
+  const V1& x1,
+  const V2& x2,
+  const V3& y1,
+  const V4& y2,
+  const Int col) const
+{
+  const view_2d<const Pack> y1p = ekat::repack<Pack::n>(y1);
+  const view_2d<Pack> y2p = ekat::repack<Pack::n>(y2);
+  EKAT_KERNEL_ASSERT(y1p.extent(0) == y2p.extent(0));
+  lin_interp_batch_impl(team,
+                        range_boundary,
+                        ekat::repack<Pack::n>(x1),
+                        ekat::repack<Pack::n>(x2),
+                        y1p.extent_int(0),
+                        [&] (const int f) { return ekat::subview(y1p, f); },
+                        [&] (const int f) { return ekat::subview(y2p, f); },
+                        col);
+}
+
 template <typename ScalarT, int PackSize, typename DeviceT>
 template <typename RangeBoundary>
 KOKKOS_INLINE_FUNCTION
@@ -126,6 +196,60 @@ void LinInterp<ScalarT, PackSize, DeviceT>::lin_interp_impl(
   });
 }
 
+template <typename ScalarT, int PackSize, typename DeviceT>
+template <typename RangeBoundary, typename Y1F, typename Y2F>
+KOKKOS_INLINE_FUNCTION
+void LinInterp<ScalarT, PackSize, DeviceT>::lin_interp_batch_impl(
+  const MemberType& team,
+  const RangeBoundary& range_boundary,
+  const view_1d<const Pack>& x1, const view_1d<const Pack>& x2,
+  const int nfield, const Y1F& y1f, const Y2F& y2f,
+  const Int col) const
+{
+  const auto x1s = ekat::scalarize(x1);
+
+  const int i = col == -1 ? team.league_rank() : col;
+  Kokkos::parallel_for(range_boundary, [&] (Int k2) {
+    const auto indx_pk = m_indx_map(i, k2);
+    const auto end_mask = indx_pk == m_km1 - 1;
+    if (end_mask.any()) {
+      // Same as lin_interp_impl: the last x1 interval is extrapolated from
+      // the left, so lanes at the end take the scalar path.
+      const auto not_end = !end_mask;
+      for (int f = 0; f < nfield; ++f) {
+        const auto y1s = ekat::scalarize(y1f(f));
+        auto& y2p = y2f(f)(k2);
+        ekat_masked_loop(end_mask, s) {
+          int k1 = indx_pk[s];
+          y2p[s] = y1s(k1) + (y1s(k1)-y1s(k1-1))*(x2(k2)[s]-x1s(k1))/(x1s(k1)-x1s(k1-1));
+        }
+        ekat_masked_loop(not_end, s) {
+          int k1 = indx_pk[s];
+          y2p[s] = y1s(k1) + (y1s(k1+1)-y1s(k1))*(x2(k2)[s]-x1s(k1))/(x1s(k1+1)-x1s(k1));
+        }
+        y2p.set(y2p < m_minthresh, m_minthresh);
+      }
+    }
+    else {
+      // x1 bracket and distances, shared by all fields
+      Pack x1p, x1p1;
+      ekat::index_and_shift<1>(x1s, indx_pk, x1p, x1p1);
+      const Pack dx2 = x2(k2) - x1p;
+      const Pack dx1 = x1p1 - x1p;
+
+      for (int f = 0; f < nfield; ++f) {
+        const auto y1s = ekat::scalarize(y1f(f));
+        Pack y1p, y1p1;
+        ekat::index_and_shift<1>(y1s, indx_pk, y1p, y1p1);
+
+        auto& y2p = y2f(f)(k2);
+        y2p = y1p + (y1p1-y1p)*dx2/dx1;
+        y2p.set(y2p < m_minthresh, m_minthresh);
+      }
+    }
+  });
+}
+
 template <typename ScalarT, int PackSize, typename DeviceT>
 template <typename RangeBoundary>
 KOKKOS_INLINE_FUNCTION
@@ -0,0 +1,340 @@
+#ifndef EKAT_VECTOR_MATH_HPP
+#define EKAT_VECTOR_MATH_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+/*
+ * Scalar exp, log, log10, tanh and pow for float and double, written without
+ * branches or libm calls, so that a loop applying them to the entries of a
+ * Pack is vectorized by the compiler. Each function reduces its argument to
+ * a small range using the binary representation of the input, then evaluates
+ * a polynomial or rational approximation there (the Cephes coefficients).
+ *
+ * The results are within a few ulps of std:: (see the pack_math_perf test for
+ * the measured errors), but they are not BFB with it. When EKAT_VECTOR_MATH
+ * is defined, the Pack overloads in ekat_pack_math.hpp use these functions on
+ * the host; otherwise they call the std:: functions lane by lane.
+ *
+ * Inputs outside of the domain of a function (e.g., log of a negative number)
+ * give the IEEE result (NaN, +-inf, or 0) but no FP exception is guaranteed.
+ * The functions are only meant for CPU SIMD lanes, so they are not compiled
+ * in GPU builds.
+ */
+
+#if !defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_HIP)
+
+namespace ekat {
+namespace vmath {
+
+namespace impl {
+
+// The integer arithmetic below (exponent extraction, 2^n) is done with
+// floating point and unsigned bit operations only, since conversions between
+// floating point and 64-bit ints do not vectorize before AVX-512.
+
+template <typename T> struct FpBits;
+template <> struct FpBits<double> {
+  using uint = std::uint64_t;
+  static constexpr int mant_bits = 52;
+  static constexpr int bias = 1023;
+  static constexpr uint exp_mask = 0x7ff;
+  static constexpr uint mant_mask = 0x000fffffffffffffULL;
+  // 2^52 and 1.5*2^52
+  static constexpr double two_mant = 4503599627370496.0;
+  static constexpr double shifter = 6755399441055744.0;
+};
+template <> struct FpBits<float> {
+  using uint = std::uint32_t;
+  static constexpr int mant_bits = 23;
+  static constexpr int bias = 127;
+  static constexpr uint exp_mask = 0xff;
+  static constexpr uint mant_mask = 0x007fffffU;
+  static constexpr float two_mant = 8388608.0f;
+  static constexpr float shifter = 12582912.0f;
+};
+
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+typename FpBits<T>::uint to_bits (const T x) {
+  typename FpBits<T>::uint u;
+  std::memcpy(&u, &x, sizeof(T));
+  return u;
+}
+
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T from_bits (const typename FpBits<T>::uint u) {
+  T x;
+  std::memcpy(&x, &u, sizeof(T));
+  return x;
+}
+
+// c ? a : b, as a bitwise blend. Unlike a ternary, this does not let the
+// compiler turn the computation of a and b into branches, which would prevent
+// vectorization (with the default -ftrapping-math, FP operations are not
+// speculated).
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T select (const bool c, const T a, const T b) {
+  using uint = typename FpBits<T>::uint;
+  const uint m = -static_cast<uint>(c);
+  return from_bits<T>((to_bits(a) & m) | (to_bits(b) & ~m));
+}
+
+// x rounded to the nearest integer, for |x| < 2^(mant_bits-1).
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T round_small (const T x) {
+  return (x + FpBits<T>::shifter) - FpBits<T>::shifter;
+}
+
+// x rounded to the nearest integer, for any finite x.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T round (const T x) {
+  return select(std::abs(x) < FpBits<T>::two_mant/2, round_small(x), x);
+}
+
+// 2^n for an integer n in [1-bias, bias]. Adding the shifter puts n + bias
+// in the low mantissa bits, which are then shifted to the exponent field.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T pow2i (const T n) {
+  return from_bits<T>(to_bits<T>(n + (T(FpBits<T>::bias) + FpBits<T>::shifter))
+                      << FpBits<T>::mant_bits);
+}
+
+// x*2^n for an integer n such that x*2^n is finite. n is split in two
+// halves, so that results in the subnormal range are also obtained.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T ldexp (const T x, const T n) {
+  const T n1 = round_small(T(0.5)*n - T(0.25)); // floor(n/2)
+  return x*pow2i(n1)*pow2i(n - n1);
+}
+
+// x = m*2^e with m in [sqrt(1/2), sqrt(2)). Returns m-1 and sets e. x must
+// be positive and finite.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T frexp_sqrth (const T x, T& e) {
+  using B = FpBits<T>;
+  using uint = typename B::uint;
+  constexpr int sub_shift = B::mant_bits + 2;
+  // Scale subnormals into the normal range.
+  const bool sub = x < std::numeric_limits<T>::min();
+  const T xs = select(sub, x*pow2i(T(sub_shift)), x);
+  const uint u = to_bits(xs);
+  // The biased exponent, converted to T through the mantissa of 2^mant_bits.
+  const T eb = from_bits<T>(((u >> B::mant_bits) & B::exp_mask) | to_bits(B::two_mant)) - B::two_mant;
+  // m in [0.5, 1)
+  const T m = from_bits<T>((u & B::mant_mask) | (static_cast<uint>(B::bias - 1) << B::mant_bits));
+  const bool small = m < T(0.70710678118654752440);
+  e = eb - T(B::bias - 1) - select(sub, T(sub_shift), T(0)) - select(small, T(1), T(0));
+  return select(small, m, T(0)) + (m - 1);
+}
+
+// log(1+x) - x for x in [sqrt(1/2)-1, sqrt(2)-1).
+KOKKOS_FORCEINLINE_FUNCTION
+double log1p_tail (const double x) {
+  const double z = x*x;
+  const double p = (((((1.01875663804580931796E-4*x + 4.97494994976747001425E-1)*x
+                       + 4.70579119878881725854E0)*x + 1.44989225341610930846E1)*x
+                     + 1.79368678507819816313E1)*x + 7.70838733755885391666E0);
+  const double q = (((((x + 1.12873587189167450590E1)*x + 4.52279145837532221105E1)*x
+                      + 8.29875266912776603211E1)*x + 7.11544750618563894466E1)*x
+                    + 2.31251620126765340583E1);
+  return x*(z*p/q) - 0.5*z;
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+float log1p_tail (const float x) {
+  const float z = x*x;
+  const float y = ((((((((7.0376836292E-2f*x - 1.1514610310E-1f)*x + 1.1676998740E-1f)*x
+                       - 1.2420140846E-1f)*x + 1.4249322787E-1f)*x - 1.6668057665E-1f)*x
+                    + 2.0000714765E-1f)*x - 2.4999993993E-1f)*x + 3.3333331174E-1f)*x*z;
+  return y - 0.5f*z;
+}
+
+// exp(r) - 1 for r in [-log(2)/2, log(2)/2].
+KOKKOS_FORCEINLINE_FUNCTION
+double expm1_reduced (const double r) {
+  const double rr = r*r;
+  const double px = r*((1.26177193074810590878E-4*rr + 3.02994407707441961300E-2)*rr
+                       + 9.99999999999999999910E-1);
+  const double qx = ((3.00198505138664455042E-6*rr + 2.52448340349684104192E-3)*rr
+                     + 2.27265548208155028766E-1)*rr + 2.00000000000000000009E0;
+  return 2*(px/(qx - px));
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+float expm1_reduced (const float r) {
+  const float p = ((((1.9875691500E-4f*r + 1.3981999507E-3f)*r + 8.3334519073E-3f)*r
+                    + 4.1665795894E-2f)*r + 1.6666665459E-1f)*r + 5.0000001201E-1f;
+  return p*(r*r) + r;
+}
+
+// x = n*log(2) + r, with n an integer and |r| <= log(2)/2. log(2) = C1 + C2,
+// with C1 exact in a few bits, so that n*C1 is exact. Returns r.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T reduce_ln2 (const T x, T& n) {
+  n = round_small(T(1.44269504088896340736)*x);
+  return (x - n*T(0.693359375)) - n*T(-2.12194440054690582767E-4);
+}
+
+template <typename T> struct ExpLimits;
+template <> struct ExpLimits<double> {
+  // exp(hi) overflows and exp(lo) underflows to 0.
+  static constexpr double hi = 709.79;
+  static constexpr double lo = -745.14;
+};
+template <> struct ExpLimits<float> {
+  static constexpr float hi = 88.73f;
+  static constexpr float lo = -103.98f;
+};
+
+// exp(x + xlo), where xlo is a small correction to x.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T exp (const T x, const T xlo) {
+  using L = ExpLimits<T>;
+  const T xc = select(x < L::lo, L::lo, select(x > L::hi, L::hi, x));
+  T n;
+  const T r = reduce_ln2(xc, n) + xlo;
+  const T y = ldexp(1 + expm1_reduced(r), n);
+  const T inf = std::numeric_limits<T>::infinity();
+  return select(x > L::hi, inf, select(x < L::lo, T(0), y));
+}
+
+// Error-free product: a*b = p + e, unless a*b overflows, in which case e = 0.
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T two_prod (const T a, const T b, T& e) {
+  const T p = a*b;
+#ifdef __FMA__
+  e = std::fma(a, b, -p);
+#else
+  // Veltkamp split of a and b in two halves.
+  constexpr T split = T(1 << ((std::numeric_limits<T>::digits + 1)/2)) + 1;
+  const T ac = split*a, bc = split*b;
+  const T ah = ac - (ac - a), bh = bc - (bc - b);
+  const T al = a - ah, bl = b - bh;
+  e = ((ah*bh - p) + ah*bl + al*bh) + al*bl;
+#endif
+  e = select(std::abs(e) <= std::abs(p), e, T(0));
+  return p;
+}
+
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T log (const T x) {
+  T e;
+  const T m1 = frexp_sqrth(x, e);
+  // log(x) = m1 + log1p_tail(m1) + e*log(2), log(2) = C1 + C2.
+  const T y = m1 + (log1p_tail(m1) + e*T(-2.121944400546905827679E-4)) + e*T(0.693359375);
+  const T inf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  return select(x == inf, inf, select(x > 0, y, select(x == 0, -inf, nan)));
+}
+
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T log10 (const T x) {
+  T e;
+  const T m1 = frexp_sqrth(x, e);
+  const T t = log1p_tail(m1);
+  // log10(x) = (m1 + t)*log10(e) + e*log10(2). Split log10(e) and log10(2)
+  // in a leading part with a few bits and a correction, and add up the
+  // smallest terms first.
+  constexpr T l10ea = 4.3359375E-1, l10eb = 7.00731903251827651129E-4;
+  constexpr T l102a = 3.0078125E-1, l102b = 2.48745663981195213739E-4;
+  const T y = ((((t*l10eb + m1*l10eb) + e*l102b) + t*l10ea) + m1*l10ea) + e*l102a;
+  const T inf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  return select(x == inf, inf, select(x > 0, y, select(x == 0, -inf, nan)));
+}
+
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T tanh (const T x) {
+  // tanh(|x|) = m/(m + 2), m = exp(2|x|) - 1. With 2|x| = n*log(2) + r,
+  // m = 2^n*expm1(r) + (2^n - 1), where both terms are >= 0 if n >= 1, so m
+  // is accurate also for small |x|. Beyond sat, tanh(|x|) rounds to 1.
+  constexpr T sat = std::numeric_limits<T>::digits*T(0.35);
+  const T a = std::abs(x);
+  T n;
+  const T r = reduce_ln2(2*select(a > sat, sat, a), n);
+  const T s = pow2i(n);
+  const T m = s*expm1_reduced(r) + (s - 1);
+  const T y = select(a > sat, T(1), m/(m + 2));
+  return std::copysign(y, x);
+}
+
+template <typename T> KOKKOS_FORCEINLINE_FUNCTION
+T pow (const T a, const T b) {
+  const T inf = std::numeric_limits<T>::infinity();
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  const T aa = std::abs(a);
+
+  // log(|a|) = hi + lo, so that the rounding error of log(|a|), amplified by
+  // b, does not dominate the error of the result.
+  T e;
+  const T m1 = frexp_sqrth(select((aa > 0) & (aa < inf), aa, T(1)), e);
+  const T ec1 = e*T(0.693359375); // exact
+  const T hi = ec1 + m1;
+  const T bv = hi - ec1;
+  const T sum_err = (ec1 - (hi - bv)) + (m1 - bv);
+  const T lo = sum_err + (log1p_tail(m1) + e*T(-2.121944400546905827679E-4));
+  T p_err;
+  const T p = two_prod(b, hi, p_err);
+  const T y = exp(p, p_err + b*lo);
+
+  const bool b_int = round(b) == b;
+  const bool b_odd = b_int & (round(T(0.5)*b) != T(0.5)*b);
+  const bool neg_odd = (a < 0) & b_odd;
+  // a < 0 is only defined for an integer b.
+  T r = select((a < 0) & !b_int, nan, select(neg_odd, -y, y));
+  // a = +-0, +-inf
+  const T r0 = select(b < 0, inf, T(0));
+  r = select(aa == 0, select(b_odd, std::copysign(r0, a), r0), r);
+  const T rinf = select(b < 0, T(0), inf);
+  r = select(aa == inf, select(neg_odd, -rinf, rinf), r);
+  // (-1)^(+-inf) = 1, 1^b = 1, a^0 = 1, even for NaNs.
+  r = select((aa == 1) & (std::abs(b) == inf), T(1), r);
+  r = select((a != a) | (b != b), nan, r);
+  return select((a == 1) | (b == 0), T(1), r);
+}
+
+} // namespace impl
+
+KOKKOS_FORCEINLINE_FUNCTION
+double exp (const double x) { return impl::exp(x, 0.0); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+float exp (const float x) { return impl::exp(x, 0.0f); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+double log (const double x) { return impl::log(x); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+float log (const float x) { return impl::log(x); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+double log10 (const double x) { return impl::log10(x); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+float log10 (const float x) { return impl::log10(x); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+double tanh (const double x) { return impl::tanh(x); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+float tanh (const float x) { return impl::tanh(x); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+double pow (const double a, const double b) { return impl::pow(a, b); }
+
+// The float pow is evaluated in double, which is accurate and still vectorized.
+KOKKOS_FORCEINLINE_FUNCTION
+float pow (const float a, const float b) {
+  return static_cast<float>(impl::pow(static_cast<double>(a), static_cast<double>(b)));
+}
+
+} // namespace vmath
+} // namespace ekat
+
+#endif // !KOKKOS_ENABLE_CUDA && !KOKKOS_ENABLE_HIP
+
+#endif // EKAT_VECTOR_MATH_HPP
@@ -0,0 +1,223 @@
+#include "ekat/util/ekat_lin_interp.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "ekat/ekat_session.hpp"
+
+#include "ekat_test_config.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <random>
+
+namespace {
+
+/*
+ * lin_interp_perf times the interpolation of nfield fields sharing the same
+ * source and target coordinates, for ncol columns, in three ways:
+ *   - launch: setup in one kernel, then one kernel launch per field;
+ *   - loop:   setup and one lin_interp call per field in a single kernel;
+ *   - batch:  setup and a single lin_interp_batch call in a single kernel.
+ * The best time over r repetitions is reported for each, and the results
+ * of loop and batch are checked to be BFB.
+ */
+
+using LIV  = ekat::LinInterp<Real,EKAT_TEST_POSSIBLY_NO_PACK_SIZE>;
+using Pack = ekat::Pack<Real,EKAT_TEST_PACK_SIZE>;
+
+template <typename S>
+using view_2d = typename LIV::template view_2d<S>;
+template <typename S>
+using view_3d = typename LIV::KT::template view_3d<S>;
+
+struct Input {
+  int ncol   = 4096;
+  int km1    = 128;
+  int km2    = 72;
+  int nfield = 10;
+  int repeat = 10;
+};
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+bool parse (int argc, char** argv, Input& in) {
+  using ekat::argv_matches;
+  for (int i = 1; i < argc; ++i) {
+    if (argv_matches(argv[i], "-h", "--help")) {
+      std::cout <<
+        argv[0] << " [options]\n"
+        "Options:\n"
+        "  -nc <ncol>     Number of columns. Default=4096.\n"
+        "  -k1 <km1>      Number of source levels. Default=128.\n"
+        "  -k2 <km2>      Number of target levels. Default=72.\n"
+        "  -nf <nfield>   Number of fields. Default=10.\n"
+        "  -r <repeat>    Number of repetitions; the best time is reported. Default=10.\n";
+      return false;
+    } else if (argv_matches(argv[i], "-nc", "--ncol")) {
+      expect_another_arg(i, argc);
+      in.ncol = std::atoi(argv[++i]);
+    } else if (argv_matches(argv[i], "-k1", "--km1")) {
+      expect_another_arg(i, argc);
+      in.km1 = std::atoi(argv[++i]);
+    } else if (argv_matches(argv[i], "-k2", "--km2")) {
+      expect_another_arg(i, argc);
+      in.km2 = std::atoi(argv[++i]);
+    } else if (argv_matches(argv[i], "-nf", "--nfield")) {
+      expect_another_arg(i, argc);
+      in.nfield = std::atoi(argv[++i]);
+    } else if (argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      in.repeat = std::atoi(argv[++i]);
+    } else {
+      std::cout << "Unexpected arg: " << argv[i] << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+// Best time [s] over in.repeat calls of f.
+template <typename F>
+double time_best (const Input& in, const F& f) {
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < in.repeat; ++r) {
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    f();
+    Kokkos::fence();
+    best = std::min(best, timer.seconds());
+  }
+  return best;
+}
+
+int run (const Input& in) {
+  const int ncol = in.ncol, km1 = in.km1, km2 = in.km2, nfield = in.nfield;
+  const int km1_pack = ekat::npack<Pack>(km1);
+  const int km2_pack = ekat::npack<Pack>(km2);
+  const Real minthresh = 0.000001;
+
+  LIV vect(ncol, km1, km2, minthresh);
+  view_2d<Pack> x1("x1", ncol, km1_pack), x2("x2", ncol, km2_pack);
+  view_3d<Pack> y1("y1", ncol, nfield, km1_pack),
+                y2_launch("y2_launch", ncol, nfield, km2_pack),
+                y2_loop("y2_loop", ncol, nfield, km2_pack),
+                y2_batch("y2_batch", ncol, nfield, km2_pack);
+
+  // Sorted random coordinates in [0,1) and field values in [0,100)
+  {
+    std::default_random_engine generator;
+    std::uniform_real_distribution<Real> x_dist(0.0,1.0);
+    std::uniform_real_distribution<Real> y_dist(0.0,100.0);
+    auto x1m = Kokkos::create_mirror_view(x1);
+    auto x2m = Kokkos::create_mirror_view(x2);
+    auto y1m = Kokkos::create_mirror_view(y1);
+    auto x1s = ekat::scalarize(x1m);
+    auto x2s = ekat::scalarize(x2m);
+    auto y1s = ekat::scalarize(y1m);
+    for (int i = 0; i < ncol; ++i) {
+      for (int k = 0; k < km1; ++k) x1s(i, k) = x_dist(generator);
+      for (int k = 0; k < km2; ++k) x2s(i, k) = x_dist(generator);
+      std::sort(&x1s(i, 0), &x1s(i, 0) + km1);
+      std::sort(&x2s(i, 0), &x2s(i, 0) + km2);
+      for (int f = 0; f < nfield; ++f) {
+        for (int k = 0; k < km1; ++k) y1s(i, f, k) = y_dist(generator);
+      }
+    }
+    Kokkos::deep_copy(x1, x1m);
+    Kokkos::deep_copy(x2, x2m);
+    Kokkos::deep_copy(y1, y1m);
+  }
+
+  const double t_launch = time_best(in, [&] () {
+    Kokkos::parallel_for("lin-interp-perf-setup", vect.policy(),
+                         KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+      const int i = team.league_rank();
+      vect.setup(team, ekat::subview(x1, i), ekat::subview(x2, i));
+    });
+    for (int f = 0; f < nfield; ++f) {
+      Kokkos::parallel_for("lin-interp-perf-launch", vect.policy(),
+                           KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+        const int i = team.league_rank();
+        vect.lin_interp(team, ekat::subview(x1, i), ekat::subview(x2, i),
+                        ekat::subview(y1, i, f), ekat::subview(y2_launch, i, f));
+      });
+    }
+  });
+
+  const double t_loop = time_best(in, [&] () {
+    Kokkos::parallel_for("lin-interp-perf-loop", vect.policy(),
+                         KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+      const int i = team.league_rank();
+      vect.setup(team, ekat::subview(x1, i), ekat::subview(x2, i));
+      team.team_barrier();
+      for (int f = 0; f < nfield; ++f) {
+        vect.lin_interp(team, ekat::subview(x1, i), ekat::subview(x2, i),
+                        ekat::subview(y1, i, f), ekat::subview(y2_loop, i, f));
+      }
+    });
+  });
+
+  const double t_batch = time_best(in, [&] () {
+    Kokkos::parallel_for("lin-interp-perf-batch", vect.policy(),
+                         KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+      const int i = team.league_rank();
+      vect.setup(team, ekat::subview(x1, i), ekat::subview(x2, i));
+      team.team_barrier();
+      vect.lin_interp_batch(team, ekat::subview(x1, i), ekat::subview(x2, i),
+                            ekat::subview(y1, i), ekat::subview(y2_batch, i));
+    });
+  });
+
+  // The three methods must give the same answer.
+  int nerr = 0;
+  {
+    auto y2_launch_m = Kokkos::create_mirror_view(y2_launch);
+    auto y2_loop_m = Kokkos::create_mirror_view(y2_loop);
+    auto y2_batch_m = Kokkos::create_mirror_view(y2_batch);
+    Kokkos::deep_copy(y2_launch_m, y2_launch);
+    Kokkos::deep_copy(y2_loop_m, y2_loop);
+    Kokkos::deep_copy(y2_batch_m, y2_batch);
+    const auto y2_launch_s = ekat::scalarize(y2_launch_m);
+    const auto y2_loop_s = ekat::scalarize(y2_loop_m);
+    const auto y2_batch_s = ekat::scalarize(y2_batch_m);
+    for (int i = 0; i < ncol; ++i) {
+      for (int f = 0; f < nfield; ++f) {
+        for (int k = 0; k < km2; ++k) {
+          if (y2_batch_s(i, f, k) != y2_loop_s(i, f, k) ||
+              y2_batch_s(i, f, k) != y2_launch_s(i, f, k)) {
+            ++nerr;
+          }
+        }
+      }
+    }
+    if (nerr > 0) {
+      std::cout << "lin_interp_batch differs from lin_interp in " << nerr << " entries\n";
+    }
+  }
+
+  const double nval = double(ncol)*nfield*km2;
+  printf("run: ncol %d km1 %d km2 %d nfield %d pack %d\n", ncol, km1, km2, nfield, Pack::n);
+  printf("%-8s %12s %12s %10s\n", "method", "time [s]", "ns/value", "speedup");
+  printf("%-8s %12.4e %12.3f %10.3f\n", "launch", t_launch, 1e9*t_launch/nval, 1.0);
+  printf("%-8s %12.4e %12.3f %10.3f\n", "loop",   t_loop,   1e9*t_loop/nval,   t_launch/t_loop);
+  printf("%-8s %12.4e %12.3f %10.3f\n", "batch",  t_batch,  1e9*t_batch/nval,  t_launch/t_batch);
+
+  return nerr;
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  int nerr = 0;
+  Input in;
+  if ( ! parse(argc, argv, in)) return 0;
+
+  ekat::initialize_ekat_session(argc, argv); {
+    nerr = run(in);
+  } ekat::finalize_ekat_session();
+
+  return nerr != 0 ? 1 : 0;
+}
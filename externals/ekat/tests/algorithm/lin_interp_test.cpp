@@ -273,6 +273,128 @@ TEST_CASE("lin_interp_soak", "lin_interp") {
   }
 }
 
+TEST_CASE("lin_interp_batch", "lin_interp") {
+
+  std::default_random_engine generator;
+  std::uniform_int_distribution<int> k_dist(10,100);
+  const Real minthresh = 0.000001;
+  const int ncol = 10;
+  constexpr int nfield = 5;
+
+  using LIV = ekat::LinInterp<Real,EKAT_TEST_POSSIBLY_NO_PACK_SIZE>;
+  using Pack = ekat::Pack<Real,EKAT_TEST_PACK_SIZE>;
+
+  for (int r = 0; r < 20; ++r) {
+    const int km1 = k_dist(generator);
+    const int km2 = k_dist(generator);
+    const int km1_pack = ekat::npack<Pack>(km1);
+    const int km2_pack = ekat::npack<Pack>(km2);
+
+    LIV vect(ncol, km1, km2, minthresh);
+    typename LIV::template view_2d<Pack>
+      x1kv("x1kv", ncol, km1_pack),
+      x2kv("x2kv", ncol, km2_pack);
+    typename LIV::KT::template view_3d<Pack>
+      y1kv("y1kv", ncol, nfield, km1_pack),
+      y2kv_one("y2kv_one", ncol, nfield, km2_pack),
+      y2kv_batch("y2kv_batch", ncol, nfield, km2_pack),
+      y2kv_batch_tvr("y2kv_batch_tvr", ncol, nfield, km2_pack),
+      y2kv_batch_ptr("y2kv_batch_ptr", ncol, nfield, km2_pack);
+
+    // Initialize kokkos packed inputs
+    {
+      auto x1kvm = Kokkos::create_mirror_view(x1kv);
+      auto x2kvm = Kokkos::create_mirror_view(x2kv);
+      auto y1kvm = Kokkos::create_mirror_view(y1kv);
+      auto x1s = ekat::scalarize(x1kvm);
+      auto x2s = ekat::scalarize(x2kvm);
+      std::vector<Real> y1_tmp(km1);
+      for (int i = 0; i < ncol; ++i) {
+        populate_li_input(km1, km2, &x1s(i, 0), y1_tmp.data(), &x2s(i, 0), &generator);
+        for (int f = 0; f < nfield; ++f) {
+          for (int j = 0; j < km1; ++j) {
+            y1kvm(i, f, j/Pack::n)[j%Pack::n] = (f+1)*y1_tmp[j] - 10*f;
+          }
+        }
+      }
+      Kokkos::deep_copy(x1kv, x1kvm);
+      Kokkos::deep_copy(x2kv, x2kvm);
+      Kokkos::deep_copy(y1kv, y1kvm);
+    }
+
+    // One lin_interp call per field, and batched calls over TTR, with the
+    // fields given as a 2D view and as arrays of view pointers
+    Kokkos::parallel_for("lin-interp-ut-batch-ttr",
+                         vect.policy(),
+                         KOKKOS_LAMBDA(typename LIV::MemberType const& team_member) {
+      using uview_1d = ekat::Unmanaged<typename LIV::template view_1d<Pack> >;
+
+      const int i = team_member.league_rank();
+      const auto x1 = ekat::subview(x1kv, i);
+      const auto x2 = ekat::subview(x2kv, i);
+      vect.setup(team_member, x1, x2);
+      team_member.team_barrier();
+      for (int f = 0; f < nfield; ++f) {
+        vect.lin_interp(team_member, x1, x2,
+                        ekat::subview(y1kv, i, f),
+                        ekat::subview(y2kv_one, i, f));
+      }
+      vect.lin_interp_batch(team_member, x1, x2,
+                            ekat::subview(y1kv, i),
+                            ekat::subview(y2kv_batch, i));
+
+      uview_1d y1f[nfield], y2f[nfield];
+      Kokkos::Array<const uview_1d*, nfield> y1ptrs;
+      Kokkos::Array<uview_1d*, nfield> y2ptrs;
+      for (int f = 0; f < nfield; ++f) {
+        y1f[f] = ekat::subview(y1kv, i, f);
+        y2f[f] = ekat::subview(y2kv_batch_ptr, i, f);
+        y1ptrs[f] = &y1f[f];
+        y2ptrs[f] = &y2f[f];
+      }
+      vect.lin_interp_batch(team_member, x1, x2, y1ptrs, y2ptrs);
+    });
+
+    // Batched call over TVR, reusing the index map from above
+    {
+      typename LIV::TeamPolicy policy(ncol, 1, vect.km2_pack());
+      Kokkos::parallel_for("lin-interp-ut-batch-tvr", policy,
+                           KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+        const int i = team.league_rank();
+        const auto& tvr = Kokkos::ThreadVectorRange(team, vect.km2_pack());
+        vect.lin_interp_batch(team, tvr,
+                              ekat::subview(x1kv, i),
+                              ekat::subview(x2kv, i),
+                              ekat::subview(y1kv, i),
+                              ekat::subview(y2kv_batch_tvr, i));
+      });
+    }
+
+    // Compare results: batched interpolation must be BFB with per-field calls
+    {
+      auto y2_one = Kokkos::create_mirror_view(y2kv_one);
+      auto y2_batch = Kokkos::create_mirror_view(y2kv_batch);
+      auto y2_batch_tvr = Kokkos::create_mirror_view(y2kv_batch_tvr);
+      auto y2_batch_ptr = Kokkos::create_mirror_view(y2kv_batch_ptr);
+      Kokkos::deep_copy(y2_one, y2kv_one);
+      Kokkos::deep_copy(y2_batch, y2kv_batch);
+      Kokkos::deep_copy(y2_batch_tvr, y2kv_batch_tvr);
+      Kokkos::deep_copy(y2_batch_ptr, y2kv_batch_ptr);
+      for (int i = 0; i < ncol; ++i) {
+        for (int f = 0; f < nfield; ++f) {
+          for (int j = 0; j < km2; ++j) {
+            const int k_idx = j / Pack::n;
+            const int p_idx = j % Pack::n;
+            REQUIRE(y2_one(i, f, k_idx)[p_idx] == y2_batch(i, f, k_idx)[p_idx]);
+            REQUIRE(y2_one(i, f, k_idx)[p_idx] == y2_batch_tvr(i, f, k_idx)[p_idx]);
+            REQUIRE(y2_one(i, f, k_idx)[p_idx] == y2_batch_ptr(i, f, k_idx)[p_idx]);
+          }
+        }
+      }
+    }
+  }
+}
+
 TEST_CASE("lin_interp_api", "lin_interp")
 {
   // Test if API is flexible enough to handle various combinations
@@ -299,6 +421,15 @@ TEST_CASE("lin_interp_api", "lin_interp")
 
   view_1dc x1c(x1), x2c(x2), y1c(y1);
 
+  using view_2d = typename LIV::template view_2d<Pack>;
+  using view_2dc = typename LIV::template view_2d<const Pack>;
+
+  view_2d
+    y1b("y1b", 2, km1_pack),
+    y2b("y2b", 2, km2_pack);
+
+  view_2dc y1bc(y1b);
+
   Kokkos::parallel_for("lin-interp-ut-vect",
                        vect.policy(),
                        KOKKOS_LAMBDA(typename LIV::MemberType const& team_member)
@@ -317,6 +448,11 @@ TEST_CASE("lin_interp_api", "lin_interp")
     vect.lin_interp(team_member, x1, x2c, y1c, y2);
     vect.lin_interp(team_member, x1c, x2, y1c, y2);
     vect.lin_interp(team_member, x1c, x2c, y1c, y2);
+
+    vect.lin_interp_batch(team_member, x1, x2, y1b, y2b);
+    vect.lin_interp_batch(team_member, x1c, x2c, y1b, y2b);
+    vect.lin_interp_batch(team_member, x1, x2, y1bc, y2b);
+    vect.lin_interp_batch(team_member, x1c, x2c, y1bc, y2b);
   });
 }
 
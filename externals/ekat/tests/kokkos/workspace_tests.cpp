@@ -79,11 +79,151 @@ static void unittest_workspace_overprovision()
   }
 }
 
+static void unittest_workspace_stack()
+{
+  using namespace ekat;
+
+  using WSM = WorkspaceManager<double, Device>;
+
+  const int ni = 128;
+  const int nk = 128;
+  TeamPolicy policy(ExeSpaceUtils<ExeSpace>::get_default_team_policy(ni, nk));
+
+  // Stacks in global memory, and in team scratch memory
+  for (const bool scratch : {false, true}) {
+    // 100 doubles are rounded up to 13 cache lines
+    const WSM wsm = scratch ?
+      WSM(typename WSM::TeamScratch{0}, typename WSM::StackMode(), 100, policy) :
+      WSM(typename WSM::StackMode(), 100, policy);
+    REQUIRE(wsm.is_stack_mode());
+    REQUIRE(wsm.uses_team_scratch() == scratch);
+    REQUIRE(wsm.m_size == 104);
+    REQUIRE(wsm.get_stack_high_water() == 0);
+
+    int nerr = 0;
+    Kokkos::parallel_reduce("unittest_workspace_stack", wsm.get_team_policy(), KOKKOS_LAMBDA(const MemberType& team, int& total_errs) {
+      int nerrs_local = 0;
+      auto ws = wsm.get_workspace(team);
+
+      // As in unittest_workspace, the nerrs_local increments are benign races.
+      if (ws.get_stack_mark() != 0) ++nerrs_local;
+
+      const auto a = ws.take_stack("a", 10);
+      if (a.extent_int(0) != 10) ++nerrs_local;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 10), [&] (int i) { a(i) = i; });
+
+      // 3 ints use 2 doubles
+      const auto b = ws.template take_stack<int>("b", 3);
+      if (b.extent_int(0) != 3) ++nerrs_local;
+      if (ws.get_stack_mark() != 12) ++nerrs_local;
+
+      // Aligned to a cache line, so it starts at 16
+      const auto c = ws.take_stack("c", 5, 64);
+      if (reinterpret_cast<std::uintptr_t>(c.data()) % 64 != 0) ++nerrs_local;
+      if (ws.get_stack_mark() != 21) ++nerrs_local;
+
+      const auto d = ws.take_stack_2d("d", 3, 4);
+      if (d.extent_int(0) != 3 || d.extent_int(1) != 4) ++nerrs_local;
+      if (ws.get_stack_mark() != 33) ++nerrs_local;
+
+      {
+        typename WSM::Workspace::StackScope scope(ws);
+        const auto e = ws.take_stack("e", 20);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 20), [&] (int i) { e(i) = -1; });
+        team.team_barrier();
+      }
+      if (ws.get_stack_mark() != 33) ++nerrs_local;
+
+      // Releasing b also releases c and d
+      ws.release_stack(b);
+      if (ws.get_stack_mark() != 10) ++nerrs_local;
+
+      team.team_barrier();
+      Kokkos::single(Kokkos::PerTeam(team), [&] () {
+        for (int i = 0; i < 10; ++i) {
+          if (a(i) != i) ++nerrs_local;
+        }
+      });
+
+      ws.release_stack(a);
+      if (ws.get_stack_mark() != 0) ++nerrs_local;
+
+      total_errs += nerrs_local;
+      team.team_barrier();
+    }, nerr);
+
+    REQUIRE(nerr == 0);
+    REQUIRE(wsm.get_stack_high_water() == 53);
+  }
+}
+
+static void unittest_workspace_team_scratch()
+{
+  using namespace ekat;
+
+  using WSM = WorkspaceManager<double, Device>;
+
+  static constexpr const int n_slots_per_team = 4;
+  const int slot_length = 17;
+  const int ni = 128;
+  const int nk = 128;
+  TeamPolicy policy(ExeSpaceUtils<ExeSpace>::get_default_team_policy(ni, nk));
+
+  // Too large for level 0 scratch, so global memory is used.
+  {
+    WSM wsm(typename WSM::TeamScratch{0}, 1 << 20, n_slots_per_team, policy);
+    REQUIRE(!wsm.uses_team_scratch());
+    REQUIRE(wsm.get_team_scratch_bytes() == 0);
+    REQUIRE(wsm.get_team_policy().scratch_size(0) == 0);
+    REQUIRE(wsm.m_data.size() > 0);
+  }
+
+  WSM wsm(typename WSM::TeamScratch{0}, slot_length, n_slots_per_team, policy);
+  REQUIRE(wsm.uses_team_scratch());
+  REQUIRE(wsm.m_data.size() == 0);
+  REQUIRE(wsm.get_team_policy().scratch_size(0) >= static_cast<size_t>(wsm.get_team_scratch_bytes()));
+
+  int nerr = 0;
+  Kokkos::parallel_reduce("unittest_workspace_team_scratch", wsm.get_team_policy(), KOKKOS_LAMBDA(const MemberType& team, int& total_errs) {
+    int nerrs_local = 0;
+    auto ws = wsm.get_workspace(team);
+
+    Kokkos::Array<Unmanaged<view_1d<double> >, n_slots_per_team> wssub;
+    for (int w = 0; w < n_slots_per_team; ++w) {
+      wssub[w] = ws.take("ws");
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, slot_length), [&] (int i) {
+        wssub[w](i) = i*w;
+      });
+    }
+    team.team_barrier();
+
+    // As in unittest_workspace, the nerrs_local increments are benign races.
+    for (int w = 0; w < n_slots_per_team; ++w) {
+      if (wssub[w].data() < ws.m_ws_data || wssub[w].data() >= ws.m_ws_data + n_slots_per_team*(slot_length+1)) ++nerrs_local;
+      for (int i = 0; i < slot_length; ++i) {
+        if (wssub[w](i) != i*w) ++nerrs_local;
+      }
+    }
+    team.team_barrier();
+
+    for (int w = n_slots_per_team - 1; w >= 0; --w) {
+      ws.release(wssub[w]);
+    }
+
+    total_errs += nerrs_local;
+    team.team_barrier();
+  }, nerr);
+
+  REQUIRE(nerr == 0);
+}
+
 static void unittest_workspace()
 {
   using namespace ekat;
 
   unittest_workspace_overprovision();
+  unittest_workspace_stack();
+  unittest_workspace_team_scratch();
 
   static constexpr const int n_slots_per_team = 4;
   const int ni = 128;
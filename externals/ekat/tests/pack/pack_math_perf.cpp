@@ -0,0 +1,258 @@
+#include "ekat/ekat_pack.hpp"
+#include "ekat/util/ekat_vector_math.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/ekat_session.hpp"
+
+#include "ekat_test_config.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+/*
+ * pack_math_perf compares, for exp, log, log10, tanh and pow of packs, the
+ * std:: functions applied lane by lane with the vectorizable implementations
+ * in ekat_vector_math.hpp:
+ *   - accuracy: the max error in ulps of each over n random inputs in a range
+ *     typical of the physics parameterizations, relative to the long double
+ *     std:: function. The test fails if a vmath error exceeds its bound.
+ *   - special values: vmath must give the std:: result for +-0, +-inf, NaN,
+ *     subnormals and arguments out of range.
+ *   - throughput: the best time over r repetitions to evaluate the n inputs,
+ *     with std, vmath, and the ekat:: Pack overload (which is one of the two,
+ *     depending on EKAT_VECTOR_MATH).
+ */
+
+using Pack = ekat::Pack<Real,EKAT_TEST_PACK_SIZE>;
+
+struct Input {
+  int n      = 1 << 20;
+  int repeat = 10;
+};
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+bool parse (int argc, char** argv, Input& in) {
+  using ekat::argv_matches;
+  for (int i = 1; i < argc; ++i) {
+    if (argv_matches(argv[i], "-h", "--help")) {
+      std::cout <<
+        argv[0] << " [options]\n"
+        "Options:\n"
+        "  -n <n>         Number of inputs per function. Default=1048576.\n"
+        "  -r <repeat>    Number of repetitions; the best time is reported. Default=10.\n";
+      return false;
+    } else if (argv_matches(argv[i], "-n", "--n")) {
+      expect_another_arg(i, argc);
+      in.n = std::atoi(argv[++i]);
+    } else if (argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      in.repeat = std::atoi(argv[++i]);
+    } else {
+      std::cout << "Unexpected arg: " << argv[i] << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+// Each function has two arguments; the unary ones ignore the second. The
+// inputs are x = lo + (hi - lo)*u, or 10^x if log_scale, and similarly for y.
+struct Exp {
+  static constexpr const char* name = "exp";
+  static constexpr Real xlo = -50, xhi = 50, ylo = 0, yhi = 0, max_ulp = 2;
+  static constexpr bool log_scale = false;
+  static long double ref (long double x, long double) { return std::exp(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real std_fn (Real x, Real) { return std::exp(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real vmath_fn (Real x, Real) { return ekat::vmath::exp(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Pack pack_fn (const Pack& x, const Pack&) { return ekat::exp(x); }
+};
+
+struct Log {
+  static constexpr const char* name = "log";
+  static constexpr Real xlo = -30, xhi = 30, ylo = 0, yhi = 0, max_ulp = 2;
+  static constexpr bool log_scale = true;
+  static long double ref (long double x, long double) { return std::log(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real std_fn (Real x, Real) { return std::log(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real vmath_fn (Real x, Real) { return ekat::vmath::log(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Pack pack_fn (const Pack& x, const Pack&) { return ekat::log(x); }
+};
+
+struct Log10 {
+  static constexpr const char* name = "log10";
+  static constexpr Real xlo = -30, xhi = 30, ylo = 0, yhi = 0, max_ulp = 2;
+  static constexpr bool log_scale = true;
+  static long double ref (long double x, long double) { return std::log10(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real std_fn (Real x, Real) { return std::log10(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real vmath_fn (Real x, Real) { return ekat::vmath::log10(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Pack pack_fn (const Pack& x, const Pack&) { return ekat::log10(x); }
+};
+
+struct Tanh {
+  static constexpr const char* name = "tanh";
+  static constexpr Real xlo = -10, xhi = 10, ylo = 0, yhi = 0, max_ulp = 4;
+  static constexpr bool log_scale = false;
+  static long double ref (long double x, long double) { return std::tanh(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real std_fn (Real x, Real) { return std::tanh(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real vmath_fn (Real x, Real) { return ekat::vmath::tanh(x); }
+  static KOKKOS_FORCEINLINE_FUNCTION Pack pack_fn (const Pack& x, const Pack&) { return ekat::tanh(x); }
+};
+
+struct Pow {
+  static constexpr const char* name = "pow";
+  static constexpr Real xlo = -5, xhi = 5, ylo = -4, yhi = 4, max_ulp = 4;
+  static constexpr bool log_scale = true;
+  static long double ref (long double x, long double y) { return std::pow(x, y); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real std_fn (Real x, Real y) { return std::pow(x, y); }
+  static KOKKOS_FORCEINLINE_FUNCTION Real vmath_fn (Real x, Real y) { return ekat::vmath::pow(x, y); }
+  static KOKKOS_FORCEINLINE_FUNCTION Pack pack_fn (const Pack& x, const Pack& y) { return ekat::pow(x, y); }
+};
+
+// Error of v in ulps of the exact value r.
+double ulp_err (const Real v, const long double r) {
+  const Real rr = static_cast<Real>(r);
+  const Real a = std::abs(rr);
+  const Real ulp = std::nextafter(a, std::numeric_limits<Real>::infinity()) - a;
+  return static_cast<double>(std::abs(static_cast<long double>(v) - r) / ulp);
+}
+
+bool same (const Real a, const Real b) {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+// Best time [s] over in.repeat calls of f.
+template <typename F>
+double time_best (const Input& in, const F& f) {
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < in.repeat; ++r) {
+    Kokkos::Timer timer;
+    f();
+    best = std::min(best, timer.seconds());
+  }
+  return best;
+}
+
+template <typename F>
+int run_fn (const Input& in) {
+  const int npack = (in.n + Pack::n - 1)/Pack::n;
+  std::vector<Pack> x(npack), y(npack), out(npack);
+  {
+    std::default_random_engine generator;
+    std::uniform_real_distribution<Real> u(0, 1);
+    for (int k = 0; k < npack; ++k) {
+      for (int s = 0; s < Pack::n; ++s) {
+        const Real xs = F::xlo + (F::xhi - F::xlo)*u(generator);
+        const Real ys = F::ylo + (F::yhi - F::ylo)*u(generator);
+        x[k][s] = F::log_scale ? std::pow(Real(10), xs) : xs;
+        y[k][s] = ys;
+      }
+    }
+  }
+
+  // Accuracy
+  double std_ulp = 0, vmath_ulp = 0;
+  for (int k = 0; k < npack; ++k) {
+    for (int s = 0; s < Pack::n; ++s) {
+      const long double r = F::ref(x[k][s], y[k][s]);
+      std_ulp   = std::max(std_ulp,   ulp_err(F::std_fn(x[k][s], y[k][s]), r));
+      vmath_ulp = std::max(vmath_ulp, ulp_err(F::vmath_fn(x[k][s], y[k][s]), r));
+    }
+  }
+
+  // Special values
+  const Real inf = std::numeric_limits<Real>::infinity();
+  const Real nan = std::numeric_limits<Real>::quiet_NaN();
+  const Real tiny = std::numeric_limits<Real>::denorm_min();
+  const Real big = std::numeric_limits<Real>::max();
+  const std::vector<Real> specials = {0, -0.0, 1, -1, 2, -2, 3, 0.5, -0.5, 10, 1000,
+                                      tiny, 100*tiny, big, -big, inf, -inf, nan,
+                                      Real(1e4), Real(-1e4)};
+  int nspecial = 0;
+  for (const auto a : specials) {
+    for (const auto b : specials) {
+      const Real vs = F::std_fn(a, b), vv = F::vmath_fn(a, b);
+      // Subnormal results need not agree to the last bit, and results within
+      // a few ulps of the largest Real may overflow.
+      const bool ok = same(vs, vv) ||
+        (std::abs(vs) < std::numeric_limits<Real>::min() &&
+         std::abs(vv - vs) <= 2*tiny) ||
+        (std::isinf(vv) && std::abs(vs) >= big*(1 - F::max_ulp*std::numeric_limits<Real>::epsilon())) ||
+        (std::isfinite(vs) && ulp_err(vv, F::ref(a, b)) <= F::max_ulp);
+      if (!ok) {
+        if (nspecial < 10) {
+          std::cout << F::name << "(" << a << ", " << b << "): std " << vs
+                    << " vmath " << vv << "\n";
+        }
+        ++nspecial;
+      }
+    }
+  }
+
+  // Throughput
+  const double t_std = time_best(in, [&] () {
+    for (int k = 0; k < npack; ++k) {
+      vector_simd for (int s = 0; s < Pack::n; ++s) out[k][s] = F::std_fn(x[k][s], y[k][s]);
+    }
+  });
+  const double t_vmath = time_best(in, [&] () {
+    for (int k = 0; k < npack; ++k) {
+      vector_simd for (int s = 0; s < Pack::n; ++s) out[k][s] = F::vmath_fn(x[k][s], y[k][s]);
+    }
+  });
+  const double t_pack = time_best(in, [&] () {
+    for (int k = 0; k < npack; ++k) out[k] = F::pack_fn(x[k], y[k]);
+  });
+
+  const double nval = double(npack)*Pack::n;
+  printf("%-6s %10.3f %10.3f %12.3f %12.3f %12.3f %10.3f %8d\n", F::name, std_ulp, vmath_ulp,
+         1e9*t_std/nval, 1e9*t_vmath/nval, 1e9*t_pack/nval, t_std/t_vmath, nspecial);
+
+  int nerr = nspecial;
+  if (vmath_ulp > F::max_ulp) {
+    std::cout << F::name << ": vmath error " << vmath_ulp << " ulp exceeds " << F::max_ulp << "\n";
+    ++nerr;
+  }
+  return nerr;
+}
+
+int run (const Input& in) {
+  printf("run: n %d pack %d real %s vector_math %s\n", in.n, Pack::n,
+         sizeof(Real) == sizeof(double) ? "double" : "float",
+#ifdef EKAT_VECTOR_MATH
+         "on"
+#else
+         "off"
+#endif
+         );
+  printf("%-6s %10s %10s %12s %12s %12s %10s %8s\n", "fn", "std [ulp]", "vmath [ulp]",
+         "std [ns]", "vmath [ns]", "pack [ns]", "speedup", "special");
+  int nerr = 0;
+  nerr += run_fn<Exp>(in);
+  nerr += run_fn<Log>(in);
+  nerr += run_fn<Log10>(in);
+  nerr += run_fn<Tanh>(in);
+  nerr += run_fn<Pow>(in);
+  return nerr;
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  int nerr = 0;
+  Input in;
+  if ( ! parse(argc, argv, in)) return 0;
+
+  ekat::initialize_ekat_session(argc, argv); {
+    nerr = run(in);
+  } ekat::finalize_ekat_session();
+
+  return nerr != 0 ? 1 : 0;
+}
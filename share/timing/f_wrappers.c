@@ -19,6 +19,8 @@
 #define gptlprint_mode_set GPTLPRINT_MODE_SET
 #define gptlpr GPTLPR
 #define gptlpr_file GPTLPR_FILE
+#define gptlpr_trace GPTLPR_TRACE
+#define gptltrace_sync GPTLTRACE_SYNC
 #define gptlpr_summary GPTLPR_SUMMARY
 #define gptlpr_summary_FILE GPTLPR_SUMMARY_FILE
 #define gptlbarrier GPTLBARRIER
@@ -55,6 +57,8 @@
 #define gptlprint_mode_set          FCI_GLOBAL(gptlprint_mode_set,GPTLPRINT_MODE_SET)
 #define gptlpr                      FCI_GLOBAL(gptlpr,GPTLPR)
 #define gptlpr_file                 FCI_GLOBAL(gptlpr_file,GPTLPR_FILE)
+#define gptlpr_trace                FCI_GLOBAL(gptlpr_trace,GPTLPR_TRACE)
+#define gptltrace_sync              FCI_GLOBAL(gptltrace_sync,GPTLTRACE_SYNC)
 #define gptlpr_summary              FCI_GLOBAL(gptlpr_summary,GPTLPR_SUMMARY)
 #define gptlpr_summary_file         FCI_GLOBAL(gptlpr_summary_file,GPTLPR_SUMMARY_FILE)
 #define gptlbarrier                 FCI_GLOBAL(gptlbarrier,GPTLBARRIER)
@@ -91,6 +95,8 @@
 #define gptlprint_mode_set gptlprint_mode_set_
 #define gptlpr gptlpr_
 #define gptlpr_file gptlpr_file_
+#define gptlpr_trace gptlpr_trace_
+#define gptltrace_sync gptltrace_sync_
 #define gptlpr_summary gptlpr_summary_
 #define gptlpr_summary_file gptlpr_summary_file_
 #define gptlbarrier gptlbarrier_
@@ -127,6 +133,8 @@
 #define gptlprint_mode_set gptlprint_mode_set__
 #define gptlpr gptlpr__
 #define gptlpr_file gptlpr_file__
+#define gptlpr_trace gptlpr_trace__
+#define gptltrace_sync gptltrace_sync__
 #define gptlpr_summary gptlpr_summary__
 #define gptlpr_summary_file gptlpr_summary_file__
 #define gptlbarrier gptlbarrier__
@@ -167,6 +175,8 @@ int gptlprint_mode_query (void);
 int gptlprint_mode_set (int *pr_mode);
 int gptlpr (int *procid);
 int gptlpr_file (char *file, int nc1);
+int gptlpr_trace (int *procid);
+int gptltrace_sync (int *fcomm);
 int gptlpr_summary (int *fcomm);
 int gptlpr_summary_file (int *fcomm, char *name, int nc1);
 int gptlbarrier (int *fcomm, char *name, int nc1);
@@ -249,6 +259,28 @@ int gptlpr_file (char *file, int nc1)
   return ret;
 }
 
+int gptlpr_trace (int *procid)
+{
+  return GPTLpr_trace (*procid);
+}
+
+int gptltrace_sync (int *fcomm)
+{
+#ifdef HAVE_MPI
+  MPI_Comm ccomm;
+#ifdef HAVE_COMM_F2C
+  ccomm = MPI_Comm_f2c (*fcomm);
+#else
+  /* Punt and try just casting the Fortran communicator */
+  ccomm = (MPI_Comm) *fcomm;
+#endif
+#else
+  int ccomm = 0;
+#endif
+
+  return GPTLtrace_sync (ccomm);
+}
+
 int gptlpr_summary (int *fcomm)
 {
 #ifdef HAVE_MPI
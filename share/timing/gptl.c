@@ -56,6 +56,10 @@ static bool dopr_threadsort = true; /* whether to print sorted thread stats */
 static bool dopr_multparent = true; /* whether to print multiple parent info */
 static bool dopr_collision = true;  /* whether to print hash collision info */
 static bool dopr_quotes = false;    /* whether to surround timer names with double quotes */
+static int trace_size = 0;          /* per-thread number of start/stop events kept for tracing */
+static double trace_t0 = 0.;        /* wallclock time taken as time 0 in the trace */
+static double trace_t0_mpi = -1.;   /* MPI_Wtime at trace_t0 (-1 if not taken) */
+static bool trace_t0_synced = false;/* whether trace_t0 was taken right after a barrier */
 
 static time_t ref_gettimeofday = -1; /* ref start point for gettimeofday */
 static time_t ref_clock_gettime = -1;/* ref start point for clock_gettime */
@@ -141,6 +145,19 @@ typedef struct {
 static Timer ***callstack;       /* call stack */
 static Nofalse *stackidx;        /* index into callstack: */
 
+typedef struct {
+  const Timer *timer;            /* timer which was started and stopped */
+  double start;                  /* timestamp from start */
+  double stop;                   /* timestamp from stop */
+} Traceevent;
+
+typedef struct {
+  Traceevent *events;            /* ring buffer of the most recent trace_size events */
+  unsigned long nrecorded;       /* number of events recorded so far */
+  int padding[28];               /* padding is to mitigate false cache sharing */
+} Tracebuf;
+static Tracebuf *tracebuf = 0;   /* per-thread event trace (only if trace_size > 0) */
+
 static int prefix_len_nt;        /* length of timer name prefix set outside parallel region */
 static char *prefix_nt;          /* timer name prefix set outside of parallel region */
 static int *prefix_len;          /* length of timer name prefix for each thread */
@@ -213,6 +230,8 @@ static int ncmp (const void *, const void *);
 static int get_index ( const char *, const char *);
 
 static int add_prefix( char *, const char *, const int, const int);
+static void print_trace_name (FILE *, const char *);
+static int trace_id (void);
 
 typedef struct {
   const Funcoption option;
@@ -379,6 +398,14 @@ int GPTLsetoption (const int option,  /* option */
     maxthreads = val;
     return 0;
 
+  case GPTLtrace:
+    if (val < 0)
+      return GPTLerror ("%s: trace size must be non-negative. %d is invalid\n", thisfunc, val);
+    trace_size = val;
+    if (verbose)
+      printf ("%s: trace_size = %d\n", thisfunc, trace_size);
+    return 0;
+
   /*
   ** Allow GPTLmultiplex to fall through because it will be handled by
   ** GPTL_PAPIsetoption()
@@ -515,6 +542,21 @@ int GPTLinitialize (void)
   prefix_nt = (char *) GPTLallocate ((MAX_CHARS+1) * sizeof (char));
   prefix_nt[0] = '\0';
 
+  /*
+  ** Event tracing needs the start timestamps which are only taken for wallclock stats
+  */
+
+  if (trace_size > 0) {
+    if ( ! wallstats.enabled)
+      return GPTLerror ("%s: GPTLtrace requires GPTLwall to be enabled\n", thisfunc);
+
+    tracebuf = (Tracebuf *) GPTLallocate (maxthreads * sizeof (Tracebuf));
+    for (t = 0; t < maxthreads; t++) {
+      tracebuf[t].events = (Traceevent *) GPTLallocate (trace_size * sizeof (Traceevent));
+      tracebuf[t].nrecorded = 0;
+    }
+  }
+
 #ifdef HAVE_PAPI
   if (GPTL_PAPIinitialize (maxthreads, verbose, &nevents, eventlist) < 0)
     return GPTLerror ("%s: Failure from GPTL_PAPIinitialize\n", thisfunc);
@@ -547,6 +589,13 @@ int GPTLinitialize (void)
     overhead_utr = utr_getoverhead ();
   }
 
+  /*
+  ** Time 0 of the trace is local to this process until GPTLtrace_sync is called
+  */
+
+  if (tracebuf)
+    trace_t0 = (*ptr2wtimefunc) ();
+
   initialized = true;
   return 0;
 }
@@ -568,6 +617,19 @@ int GPTLfinalize (void)
   if ( ! initialized)
     return GPTLerror ("%s: initialization was not completed\n", thisfunc);
 
+  /*
+  ** Write the event trace before the timers it refers to are freed
+  */
+
+  if (tracebuf) {
+    if (GPTLpr_trace (trace_id ()) != 0)
+      fprintf (stderr, "%s: Error in GPTLpr_trace\n", thisfunc);
+    for (t = 0; t < maxthreads; ++t)
+      free (tracebuf[t].events);
+    free (tracebuf);
+    tracebuf = 0;
+  }
+
   for (t = 0; t < maxthreads; ++t) {
     for (n = 0; n < tablesize; ++n) {
       if (hashtable[t][n].nument > 0)
@@ -625,6 +687,10 @@ int GPTLfinalize (void)
   dopr_threadsort = true;
   dopr_multparent = true;
   dopr_collision = true;
+  trace_size = 0;
+  trace_t0 = 0.;
+  trace_t0_mpi = -1.;
+  trace_t0_synced = false;
   print_mode = GPTLprint_write;
   ref_gettimeofday = -1;
   ref_clock_gettime = -1;
@@ -2310,6 +2376,14 @@ static inline int update_stats (Timer *ptr,
     ptr->wall.accum += delta;
     ptr->wall.latest = delta;
 
+    if (tracebuf) {
+      Traceevent *event = &tracebuf[t].events[tracebuf[t].nrecorded % trace_size];
+      event->timer = ptr;
+      event->start = ptr->wall.last;
+      event->stop  = tp1;
+      ++tracebuf[t].nrecorded;
+    }
+
     if (ptr->count == 1) {
       ptr->wall.max = delta;
 
@@ -2934,6 +3008,125 @@ int GPTLpr_file (const char *outfile) /* output file to write */
   return 0;
 }
 
+/*
+** GPTLpr_trace: Write the event trace recorded when GPTLtrace is set, as
+**   Chrome trace JSON which chrome://tracing and Perfetto can load. Each
+**   thread keeps only its most recent trace_size start/stop pairs.
+**   Timestamps are relative to the time 0 set by GPTLinitialize, or by
+**   GPTLtrace_sync, so traces of different ranks line up only if the latter
+**   was called.
+**
+** Input arguments:
+**   id: integer to use in file name "gptl_trace.<id>.json", and as process id
+**       in the trace (e.g. the MPI rank)
+**
+** Return value: 0 (success) or GPTLerror (failure)
+*/
+
+int GPTLpr_trace (const int id)
+{
+  FILE *fp;                 /* file handle to write to */
+  char outfile[32];         /* name of output file: gptl_trace.<id>.json */
+  int t;                    /* thread index */
+  unsigned long n;          /* event index */
+  unsigned long first;      /* index of oldest event still in the ring buffer */
+  unsigned long dropped;    /* number of events overwritten in the ring buffers */
+  const Traceevent *event;  /* event being printed */
+  const char *sep = "";     /* separator between events */
+  static const char *thisfunc = "GPTLpr_trace";
+
+  if ( ! initialized)
+    return GPTLerror ("%s: GPTLinitialize() has not been called\n", thisfunc);
+
+  if ( ! tracebuf)
+    return GPTLerror ("%s: tracing was not enabled with GPTLtrace\n", thisfunc);
+
+  if (id < 0)
+    return GPTLerror ("%s: bad id=%d for output file. Must be >= 0\n", thisfunc, id);
+
+  sprintf (outfile, "gptl_trace.%d.json", id);
+
+  if ( ! (fp = fopen (outfile, "w")))
+    return GPTLerror ("%s: cannot open %s\n", thisfunc, outfile);
+
+  /*
+  ** Complete ("X") events, with timestamps and durations in microseconds
+  */
+
+  dropped = 0;
+  fprintf (fp, "{\"traceEvents\":[\n");
+  for (t = 0; t < maxthreads; t++) {
+    if (tracebuf[t].nrecorded > (unsigned long) trace_size) {
+      first = tracebuf[t].nrecorded - trace_size;
+      dropped += first;
+    } else {
+      first = 0;
+    }
+    for (n = first; n < tracebuf[t].nrecorded; n++) {
+      event = &tracebuf[t].events[n % trace_size];
+      fprintf (fp, "%s{\"name\":", sep);
+      print_trace_name (fp, event->timer->name);
+      fprintf (fp, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+	       id, t, (event->start - trace_t0)*1.e6, (event->stop - event->start)*1.e6);
+      sep = ",\n";
+    }
+  }
+  fprintf (fp, "\n],\n\"displayTimeUnit\":\"ms\",\n");
+  fprintf (fp, "\"otherData\":{\"timer\":\"%s\",\"trace_size\":%d,\"dropped_events\":%lu,"
+	   "\"t0_synchronized\":%s,\"t0_mpi_wtime\":%.6f}}\n",
+	   funclist[funcidx].name, trace_size, dropped,
+	   trace_t0_synced ? "true" : "false", trace_t0_mpi);
+
+  if (fclose (fp) != 0)
+    fprintf (stderr, "Attempt to close %s failed\n", outfile);
+
+  return 0;
+}
+
+/*
+** print_trace_name: Print a timer name as a JSON string
+**
+** Input arguments:
+**   fp:   file descriptor
+**   name: timer name
+*/
+
+static void print_trace_name (FILE *fp, const char *name)
+{
+  const char *c;
+
+  fputc ('"', fp);
+  for (c = name; *c; c++) {
+    if (*c == '"' || *c == '\\')
+      fprintf (fp, "\\%c", *c);
+    else if ((unsigned char) *c < 0x20)
+      fprintf (fp, "\\u%04x", (unsigned char) *c);
+    else
+      fputc (*c, fp);
+  }
+  fputc ('"', fp);
+}
+
+/*
+** trace_id: Id used for the trace file written at GPTLfinalize: the rank in
+**   MPI_COMM_WORLD if MPI is usable at that point, otherwise the process id,
+**   so that processes do not overwrite each other's trace.
+*/
+
+static int trace_id (void)
+{
+#ifdef HAVE_MPI
+  int flag;
+  int rank;
+
+  if (MPI_Initialized (&flag) == MPI_SUCCESS && flag &&
+      MPI_Finalized (&flag) == MPI_SUCCESS && ! flag &&
+      MPI_Comm_rank (MPI_COMM_WORLD, &rank) == MPI_SUCCESS)
+    return rank;
+#endif
+  return (int) getpid ();
+}
+
 /*
 ** construct_tree: Build the parent->children tree starting with knowledge of
 **                 parent list for each child.
@@ -4202,6 +4395,47 @@ void get_summarystats (Summarystats *summarystats,
   summarystats->threads   += summarystats_slave->threads;
 }
 
+/*
+** GPTLtrace_sync: Set time 0 of the event trace right after a barrier, so
+**   that the traces written by the ranks of comm share the same time base.
+**   The local clocks of the ranks are not synchronized, but all ranks leave
+**   the barrier at nearly the same time. MPI_Wtime at time 0 is also kept
+**   in the trace metadata. Must be called by all ranks of comm, after
+**   GPTLinitialize. Does nothing if tracing is not enabled.
+**
+** Input arguments:
+**   comm: communicator (e.g. MPI_COMM_WORLD)
+**
+** Return value: 0 (success) or GPTLerror (failure)
+*/
+
+#ifdef HAVE_MPI
+int GPTLtrace_sync (MPI_Comm comm)
+#else
+int GPTLtrace_sync (int comm)
+#endif
+{
+#ifdef HAVE_MPI
+  int ret;
+#endif
+  static const char *thisfunc = "GPTLtrace_sync";
+
+  if ( ! initialized)
+    return GPTLerror ("%s: GPTLinitialize() has not been called\n", thisfunc);
+
+  if ( ! tracebuf)
+    return 0;
+
+#ifdef HAVE_MPI
+  if ((ret = MPI_Barrier (comm)) != MPI_SUCCESS)
+    return GPTLerror ("%s: Bad return from MPI_Barrier=%d", thisfunc, ret);
+  trace_t0 = (*ptr2wtimefunc) ();
+  trace_t0_mpi = MPI_Wtime ();
+  trace_t0_synced = true;
+#endif
+  return 0;
+}
+
 /*
 ** GPTLbarrier: When MPI enabled, set and time an MPI barrier
 **
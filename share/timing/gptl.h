@@ -82,7 +82,9 @@ typedef enum {
   ** New ESMF options for GPTL
   */
   GPTLprofile_ovhd   = 27, /* Direct measurement of profiling overhead (false) */
-  GPTLdopr_quotes    = 28  /* Add double quotes to timer names on output (false) */
+  GPTLdopr_quotes    = 28, /* Add double quotes to timer names on output (false) */
+  GPTLtrace          = 29  /* Per-thread number of start/stop events to keep for a
+			      Chrome trace written at finalize (0 = no trace) */
 } Option;
 
 /*
@@ -148,15 +150,18 @@ extern int GPTLprint_mode_query (void);
 extern int GPTLprint_mode_set (const int);
 extern int GPTLpr (const int);
 extern int GPTLpr_file (const char *);
+extern int GPTLpr_trace (const int);
 
 #ifdef HAVE_MPI
 extern int GPTLpr_summary (MPI_Comm comm);
 extern int GPTLpr_summary_file (MPI_Comm, const char *);
 extern int GPTLbarrier (MPI_Comm comm, const char *);
+extern int GPTLtrace_sync (MPI_Comm comm);
 #else
 extern int GPTLpr_summary (int);
 extern int GPTLpr_summary_file (int, const char *);
 extern int GPTLbarrier (int, const char *);
+extern int GPTLtrace_sync (int);
 #endif
 
 extern int GPTLreset (void);